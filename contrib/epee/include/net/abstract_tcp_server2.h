@@ -64,6 +64,9 @@
 #define MONERO_DEFAULT_LOG_CATEGORY "net"
 
 #define ABSTRACT_SERVER_SEND_QUE_MAX_COUNT 1000
+// queued chunks handed to a single (vectored) write
+#define ABSTRACT_SERVER_SEND_COALESCE_MAX_COUNT 64
+#define ABSTRACT_SERVER_SEND_COALESCE_MAX_BYTES (256 * 1024)
 
 namespace epee
 {
@@ -160,6 +163,12 @@ namespace net_utils
     /// Handle completion of a write operation.
     void handle_write(const boost::system::error_code& e, size_t cb);
 
+    /// Drop the written chunks from the send queue and start on the rest
+    void finish_write();
+
+    /// Start writing the head of the send queue, m_send_que_lock must be held
+    void start_write();
+
     /// reset connection timeout timer and callback
     void reset_timer(boost::posix_time::milliseconds ms, bool add);
     boost::posix_time::milliseconds get_default_timeout();
@@ -183,6 +192,7 @@ namespace net_utils
     critical_section m_self_refs_lock;
     critical_section m_chunking_lock; // held while we add small chunks of the big do_send() to small do_send_chunk()
     critical_section m_shutdown_lock; // held while shutting down
+    size_t m_send_que_in_flight; // number of m_send_que entries in the pending write, 0 if none, under m_send_que_lock
     
     t_connection_type m_connection_type;
     
@@ -193,6 +203,7 @@ namespace net_utils
     boost::mutex m_throttle_speed_out_mutex;
 
     boost::asio::deadline_timer m_timer;
+    boost::asio::steady_timer m_send_pace_timer; // holds back the next write while the RPC budget is spent
     bool m_local;
     bool m_ready_to_close;
     std::string m_host;
@@ -236,6 +247,13 @@ namespace net_utils
 	const std::string port_ipv6 = "", const std::string address_ipv6 = "::", bool use_ipv6 = false, bool require_ipv4 = true,
 	ssl_options_t ssl_options = ssl_support_t::e_ssl_support_autodetect);
 
+    /// Spread connections over `count` io_services, each run by its own share
+    /// of the worker threads. Must be called before init_server, and only for
+    /// a server owning its io_service. 1 (the default) disables sharding.
+    bool set_io_shards(size_t count);
+
+    size_t get_io_shards_count() const { return m_shards.size() + 1; }
+
     /// Run the server's io_service loop.
     bool run_server(size_t threads_count, bool wait = true, const boost::thread::attributes& attrs = boost::thread::attributes());
 
@@ -350,7 +368,10 @@ namespace net_utils
 
   private:
     /// Run the server's io_service loop.
-    bool worker_thread();
+    bool worker_thread(size_t shard);
+    /// io_service for the next new connection, round robin over the shards
+    boost::asio::io_service& get_shard_io_service();
+    bool is_shard_io_service(const boost::asio::io_service& io_service) const;
     /// Handle completion of an asynchronous accept operation.
     void handle_accept_ipv4(const boost::system::error_code& e);
     void handle_accept_ipv6(const boost::system::error_code& e);
@@ -372,6 +393,9 @@ namespace net_utils
     };
     std::unique_ptr<worker> m_io_service_local_instance;
     boost::asio::io_service& io_service_;    
+    /// extra io_services when sharded, io_service_ (acceptors, idle handlers) is shard 0
+    std::vector<std::unique_ptr<worker>> m_shards;
+    std::atomic<size_t> m_next_shard;
 
     /// Acceptor used to listen for incoming connections.
     boost::asio::ip::tcp::acceptor acceptor_;
@@ -101,10 +101,12 @@ PRAGMA_WARNING_DISABLE_VS(4355)
 		connection_basic(std::move(sock), state, ssl_support),
 		m_protocol_handler(this, check_and_get(state), context),
 		buffer_ssl_init_fill(0),
+		m_send_que_in_flight(0),
 		m_connection_type( connection_type ),
 		m_throttle_speed_in("speed_in", "throttle_speed_in"),
 		m_throttle_speed_out("speed_out", "throttle_speed_out"),
 		m_timer(GET_IO_SERVICE(socket_)),
+		m_send_pace_timer(GET_IO_SERVICE(socket_)),
 		m_local(false),
 		m_ready_to_close(false)
   {
@@ -346,29 +348,12 @@ PRAGMA_WARNING_DISABLE_VS(4355)
         context.m_current_speed_down = current_speed_down;
         context.m_max_speed_down = std::max(context.m_max_speed_down, current_speed_down);
     
-    {
-			CRITICAL_REGION_LOCAL(	epee::net_utils::network_throttle_manager::network_throttle_manager::m_lock_get_global_throttle_in );
-			epee::net_utils::network_throttle_manager::network_throttle_manager::get_global_throttle_in().handle_trafic_exact(bytes_transferred);
-		}
-
-		double delay=0; // will be calculated - how much we should sleep to obey speed limit etc
-
-
-		if (speed_limit_is_enabled()) {
-			do // keep sleeping if we should sleep
-			{
-				{ //_scope_dbg1("CRITICAL_REGION_LOCAL");
-					CRITICAL_REGION_LOCAL(	epee::net_utils::network_throttle_manager::m_lock_get_global_throttle_in );
-					delay = epee::net_utils::network_throttle_manager::get_global_throttle_in().get_sleep_time_after_tick( bytes_transferred );
-				}
-				
-				delay *= 0.5;
-				long int ms = (long int)(delay * 100);
-				if (ms > 0) {
-					reset_timer(boost::posix_time::milliseconds(ms + 1), true);
-					boost::this_thread::sleep_for(boost::chrono::milliseconds(ms));
-				}
-			} while(delay > 0);
+		// the global bucket counts all incoming traffic, but only paces it when limiting
+		const std::chrono::nanoseconds delay = epee::net_utils::network_throttle_manager::get_global_bucket_in().consume(bytes_transferred);
+		if (speed_limit_is_enabled() && delay.count() > 0) {
+			const long int ms = std::chrono::duration_cast<std::chrono::milliseconds>(delay).count();
+			reset_timer(boost::posix_time::milliseconds(ms + 1), true);
+			epee::net_utils::sleep_for(delay);
 		} // any form of sleeping
 		
       //_info("[sock " << socket().native_handle() << "] RECV " << bytes_transferred);
@@ -662,8 +647,9 @@ PRAGMA_WARNING_DISABLE_VS(4355)
 
     m_send_que.push_back(std::move(chunk));
 
-    if(m_send_que.size() > 1)
+    if(m_send_que_in_flight)
     { // active operation should be in progress, nothing to do, just wait last operation callback
+      // the chunk goes out together with whatever else is queued by then
         auto size_now = m_send_que.back().size();
         MDEBUG("do_send_chunk() NOW just queues: packet="<<size_now<<" B, is added to queue-size="<<m_send_que.size());
         //do_send_handler_delayed( ptr , size_now ); // (((H))) // empty function
@@ -684,13 +670,7 @@ PRAGMA_WARNING_DISABLE_VS(4355)
         if (speed_limit_is_enabled())
 			do_send_handler_write( m_send_que.back().data(), m_send_que.back().size() ); // (((H)))
 
-        CHECK_AND_ASSERT_MES( size_now == m_send_que.front().size(), false, "Unexpected queue size");
-        reset_timer(get_default_timeout(), false);
-            async_write(boost::asio::buffer(m_send_que.front().data(), size_now ) ,
-                                 strand_.wrap(
-                                 boost::bind(&connection<t_protocol_handler>::handle_write, self, _1, _2)
-                                 )
-                                 );
+        start_write();
         //_dbg3("(chunk): " << size_now);
         //logger_handle_net_write(size_now);
         //_info("[sock " << socket().native_handle() << "] Async send requested " << m_send_que.front().size());
@@ -704,6 +684,34 @@ PRAGMA_WARNING_DISABLE_VS(4355)
   } // do_send_chunk
   //---------------------------------------------------------------------------------
   template<class t_protocol_handler>
+  void connection<t_protocol_handler>::start_write()
+  {
+    // gather as much of the queue as fits the budget into one write, so a
+    // burst of small notifications costs one syscall instead of one each
+    std::vector<boost::asio::const_buffer> buffers;
+    buffers.reserve(std::min<size_t>(m_send_que.size(), ABSTRACT_SERVER_SEND_COALESCE_MAX_COUNT));
+    size_t total = 0;
+    for (const byte_slice &chunk: m_send_que)
+    {
+      if (buffers.size() >= ABSTRACT_SERVER_SEND_COALESCE_MAX_COUNT)
+        break;
+      if (!buffers.empty() && total + chunk.size() > ABSTRACT_SERVER_SEND_COALESCE_MAX_BYTES)
+        break;
+      buffers.emplace_back(chunk.data(), chunk.size());
+      total += chunk.size();
+    }
+    m_send_que_in_flight = buffers.size();
+    LOG_TRACE_CC(context, "[sock " << socket().native_handle() << "] Async write of " << total << " B in " << m_send_que_in_flight << " chunks");
+
+    reset_timer(get_default_timeout(), false);
+    async_write(buffers,
+      strand_.wrap(
+        boost::bind(&connection<t_protocol_handler>::handle_write, connection<t_protocol_handler>::shared_from_this(), _1, _2)
+      )
+    );
+  }
+  //---------------------------------------------------------------------------------
+  template<class t_protocol_handler>
   boost::posix_time::milliseconds connection<t_protocol_handler>::get_default_timeout()
   {
     unsigned count;
@@ -791,6 +799,7 @@ PRAGMA_WARNING_DISABLE_VS(4355)
     m_was_shutdown = true;
     // Initiate graceful connection closure.
     m_timer.cancel();
+    m_send_pace_timer.cancel();
     boost::system::error_code ignored_ec;
     if (m_ssl_support == epee::net_utils::ssl_support_t::e_ssl_support_enabled)
     {
@@ -865,7 +874,30 @@ PRAGMA_WARNING_DISABLE_VS(4355)
 		if (speed_limit_is_enabled()) {
 			sleep_before_packet(cb, 1, 1);
 		}
+		else if (m_connection_type == e_connection_type_RPC) {
+			// RPC is exempt from the global limits, but has its own (unlimited by default) budget.
+			// The write only completes once that allows, on a timer so no worker is held meanwhile;
+			// anything sent until then just queues, as m_send_que_in_flight is still set
+			const std::chrono::nanoseconds delay = network_throttle_manager::get_class_bucket(traffic_class::rpc).consume(cb);
+			if (delay.count() > 0) {
+				auto self = connection<t_protocol_handler>::shared_from_this();
+				m_send_pace_timer.expires_from_now(delay);
+				m_send_pace_timer.async_wait(strand_.wrap([self](const boost::system::error_code& ec) {
+					if (ec != boost::asio::error::operation_aborted)
+						self->finish_write();
+				}));
+				return;
+			}
+		}
 
+    finish_write();
+    CATCH_ENTRY_L0("connection<t_protocol_handler>::handle_write", void());
+  }
+  //---------------------------------------------------------------------------------
+  template<class t_protocol_handler>
+  void connection<t_protocol_handler>::finish_write()
+  {
+    TRY_ENTRY();
     bool do_shutdown = false;
     CRITICAL_REGION_BEGIN(m_send_que_lock);
     if(m_send_que.empty())
@@ -874,7 +906,14 @@ PRAGMA_WARNING_DISABLE_VS(4355)
       return;
     }
 
-    m_send_que.pop_front();
+    if(m_send_que_in_flight > m_send_que.size())
+    {
+      _erro("[sock " << socket().native_handle() << "] more chunks written than queued at handle_write!");
+      return;
+    }
+    // the throttle in handle_write already accounted for all of cb, the whole batch
+    m_send_que.erase(m_send_que.begin(), m_send_que.begin() + m_send_que_in_flight);
+    m_send_que_in_flight = 0;
     if(m_send_que.empty())
     {
       if(boost::interprocess::ipcdetail::atomic_read32(&m_want_close_connection))
@@ -884,17 +923,11 @@ PRAGMA_WARNING_DISABLE_VS(4355)
     }else
     {
       //have more data to send
-		reset_timer(get_default_timeout(), false);
 		auto size_now = m_send_que.front().size();
 		MDEBUG("handle_write() NOW SENDS: packet="<<size_now<<" B" <<", from  queue size="<<m_send_que.size());
 		if (speed_limit_is_enabled())
-			do_send_handler_write_from_queue(e, m_send_que.front().size() , m_send_que.size()); // (((H)))
-		CHECK_AND_ASSERT_MES( size_now == m_send_que.front().size(), void(), "Unexpected queue size");
-		  async_write(boost::asio::buffer(m_send_que.front().data(), size_now) , 
-           strand_.wrap(
-            boost::bind(&connection<t_protocol_handler>::handle_write, connection<t_protocol_handler>::shared_from_this(), _1, _2)
-			  )
-          );
+			do_send_handler_write_from_queue(boost::system::error_code(), m_send_que.front().size() , m_send_que.size()); // (((H)))
+		start_write();
       //_dbg3("(normal)" << size_now);
     }
     CRITICAL_REGION_END();
@@ -903,7 +936,7 @@ PRAGMA_WARNING_DISABLE_VS(4355)
     {
       shutdown();
     }
-    CATCH_ENTRY_L0("connection<t_protocol_handler>::handle_write", void());
+    CATCH_ENTRY_L0("connection<t_protocol_handler>::finish_write", void());
   }
 
   //---------------------------------------------------------------------------------
@@ -929,6 +962,7 @@ PRAGMA_WARNING_DISABLE_VS(4355)
     m_state(std::make_shared<typename connection<t_protocol_handler>::shared_state>()),
     m_io_service_local_instance(new worker()),
     io_service_(m_io_service_local_instance->io_service),
+    m_next_shard(0),
     acceptor_(io_service_),
     acceptor_ipv6(io_service_),
     default_remote(),
@@ -947,6 +981,7 @@ PRAGMA_WARNING_DISABLE_VS(4355)
   boosted_tcp_server<t_protocol_handler>::boosted_tcp_server(boost::asio::io_service& extarnal_io_service, t_connection_type connection_type) :
     m_state(std::make_shared<typename connection<t_protocol_handler>::shared_state>()),
     io_service_(extarnal_io_service),
+    m_next_shard(0),
     acceptor_(io_service_),
     acceptor_ipv6(io_service_),
     default_remote(),
@@ -1009,7 +1044,7 @@ PRAGMA_WARNING_DISABLE_VS(4355)
       boost::asio::ip::tcp::endpoint binded_endpoint = acceptor_.local_endpoint();
       m_port = binded_endpoint.port();
       MDEBUG("start accept (IPv4)");
-      new_connection_.reset(new connection<t_protocol_handler>(io_service_, m_state, m_connection_type, m_state->ssl_options().support));
+      new_connection_.reset(new connection<t_protocol_handler>(get_shard_io_service(), m_state, m_connection_type, m_state->ssl_options().support));
       acceptor_.async_accept(new_connection_->socket(),
 	boost::bind(&boosted_tcp_server<t_protocol_handler>::handle_accept_ipv4, this,
 	boost::asio::placeholders::error));
@@ -1046,7 +1081,7 @@ PRAGMA_WARNING_DISABLE_VS(4355)
         boost::asio::ip::tcp::endpoint binded_endpoint = acceptor_ipv6.local_endpoint();
         m_port_ipv6 = binded_endpoint.port();
         MDEBUG("start accept (IPv6)");
-        new_connection_ipv6.reset(new connection<t_protocol_handler>(io_service_, m_state, m_connection_type, m_state->ssl_options().support));
+        new_connection_ipv6.reset(new connection<t_protocol_handler>(get_shard_io_service(), m_state, m_connection_type, m_state->ssl_options().support));
         acceptor_ipv6.async_accept(new_connection_ipv6->socket(),
             boost::bind(&boosted_tcp_server<t_protocol_handler>::handle_accept_ipv6, this,
               boost::asio::placeholders::error));
@@ -1104,7 +1139,7 @@ DISABLE_GCC_WARNING(maybe-uninitialized)
 POP_WARNINGS
   //---------------------------------------------------------------------------------
   template<class t_protocol_handler>
-  bool boosted_tcp_server<t_protocol_handler>::worker_thread()
+  bool boosted_tcp_server<t_protocol_handler>::worker_thread(size_t shard)
   {
     TRY_ENTRY();
     uint32_t local_thr_index = boost::interprocess::ipcdetail::atomic_inc32(&m_thread_index); 
@@ -1116,7 +1151,10 @@ POP_WARNINGS
     {
       try
       {
-        io_service_.run();
+        if (shard)
+          m_shards[shard - 1]->io_service.run();
+        else
+          io_service_.run();
         return true;
       }
       catch(const std::exception& ex)
@@ -1151,9 +1189,45 @@ POP_WARNINGS
   }
   //---------------------------------------------------------------------------------
   template<class t_protocol_handler>
+  bool boosted_tcp_server<t_protocol_handler>::set_io_shards(size_t count)
+  {
+    CHECK_AND_ASSERT_MES(count > 0, false, "At least one io_service shard is needed");
+    CHECK_AND_ASSERT_MES(m_io_service_local_instance || count == 1, false, "Cannot shard a server running on an external io_service");
+    CHECK_AND_ASSERT_MES(!new_connection_ && !new_connection_ipv6, false, "io_service shards must be set before init_server");
+    m_shards.clear();
+    for (size_t i = 1; i < count; ++i)
+      m_shards.emplace_back(new worker());
+    return true;
+  }
+  //---------------------------------------------------------------------------------
+  template<class t_protocol_handler>
+  boost::asio::io_service& boosted_tcp_server<t_protocol_handler>::get_shard_io_service()
+  {
+    if (m_shards.empty())
+      return io_service_;
+    const size_t shard = m_next_shard.fetch_add(1, std::memory_order_relaxed) % (m_shards.size() + 1);
+    return shard ? m_shards[shard - 1]->io_service : io_service_;
+  }
+  //---------------------------------------------------------------------------------
+  template<class t_protocol_handler>
+  bool boosted_tcp_server<t_protocol_handler>::is_shard_io_service(const boost::asio::io_service& io_service) const
+  {
+    if (std::addressof(io_service) == std::addressof(io_service_))
+      return true;
+    for (const auto &shard: m_shards)
+      if (std::addressof(io_service) == std::addressof(shard->io_service))
+        return true;
+    return false;
+  }
+  //---------------------------------------------------------------------------------
+  template<class t_protocol_handler>
   bool boosted_tcp_server<t_protocol_handler>::run_server(size_t threads_count, bool wait, const boost::thread::attributes& attrs)
   {
     TRY_ENTRY();
+    // every shard gets the same number of threads
+    const size_t shards_count = get_io_shards_count();
+    if (shards_count > 1)
+      threads_count = std::max<size_t>((threads_count + shards_count - 1) / shards_count, 1) * shards_count;
     m_threads_count = threads_count;
     m_main_thread_id = boost::this_thread::get_id();
     MLOG_SET_THREAD_NAME("[SRV_MAIN]");
@@ -1165,7 +1239,7 @@ POP_WARNINGS
       for (std::size_t i = 0; i < threads_count; ++i)
       {
         boost::shared_ptr<boost::thread> thread(new boost::thread(
-          attrs, boost::bind(&boosted_tcp_server<t_protocol_handler>::worker_thread, this)));
+          attrs, boost::bind(&boosted_tcp_server<t_protocol_handler>::worker_thread, this, i % shards_count)));
           _note("Run server thread name: " << m_thread_name_prefix);
         m_threads.push_back(thread);
       }
@@ -1253,6 +1327,8 @@ POP_WARNINGS
     connections_.clear();
     connections_mutex.unlock();
     io_service_.stop();
+    for (auto &shard: m_shards)
+      shard->io_service.stop();
     CATCH_ENTRY_L0("boosted_tcp_server<t_protocol_handler>::send_stop_signal()", void());
   }
   //---------------------------------------------------------------------------------
@@ -1299,7 +1375,7 @@ POP_WARNINGS
         (*current_new_connection)->setRpcStation(); // hopefully this is not needed actually
       }
       connection_ptr conn(std::move((*current_new_connection)));
-      (*current_new_connection).reset(new connection<t_protocol_handler>(io_service_, m_state, m_connection_type, conn->get_ssl_support()));
+      (*current_new_connection).reset(new connection<t_protocol_handler>(get_shard_io_service(), m_state, m_connection_type, conn->get_ssl_support()));
       current_acceptor->async_accept((*current_new_connection)->socket(),
           boost::bind(accept_function_pointer, this,
             boost::asio::placeholders::error));
@@ -1308,10 +1384,11 @@ POP_WARNINGS
       conn->socket().set_option(opt);
 
       bool res;
+      const bool is_multithreaded = get_io_shards_count() < m_threads_count;
       if (default_remote.get_type_id() == net_utils::address_type::invalid)
-        res = conn->start(true, 1 < m_threads_count);
+        res = conn->start(true, is_multithreaded);
       else
-        res = conn->start(true, 1 < m_threads_count, default_remote);
+        res = conn->start(true, is_multithreaded, default_remote);
       if (!res)
       {
         conn->cancel();
@@ -1334,7 +1411,7 @@ POP_WARNINGS
     assert(m_state != nullptr); // always set in constructor
     _erro("Some problems at accept: " << e.message() << ", connections_count = " << m_state->sock_count);
     misc_utils::sleep_no_w(100);
-    (*current_new_connection).reset(new connection<t_protocol_handler>(io_service_, m_state, m_connection_type, (*current_new_connection)->get_ssl_support()));
+    (*current_new_connection).reset(new connection<t_protocol_handler>(get_shard_io_service(), m_state, m_connection_type, (*current_new_connection)->get_ssl_support()));
     current_acceptor->async_accept((*current_new_connection)->socket(),
         boost::bind(accept_function_pointer, this,
           boost::asio::placeholders::error));
@@ -1343,10 +1420,10 @@ POP_WARNINGS
   template<class t_protocol_handler>
   bool boosted_tcp_server<t_protocol_handler>::add_connection(t_connection_context& out, boost::asio::ip::tcp::socket&& sock, network_address real_remote, epee::net_utils::ssl_support_t ssl_support)
   {
-    if(std::addressof(get_io_service()) == std::addressof(GET_IO_SERVICE(sock)))
+    if(is_shard_io_service(GET_IO_SERVICE(sock)))
     {
       connection_ptr conn(new connection<t_protocol_handler>(std::move(sock), m_state, m_connection_type, ssl_support));
-      if(conn->start(false, 1 < m_threads_count, std::move(real_remote)))
+      if(conn->start(false, get_io_shards_count() < m_threads_count, std::move(real_remote)))
       {
         conn->get_context(out);
         conn->save_dbg_log();
@@ -1463,7 +1540,7 @@ POP_WARNINGS
   {
     TRY_ENTRY();
 
-    connection_ptr new_connection_l(new connection<t_protocol_handler>(io_service_, m_state, m_connection_type, ssl_support) );
+    connection_ptr new_connection_l(new connection<t_protocol_handler>(get_shard_io_service(), m_state, m_connection_type, ssl_support) );
     connections_mutex.lock();
     connections_.insert(new_connection_l);
     MDEBUG("connections_ size now " << connections_.size());
@@ -1565,7 +1642,7 @@ POP_WARNINGS
     connections_mutex.lock();
     connections_.erase(new_connection_l);
     connections_mutex.unlock();
-    bool r = new_connection_l->start(false, 1 < m_threads_count);
+    bool r = new_connection_l->start(false, get_io_shards_count() < m_threads_count);
     if (r)
     {
       new_connection_l->get_context(conn_context);
@@ -1588,7 +1665,7 @@ POP_WARNINGS
   bool boosted_tcp_server<t_protocol_handler>::connect_async(const std::string& adr, const std::string& port, uint32_t conn_timeout, const t_callback &cb, const std::string& bind_ip, epee::net_utils::ssl_support_t ssl_support)
   {
     TRY_ENTRY();    
-    connection_ptr new_connection_l(new connection<t_protocol_handler>(io_service_, m_state, m_connection_type, ssl_support) );
+    connection_ptr new_connection_l(new connection<t_protocol_handler>(get_shard_io_service(), m_state, m_connection_type, ssl_support) );
     connections_mutex.lock();
     connections_.insert(new_connection_l);
     MDEBUG("connections_ size now " << connections_.size());
@@ -1666,7 +1743,7 @@ POP_WARNINGS
       }
     }
     
-    boost::shared_ptr<boost::asio::deadline_timer> sh_deadline(new boost::asio::deadline_timer(io_service_));
+    boost::shared_ptr<boost::asio::deadline_timer> sh_deadline(new boost::asio::deadline_timer(GET_IO_SERVICE(sock_)));
     //start deadline
     sh_deadline->expires_from_now(boost::posix_time::milliseconds(conn_timeout));
     sh_deadline->async_wait([=](const boost::system::error_code& error)
@@ -1697,7 +1774,7 @@ POP_WARNINGS
             connections_mutex.lock();
             connections_.erase(new_connection_l);
             connections_mutex.unlock();
-            bool r = new_connection_l->start(false, 1 < m_threads_count);
+            bool r = new_connection_l->start(false, get_io_shards_count() < m_threads_count);
             if (r)
             {
               new_connection_l->get_context(conn_context);
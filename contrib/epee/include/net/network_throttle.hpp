@@ -65,6 +65,7 @@
 #include <boost/date_time/posix_time/posix_time.hpp>
 #include <boost/thread/thread.hpp> 
 #include "misc_language.h"
+#include "net/token_bucket.h"
 #include "pragma_comp_defs.h"
 #include <sstream>
 #include <iomanip>
@@ -122,6 +123,10 @@ class network_throttle_manager {
 		static i_network_throttle & get_global_throttle_in(); ///< singleton ; for friend class ; caller MUST use proper locks! like m_lock_get_global_throttle_in
 		static i_network_throttle & get_global_throttle_inreq(); ///< ditto ; use lock ... use m_lock_get_global_throttle_inreq obviously
 		static i_network_throttle & get_global_throttle_out(); ///< ditto ; use lock ... use m_lock_get_global_throttle_out obviously
+
+		static token_bucket & get_global_bucket_in(); ///< enforces the global download limit ; lock free
+		static token_bucket & get_global_bucket_out(); ///< enforces the global upload limit ; lock free
+		static token_bucket & get_class_bucket(traffic_class cls); ///< per traffic class budget, unlimited unless set ; lock free
 };
 
 
@@ -0,0 +1,87 @@
+// Copyright (c) 2020, The Monero Project
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are
+// permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of
+//    conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list
+//    of conditions and the following disclaimer in the documentation and/or other
+//    materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be
+//    used to endorse or promote products derived from this software without specific
+//    prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL
+// THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace epee
+{
+namespace net_utils
+{
+  //! Traffic with its own budget, on top of the global in/out limits
+  enum class traffic_class : std::uint8_t
+  {
+    block_sync = 0, //!< blocks served to syncing peers
+    tx_relay,       //!< tx broadcasts
+    rpc,            //!< RPC responses
+    count
+  };
+
+  /*! Lock free token bucket, as a GCRA (virtual scheduling) over a single
+      "theoretical arrival time". Traffic is always counted, and the caller is
+      told how long to wait so that the long term rate stays under the budget
+      while bursts of up to `burst` worth of traffic go through at once. A rate
+      of 0 means no limit, and then only the counters are kept. */
+  class token_bucket
+  {
+    std::atomic<std::uint64_t> m_rate;    //!< bytes per second
+    std::atomic<std::uint64_t> m_tat;     //!< ns on the steady clock
+    const std::uint64_t m_burst;          //!< ns
+    std::atomic<std::uint64_t> m_bytes;
+    std::atomic<std::uint64_t> m_packets;
+    std::atomic<std::uint64_t> m_delay;   //!< total ns callers were told to wait
+
+  public:
+    explicit token_bucket(std::uint64_t bytes_per_second = 0, std::chrono::milliseconds burst = std::chrono::seconds{1}) noexcept;
+
+    token_bucket(const token_bucket&) = delete;
+    token_bucket& operator=(const token_bucket&) = delete;
+
+    void set_rate(std::uint64_t bytes_per_second) noexcept;
+    std::uint64_t get_rate() const noexcept { return m_rate.load(std::memory_order_relaxed); }
+
+    //! Counts `bytes` against the budget, \return how long to wait before sending them
+    std::chrono::nanoseconds consume(std::size_t bytes) noexcept;
+
+    std::uint64_t get_total_bytes() const noexcept { return m_bytes.load(std::memory_order_relaxed); }
+    std::uint64_t get_total_packets() const noexcept { return m_packets.load(std::memory_order_relaxed); }
+    std::chrono::nanoseconds get_total_delay() const noexcept { return std::chrono::nanoseconds{m_delay.load(std::memory_order_relaxed)}; }
+
+    /*! Same scheduling for state owned by a single thread (eg per-peer
+        shares kept in a connection context), \return the wait */
+    static std::chrono::nanoseconds consume(std::uint64_t& tat, std::uint64_t bytes_per_second, std::size_t bytes, std::chrono::nanoseconds burst) noexcept;
+  };
+
+  //! Sleeps for `delay`, if any
+  void sleep_for(std::chrono::nanoseconds delay);
+} // net_utils
+} // epee
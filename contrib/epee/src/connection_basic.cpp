@@ -185,42 +185,21 @@ connection_basic::~connection_basic() noexcept(false) {
 }
 
 void connection_basic::set_rate_up_limit(uint64_t limit) {
-	{
-		CRITICAL_REGION_LOCAL(	network_throttle_manager::m_lock_get_global_throttle_out );
-		network_throttle_manager::get_global_throttle_out().set_target_speed(limit);
-	}
+	network_throttle_manager::get_global_bucket_out().set_rate(limit * 1024);
 	save_limit_to_file(limit);
 }
 
 void connection_basic::set_rate_down_limit(uint64_t limit) {
-	{
-	  CRITICAL_REGION_LOCAL(	network_throttle_manager::m_lock_get_global_throttle_in );
-		network_throttle_manager::get_global_throttle_in().set_target_speed(limit);
-	}
-
-	{
-	  CRITICAL_REGION_LOCAL(	network_throttle_manager::m_lock_get_global_throttle_inreq );
-		network_throttle_manager::get_global_throttle_inreq().set_target_speed(limit);
-	}
+	network_throttle_manager::get_global_bucket_in().set_rate(limit * 1024);
     save_limit_to_file(limit);
 }
 
 uint64_t connection_basic::get_rate_up_limit() {
-    uint64_t limit;
-    {
-         CRITICAL_REGION_LOCAL( network_throttle_manager::m_lock_get_global_throttle_out );
-         limit = network_throttle_manager::get_global_throttle_out().get_target_speed();
-	}
-    return limit;
+    return network_throttle_manager::get_global_bucket_out().get_rate() / 1024;
 }
 
 uint64_t connection_basic::get_rate_down_limit() {
-    uint64_t limit;
-    {
-         CRITICAL_REGION_LOCAL( network_throttle_manager::m_lock_get_global_throttle_in );
-         limit = network_throttle_manager::get_global_throttle_in().get_target_speed();
-	}
-    return limit;
+    return network_throttle_manager::get_global_bucket_in().get_rate() / 1024;
 }
 
 void connection_basic::save_limit_to_file(int limit) {
@@ -235,33 +214,16 @@ int connection_basic::get_tos_flag() {
 }
 
 void connection_basic::sleep_before_packet(size_t packet_size, int phase,  int q_len) {
-	double delay=0; // will be calculated
-	do
-	{ // rate limiting
-		if (m_was_shutdown) { 
-			_dbg2("m_was_shutdown - so abort sleep");
-			return;
-		}
-
-		{ 
-			CRITICAL_REGION_LOCAL(	network_throttle_manager::m_lock_get_global_throttle_out );
-			delay = network_throttle_manager::get_global_throttle_out().get_sleep_time_after_tick( packet_size );
-		}
-
-		delay *= 0.50;
-		if (delay > 0) {
-            long int ms = (long int)(delay * 1000);
-			MTRACE("Sleeping in " << __FUNCTION__ << " for " << ms << " ms before packet_size="<<packet_size); // debug sleep
-			boost::this_thread::sleep(boost::posix_time::milliseconds( ms ) );
-		}
-	} while(delay > 0);
-
-// XXX LATER XXX
-	{
-	  CRITICAL_REGION_LOCAL(	network_throttle_manager::m_lock_get_global_throttle_out );
-		network_throttle_manager::get_global_throttle_out().handle_trafic_exact( packet_size ); // increase counter - global
+	// rate limiting ; the bucket counts the packet and tells how far over the budget we are
+	const std::chrono::nanoseconds delay = network_throttle_manager::get_global_bucket_out().consume( packet_size );
+	if (delay.count() <= 0)
+		return;
+	if (m_was_shutdown) {
+		_dbg2("m_was_shutdown - so abort sleep");
+		return;
 	}
-
+	MTRACE("Sleeping in " << __FUNCTION__ << " for " << std::chrono::duration_cast<std::chrono::milliseconds>(delay).count() << " ms before packet_size="<<packet_size); // debug sleep
+	sleep_for(delay);
 }
 
 void connection_basic::do_send_handler_write(const void* ptr , size_t cb ) {
@@ -281,9 +243,8 @@ void connection_basic::logger_handle_net_write(size_t size) {
 }
 
 double connection_basic::get_sleep_time(size_t cb) {
-	CRITICAL_REGION_LOCAL(epee::net_utils::network_throttle_manager::network_throttle_manager::m_lock_get_global_throttle_out);
-    auto t = network_throttle_manager::get_global_throttle_out().get_sleep_time(cb);
-    return t;
+	const auto rate = network_throttle_manager::get_global_bucket_out().get_rate();
+	return rate ? double(cb) / rate : 0;
 }
 
 
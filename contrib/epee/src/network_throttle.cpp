@@ -92,6 +92,25 @@ i_network_throttle & network_throttle_manager::get_global_throttle_out() {
 }
 
 
+token_bucket & network_throttle_manager::get_global_bucket_in() {
+	static token_bucket obj_get_global_bucket_in;
+	return obj_get_global_bucket_in;
+}
+
+
+token_bucket & network_throttle_manager::get_global_bucket_out() {
+	static token_bucket obj_get_global_bucket_out;
+	return obj_get_global_bucket_out;
+}
+
+
+token_bucket & network_throttle_manager::get_class_bucket(traffic_class cls) {
+	static token_bucket obj_get_class_bucket[static_cast<std::size_t>(traffic_class::count)];
+	const std::size_t index = std::min(static_cast<std::size_t>(cls), static_cast<std::size_t>(traffic_class::count) - 1);
+	return obj_get_class_bucket[index];
+}
+
+
 
 
 network_throttle_bw::network_throttle_bw(const std::string &name1) 
@@ -0,0 +1,108 @@
+// Copyright (c) 2020, The Monero Project
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are
+// permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of
+//    conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list
+//    of conditions and the following disclaimer in the documentation and/or other
+//    materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be
+//    used to endorse or promote products derived from this software without specific
+//    prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL
+// THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "net/token_bucket.h"
+
+#include <algorithm>
+#include <boost/thread/thread.hpp>
+
+namespace epee
+{
+namespace net_utils
+{
+  namespace
+  {
+    std::uint64_t now_ns() noexcept
+    {
+      return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    std::uint64_t cost_ns(std::size_t bytes, std::uint64_t bytes_per_second) noexcept
+    {
+      // bytes * 1e9 overflows past ~18 GB, which no single packet gets near
+      return static_cast<std::uint64_t>(bytes) * 1000000000ull / bytes_per_second;
+    }
+  }
+
+  token_bucket::token_bucket(const std::uint64_t bytes_per_second, const std::chrono::milliseconds burst) noexcept
+    : m_rate(bytes_per_second),
+      m_tat(0),
+      m_burst(std::chrono::duration_cast<std::chrono::nanoseconds>(burst).count()),
+      m_bytes(0),
+      m_packets(0),
+      m_delay(0)
+  {}
+
+  void token_bucket::set_rate(const std::uint64_t bytes_per_second) noexcept
+  {
+    m_rate.store(bytes_per_second, std::memory_order_relaxed);
+    m_tat.store(0, std::memory_order_relaxed); // forget debt accrued at the old rate
+  }
+
+  std::chrono::nanoseconds token_bucket::consume(const std::size_t bytes) noexcept
+  {
+    m_bytes.fetch_add(bytes, std::memory_order_relaxed);
+    m_packets.fetch_add(1, std::memory_order_relaxed);
+
+    const std::uint64_t rate = m_rate.load(std::memory_order_relaxed);
+    if (!rate)
+      return std::chrono::nanoseconds{0};
+
+    const std::uint64_t now = now_ns();
+    const std::uint64_t cost = cost_ns(bytes, rate);
+    std::uint64_t tat = m_tat.load(std::memory_order_relaxed);
+    std::uint64_t next;
+    do
+    {
+      next = std::max(tat, now) + cost;
+    } while (!m_tat.compare_exchange_weak(tat, next, std::memory_order_relaxed));
+
+    if (next <= now + m_burst)
+      return std::chrono::nanoseconds{0};
+    const std::uint64_t delay = next - now - m_burst;
+    m_delay.fetch_add(delay, std::memory_order_relaxed);
+    return std::chrono::nanoseconds{delay};
+  }
+
+  std::chrono::nanoseconds token_bucket::consume(std::uint64_t& tat, const std::uint64_t bytes_per_second, const std::size_t bytes, const std::chrono::nanoseconds burst) noexcept
+  {
+    if (!bytes_per_second)
+      return std::chrono::nanoseconds{0};
+    const std::uint64_t now = now_ns();
+    tat = std::max(tat, now) + cost_ns(bytes, bytes_per_second);
+    const std::uint64_t allowed = now + burst.count();
+    return std::chrono::nanoseconds{tat <= allowed ? 0 : tat - allowed};
+  }
+
+  void sleep_for(const std::chrono::nanoseconds delay)
+  {
+    if (delay.count() > 0)
+      boost::this_thread::sleep_for(boost::chrono::nanoseconds{delay.count()});
+  }
+} // net_utils
+} // epee
@@ -46,6 +46,12 @@ public:
     static threadpool instance;
     return instance;
   }
+  // For background work: waiting on the global pool runs its queued tasks,
+  // which must not pick up these
+  static threadpool& getInstanceForBackground() {
+    static threadpool instance;
+    return instance;
+  }
   static threadpool *getNewForUnitTests(unsigned max_threads = 0) {
     return new threadpool(max_threads);
   }
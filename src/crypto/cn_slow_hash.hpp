@@ -128,6 +128,11 @@ private:
 	void* base_ptr;
 };
 
+// Scratchpads are backed by huge pages where the OS can provide them, which cuts the
+// TLB misses of the random accesses; huge_pages tells cn_free_scratchpad how it was allocated
+void* cn_alloc_scratchpad(size_t size, bool& huge_pages);
+void cn_free_scratchpad(void* ptr, size_t size, bool huge_pages);
+
 template<size_t MEMORY, size_t ITER, size_t VERSION> class cn_slow_hash;
 using cn_pow_hash_v1 = cn_slow_hash<2*1024*1024, 0x80000, 0>;
 using cn_pow_hash_v2 = cn_slow_hash<4*1024*1024, 0x40000, 1>;
@@ -138,13 +143,13 @@ template<size_t MEMORY, size_t ITER, size_t VERSION>
 class cn_slow_hash
 {
 public:
-	cn_slow_hash() : borrowed_pad(false)
+	cn_slow_hash() : borrowed_pad(false), huge_pad(false)
 	{
-		lpad.set(boost::alignment::aligned_alloc(4096, MEMORY));
+		lpad.set(cn_alloc_scratchpad(MEMORY, huge_pad));
 		spad.set(boost::alignment::aligned_alloc(4096, 4096));
 	}
 
-	cn_slow_hash (cn_slow_hash&& other) noexcept : lpad(other.lpad.as_byte()), spad(other.spad.as_byte()), borrowed_pad(other.borrowed_pad)
+	cn_slow_hash (cn_slow_hash&& other) noexcept : lpad(other.lpad.as_byte()), spad(other.spad.as_byte()), borrowed_pad(other.borrowed_pad), huge_pad(other.huge_pad)
 	{
 		other.lpad.set(nullptr);
 		other.spad.set(nullptr);
@@ -171,6 +176,9 @@ public:
 		lpad.set(other.lpad.as_void());
 		spad.set(other.spad.as_void());
 		borrowed_pad = other.borrowed_pad;
+		huge_pad = other.huge_pad;
+		other.lpad.set(nullptr);
+		other.spad.set(nullptr);
 		return *this;
 	}
 
@@ -191,12 +199,29 @@ public:
 			software_hash(in, len, out);
 	}
 
+	// Hashes N independent inputs on one core, lane i using the scratchpad of ctx[i].
+	// The main loops run in lockstep so the AES, multiply and division latencies of one
+	// lane are hidden behind the others. Output is identical to N calls to hash()
+	template<size_t N>
+	static void hash_multi(cn_slow_hash* const* ctx, const void* const* in, const size_t* len, void* const* out)
+	{
+		if(hw_check_aes() && !ctx[0]->check_override())
+			hardware_hash_multi<N>(ctx, in, len, out);
+		else
+			for(size_t i = 0; i < N; i++)
+				ctx[i]->software_hash(in[i], len[i], out[i]);
+	}
+
 	void software_hash(const void* in, size_t len, void* out);
 
 #if !defined(HAS_INTEL_HW) && !defined(HAS_ARM_HW)
 	inline void hardware_hash(const void* in, size_t len, void* out) { assert(false); }
+	template<size_t N>
+	static inline void hardware_hash_multi(cn_slow_hash* const* ctx, const void* const* in, const size_t* len, void* const* out) { assert(false); }
 #else
 	void hardware_hash(const void* in, size_t len, void* out);
+	template<size_t N>
+	static void hardware_hash_multi(cn_slow_hash* const* ctx, const void* const* in, const size_t* len, void* const* out);
 #endif
 
 private:
@@ -211,6 +236,7 @@ private:
 		lpad.set(lptr);
 		spad.set(sptr);
 		borrowed_pad = true;
+		huge_pad = false;
 	}
 
 	inline bool check_override()
@@ -232,8 +258,8 @@ private:
 		if(!borrowed_pad)
 		{
 			if(lpad.as_void() != nullptr)
-				boost::alignment::aligned_free(lpad.as_void());
-			if(lpad.as_void() != nullptr)
+				cn_free_scratchpad(lpad.as_void(), MEMORY, huge_pad);
+			if(spad.as_void() != nullptr)
 				boost::alignment::aligned_free(spad.as_void());
 		}
 
@@ -257,6 +283,7 @@ private:
 	cn_sptr lpad;
 	cn_sptr spad;
 	bool borrowed_pad;
+	bool huge_pad;
 };
 
 extern template class cn_slow_hash<2*1024*1024, 0x80000, 0>;
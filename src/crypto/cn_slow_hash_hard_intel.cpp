@@ -324,6 +324,29 @@ inline uint64_t xmm_extract_64(__m128i x)
 #endif
 }
 
+// Final keccak permutation of the state and the choice of one of the four finalist hashes
+inline void cn_final_hash(uint64_t* state, void* out)
+{
+	keccakf(state, 24);
+
+	const uint8_t* bstate = reinterpret_cast<const uint8_t*>(state);
+	switch(bstate[0] & 3)
+	{
+	case 0:
+		blake256_hash((uint8_t*)out, bstate, 200);
+		break;
+	case 1:
+		groestl(bstate, 200 * 8, (uint8_t*)out);
+		break;
+	case 2:
+		jh_hash(32 * 8, bstate, 8 * 200, (uint8_t*)out);
+		break;
+	case 3:
+		skein_hash(8 * 32, bstate, 8 * 200, (uint8_t*)out);
+		break;
+	}
+}
+
 template<size_t MEMORY, size_t ITER, size_t VERSION>
 void cn_slow_hash<MEMORY,ITER,VERSION>::hardware_hash(const void* in, size_t len, void* out)
 {
@@ -386,22 +409,81 @@ void cn_slow_hash<MEMORY,ITER,VERSION>::hardware_hash(const void* in, size_t len
 
 	implode_scratchpad_hard();
 
-	keccakf(spad.as_uqword(), 24);
+	cn_final_hash(spad.as_uqword(), out);
+}
+
+// Same as hardware_hash, with one iteration of the main loop run step by step across all
+// N lanes. The lanes never share data, so each step of one lane can issue while the
+// previous step of another is still waiting on its AES, multiply, division or cache miss
+template<size_t MEMORY, size_t ITER, size_t VERSION>
+template<size_t N>
+void cn_slow_hash<MEMORY,ITER,VERSION>::hardware_hash_multi(cn_slow_hash* const* ctx, const void* const* in, const size_t* len, void* const* out)
+{
+	uint64_t al[N], ah[N], idx[N];
+	__m128i bx[N], cx[N];
 
-	switch(spad.as_byte(0) & 3)
+	for(size_t j = 0; j < N; j++)
 	{
-	case 0:
-		blake256_hash((uint8_t*)out, spad.as_byte(), 200);
-		break;
-	case 1:
-		groestl(spad.as_byte(), 200 * 8, (uint8_t*)out);
-		break;
-	case 2:
-		jh_hash(32 * 8, spad.as_byte(), 8 * 200, (uint8_t*)out);
-		break;
-	case 3:
-		skein_hash(8 * 32, spad.as_byte(), 8 * 200, (uint8_t*)out);
-		break;
+		keccak((const uint8_t *)in[j], len[j], ctx[j]->spad.as_byte(), 200);
+
+		ctx[j]->explode_scratchpad_hard();
+
+		uint64_t* h = ctx[j]->spad.as_uqword();
+
+		al[j] = h[0] ^ h[4];
+		ah[j] = h[1] ^ h[5];
+		bx[j] = _mm_set_epi64x(h[3] ^ h[7], h[2] ^ h[6]);
+		idx[j] = h[0] ^ h[4];
+	}
+
+	for(size_t i = 0; i < ITER; i++)
+	{
+		for(size_t j = 0; j < N; j++)
+			cx[j] = _mm_load_si128(ctx[j]->scratchpad_ptr(idx[j]).as_xmm());
+
+		for(size_t j = 0; j < N; j++)
+		{
+			cx[j] = _mm_aesenc_si128(cx[j], _mm_set_epi64x(ah[j], al[j]));
+			_mm_store_si128(ctx[j]->scratchpad_ptr(idx[j]).as_xmm(), _mm_xor_si128(bx[j], cx[j]));
+			idx[j] = xmm_extract_64(cx[j]);
+			bx[j] = cx[j];
+		}
+
+		for(size_t j = 0; j < N; j++)
+		{
+			uint64_t hi, lo, cl, ch;
+			cl = ctx[j]->scratchpad_ptr(idx[j]).as_uqword(0);
+			ch = ctx[j]->scratchpad_ptr(idx[j]).as_uqword(1);
+
+			lo = _umul128(idx[j], cl, &hi);
+
+			al[j] += hi;
+			ah[j] += lo;
+			ctx[j]->scratchpad_ptr(idx[j]).as_uqword(0) = al[j];
+			ctx[j]->scratchpad_ptr(idx[j]).as_uqword(1) = ah[j];
+			ah[j] ^= ch;
+			al[j] ^= cl;
+			idx[j] = al[j];
+		}
+
+		for(size_t j = 0; VERSION > 0 && j < N; j++)
+		{
+			int64_t n  = ctx[j]->scratchpad_ptr(idx[j]).as_qword(0);
+			int32_t d  = ctx[j]->scratchpad_ptr(idx[j]).as_dword(2);
+			int64_t q = n / (d | 5);
+			ctx[j]->scratchpad_ptr(idx[j]).as_qword(0) = n ^ q;
+			if (VERSION > 1)
+				idx[j] = (~d) ^ q;
+			else
+				idx[j] = d ^ q;
+		}
+	}
+
+	for(size_t j = 0; j < N; j++)
+	{
+		ctx[j]->implode_scratchpad_hard();
+
+		cn_final_hash(ctx[j]->spad.as_uqword(), out[j]);
 	}
 }
 
@@ -409,4 +491,11 @@ template class cn_slow_hash<2*1024*1024, 0x80000, 0>;
 template class cn_slow_hash<4*1024*1024, 0x40000, 1>;
 template class cn_slow_hash<4*1024*1024, 0x40000, 2>;
 
+template void cn_pow_hash_v1::hardware_hash_multi<2>(cn_pow_hash_v1* const*, const void* const*, const size_t*, void* const*);
+template void cn_pow_hash_v1::hardware_hash_multi<4>(cn_pow_hash_v1* const*, const void* const*, const size_t*, void* const*);
+template void cn_pow_hash_v2::hardware_hash_multi<2>(cn_pow_hash_v2* const*, const void* const*, const size_t*, void* const*);
+template void cn_pow_hash_v2::hardware_hash_multi<4>(cn_pow_hash_v2* const*, const void* const*, const size_t*, void* const*);
+template void cn_pow_hash_v3::hardware_hash_multi<2>(cn_pow_hash_v3* const*, const void* const*, const size_t*, void* const*);
+template void cn_pow_hash_v3::hardware_hash_multi<4>(cn_pow_hash_v3* const*, const void* const*, const size_t*, void* const*);
+
 #endif
@@ -30,6 +30,10 @@
 
 #include "cn_slow_hash.hpp"
 
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
 extern "C" {
 #include "keccak.h"
 }
@@ -577,6 +581,43 @@ void cn_slow_hash<MEMORY,ITER,VERSION>::software_hash(const void* in, size_t len
 	}
 }
 
+void* cn_alloc_scratchpad(size_t size, bool& huge_pages)
+{
+	huge_pages = false;
+#if defined(__linux__)
+#ifdef MAP_HUGETLB
+	// Reserved huge pages, only there if vm.nr_hugepages was set
+	void* ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+	if(ptr != MAP_FAILED)
+	{
+		huge_pages = true;
+		return ptr;
+	}
+#endif
+	// Transparent huge pages otherwise, which need the buffer aligned to one
+	void* thp = boost::alignment::aligned_alloc(2*1024*1024, size);
+#ifdef MADV_HUGEPAGE
+	if(thp != nullptr)
+		madvise(thp, size, MADV_HUGEPAGE);
+#endif
+	return thp;
+#else
+	return boost::alignment::aligned_alloc(4096, size);
+#endif
+}
+
+void cn_free_scratchpad(void* ptr, size_t size, bool huge_pages)
+{
+#if defined(__linux__)
+	if(huge_pages)
+	{
+		munmap(ptr, size);
+		return;
+	}
+#endif
+	boost::alignment::aligned_free(ptr);
+}
+
 template class cn_slow_hash<2*1024*1024, 0x80000, 0>;
 template class cn_slow_hash<4*1024*1024, 0x40000, 1>;
 template class cn_slow_hash<4*1024*1024, 0x40000, 2>;
@@ -863,6 +863,842 @@ const ge_precomp ge_Bi[8] = {
    {-3099351, 10324967, -2241613, 7453183, -5446979, -2735503, -13812022, -16236442, -32461234, -12290683}}
 };
 
+/* H_base[i][j] = (j+1)*256^i*H */
+const ge_precomp ge_H_base[32][8] = {
+  {
+    {{13188625, -10004566, -14376190, 77863, 22443371, -14636578, -16785304, 8167653, 20444070, -2711252},
+     {-1471227, -13356274, -10090267, -15151704, -33550331, -8242436, 5529966, -11630193, 19510173, 13261754},
+     {-12798939, -1457398, -17819983, -2201905, 9166819, -10039394, 19181274, -1806737, -26934676, 16447304}},
+    {{10817796, 9347262, -18635876, -16540655, -11814059, 12976934, 24396915, 5798861, 14650656, -16012026},
+     {-1817555, 13324679, 7064412, -7539420, -14728108, -9248818, -10928471, 6223586, 22850632, -7827988},
+     {-9370374, 16225006, 17224290, 16559680, -18258545, -11216887, 13000078, 10700769, 27355341, -10508300}},
+    {{12608737, -13878462, 27994404, 15780376, -16232981, 8432766, 31430220, 14679000, 32842221, 8713820},
+     {973852, 1440080, 6690924, -9688701, -27354535, -11902953, 12675264, 9076976, 29753465, 12581494},
+     {56008, -15893322, 31562333, 4998679, 28418032, -7004637, -2063917, -929957, -32051018, -16671052}},
+    {{-4675149, -6713315, 15429789, 15249219, 11868575, -10589916, -979360, -1308465, -12106186, -1644421},
+     {32810116, -13685895, -1416707, 6209324, 15560141, -2190831, -806176, 12803939, 8113542, -16296855},
+     {-31722194, -9165774, -27779825, 14060086, -22904672, 12717645, 10228234, -1772083, -22373245, 3610623}},
+    {{-22930479, 7410262, 24257048, -13894411, -27847878, -16641030, 7462437, -8973508, 32507765, -12147511},
+     {-19863079, -11660507, 4481271, 3522723, 6549035, 2982801, -2250212, 4001089, -1047773, -4626301},
+     {-9180851, -10573398, 21666385, -12925096, -13631790, 3718627, -26038060, -9973494, 19752585, 2326861}},
+    {{-25246831, -11238129, 27737487, 3915337, -30950532, -11482397, 18754529, -3273815, -15817044, -14641234},
+     {18374103, 1096572, -17549057, -3263120, -4310184, 15289108, 21310959, -9155306, -11089924, -10749879},
+     {27828776, -7958698, 26793223, -2474662, 8124597, 15437378, 33291018, 12370466, -28554232, 5088370}},
+    {{-25917578, 14386234, -5565927, -3308424, 27286956, 7880698, 29020761, -5648070, -1311838, 6227031},
+     {-24300674, 12092285, 30738727, -9432922, 5149063, 3125138, 15714761, -8874231, -17311847, -12091969},
+     {-32329589, -4716046, 732416, -7707198, 1698228, 11115729, -28776079, -13407661, 30556599, -2778567}},
+    {{-11546595, -283090, 30716429, -2322121, -23225681, 10917859, 22521393, 14331629, 33103740, -4230536},
+     {2319590, 2684828, 6622308, -6667120, -16831884, -2027021, 29075903, 2643338, 6120814, 968239},
+     {-30790517, -5371881, -26861125, -14967991, -5165738, 496822, 13611988, -11880794, 23492670, 2783777}}
+  },
+  {
+    {{-29150393, 13524438, -23048742, -3402736, 11713110, 13409405, -3115549, 16377632, 20630617, 15772106},
+     {-20086183, -6185890, -18387511, 6669475, -5016885, -707928, 28713293, 4850707, -4225052, 5088128},
+     {15917549, -16327610, 28265569, 13132501, 19481185, 12546057, 22371823, 6064197, -9203426, -5739928}},
+    {{21676670, 8890315, 25034010, -11906342, 12302211, -8138659, -30494501, -2374138, 8167417, -14907306},
+     {-32843713, -11082592, 24529480, 14820580, 21312109, 14948254, 29995965, 11514206, -10277565, 5215927},
+     {7576345, 2882033, -28458559, -5755971, -11350152, -5804528, 3665125, 5553013, 27057673, -7360478}},
+    {{-12323327, -797347, 23720275, 9221789, 2271915, 10416868, -9852625, 12702921, -23006061, 3457055},
+     {-8281961, -15949387, 20968771, 1818069, 3536831, -13223930, 6499904, 5972198, 33536820, 15196153},
+     {29991770, -1808911, 18435450, -9955677, -1295456, -9567026, -1188956, 16537896, -25964918, -11008279}},
+    {{32138625, 6837882, -7272871, -10036037, -21964758, 8744994, 4984907, -355133, 21997419, 12714978},
+     {17985101, -10242352, -11833573, 16046984, 630645, 680518, 18660084, -2026248, 32262556, -9169186},
+     {17538419, -2821787, -11474715, -8614935, 32302533, 473596, -31387199, 12920060, 26171778, 14359528}},
+    {{-27729463, 4496900, -30285873, 12645433, -18506802, -3935213, 27403958, 3221150, 10374532, -12782850},
+     {-4097864, -10544093, -8801287, -4310397, -30127153, 5329426, 133400, 6439253, -3075010, 13665207},
+     {17201613, 9866669, -8793675, -1191676, -26939774, -6566248, 12114263, 1344519, -5971402, -8600887}},
+    {{18981104, 14069077, -14539311, 2179498, 573174, 7437830, 15955142, -16602455, -29266681, 16326034},
+     {15377655, 14586286, -18980183, 8395221, 6073451, -13398369, -20232368, 10060025, 21711244, 10727520},
+     {-33413973, -1935735, 30098307, 7267049, 17697589, -14133099, -22025212, 2634618, -1849702, 15490810}},
+    {{-10631166, 7439784, -8491215, -3613866, 7267925, 12094483, 14052658, 1776680, 33122843, 13473119},
+     {12620517, 11750745, -23766939, -14534874, -20767534, 7150506, -27298921, -2755345, 20252791, -3509925},
+     {21390802, 15098078, 28081867, -1317593, 511632, 10811489, -10636641, 11437403, -10039903, 5047818}},
+    {{-1980544, 12696935, 8363495, 6683464, 15818138, 6504971, 15243137, 8150391, 372771, 14331575},
+     {-11759995, -8939105, -10310537, -7491260, 3356605, 10090462, -22873580, 9621784, 22503384, -10371155},
+     {-33266396, -1842315, 9616485, -13930884, 21511088, -14919664, -21468105, -7419103, 13133874, -6772654}}
+  },
+  {
+    {{12782785, -15931724, -21893091, -8573459, 4835634, -15954192, 10072619, 13940851, -29467889, -7878708},
+     {27912095, -8107913, 18646113, -7394333, -2173281, -3530981, -4141255, -2654030, 12336339, -11694457},
+     {4772601, 11455705, 18544517, -16468580, -20097076, 1820782, -19176415, 3658449, 18069620, 4353956}},
+    {{-15280355, -16126992, -18303089, 4925425, 9644660, -5805435, 28067328, 9397200, -24638499, -1003291},
+     {25854614, -6465715, -4453915, -7291249, 25521832, 7747231, -30031552, -3232187, 27282046, -15532150},
+     {2460673, -8065730, -29469759, 13988955, 27644602, 5822861, 356293, -11263506, -6584046, 586397}},
+    {{3527750, 16304341, 13773787, -7255192, 15164935, -948224, -13159645, -2529749, 27975970, -8154768},
+     {-1002104, 1233902, 33506541, -13342300, -6155654, -16599061, 6311030, -5961848, -13525147, 15937639},
+     {23353440, 952313, -23068661, -7719381, 15363505, 15856457, 2378818, 8949893, 29945087, -5219495}},
+    {{-28881699, 16265524, 12435985, -7180834, 17544544, 1607544, 15090514, 13646645, 13365058, 7394285},
+     {12730639, 40146, -28463936, -4947537, -19182851, 5018780, 11718033, -11558720, -18103878, 3257198},
+     {27680887, -3740430, 30684291, 3347294, 3466406, -13636858, -20719582, -4910384, 30686271, -15777717}},
+    {{32766791, -11808876, 9827282, -9291920, -27270485, -9970103, -930760, 10657992, -19623961, 5862878},
+     {-24457263, 16371059, 3321192, 2382634, -29340636, 1491708, -28615574, 8794366, 1783353, -9514454},
+     {29387426, 6050889, 6007318, 1233233, 11768425, 826076, 15811336, -5288489, 31617256, -4718911}},
+    {{-20566584, 14230634, -5830570, 14770519, -2662456, -6225505, -2893160, 2835407, 17970334, -3470695},
+     {-6542645, 11385663, -25754363, 13472118, -32187917, -10654055, 25576977, -8311442, 14591650, -16368545},
+     {5562885, -577588, 10626860, 1361463, -21850673, 5117479, -12062389, 6552679, 20915584, 1785255}},
+    {{-22644239, 12774595, 25123541, 6719510, 26524650, -8577763, 7019999, 14334714, -27170969, 13157537},
+     {18653117, 7332610, -11594567, -2320552, -9374552, -2475910, 28054411, 2592697, -23706941, -2148461},
+     {-2750180, -51423, -9655504, 14930190, 16190467, -6926180, 13677578, 12511997, -470832, 6824528}},
+    {{17639160, 15240903, 9089204, 11427115, 25103403, -9441590, 22346773, 14291979, 17016950, 4436827},
+     {19390296, 1773906, 23870351, -5992723, 24731797, 7332764, -18482052, 5779911, 22072232, 8082910},
+     {-10474472, -15452439, -5118185, 9644564, -25880937, -1492740, 27840571, -13172229, 5935406, 1775240}}
+  },
+  {
+    {{17435441, 6063289, -4957250, 15631269, -24032382, 12521973, -5220550, -11406116, 24467258, 9428767},
+     {-2905270, 13886393, 32095269, 11931998, 11864, -9930510, 13892372, 7113373, 23203251, 13178873},
+     {27452525, -13062601, -21239230, 12698150, 12609113, 955628, 21520977, 14950094, 448785, -14320053}},
+    {{-16440269, -4241580, -28236583, 2298538, -26812415, -2424646, 12146081, -14410297, -17370274, -6589787},
+     {-5388017, 9591722, 4766341, 15952859, 3553232, 2130019, 32632148, -11674494, -31167499, -5256708},
+     {-11076180, -14515388, 16175066, 4639310, 1161475, -9435829, 2893379, -5723104, -17442767, -2965468}},
+    {{20053106, 44484, 24834395, 5192686, 10627422, -13608053, -12567758, 5311604, -10449214, -4032464},
+     {-32880297, 15487446, -31453383, 4637515, 26554401, -15977271, 462707, -7182355, -1549769, 12821760},
+     {-26423427, -13350084, -1940834, -1562464, -7231684, 11857473, 22857057, 8893030, 1499716, 12521291}},
+    {{-10146946, -4205750, 36620, -10011010, -13639693, -9807131, 7906808, -11267010, 193731, 15655972},
+     {3727586, -2985405, 32274417, 10227694, -15894512, 15037727, 15013335, -2115777, 19960082, -14588967},
+     {-23237164, -1547728, -25758207, 537466, -32872745, 14164893, 7351134, -8743708, 3182516, -6595821}},
+    {{17464545, 9082458, 28908743, -2888501, 17700409, -6979374, 14559522, 1784958, 11604499, -8434751},
+     {15210573, -1767188, -690009, -13369766, 18727840, -3927832, 25156692, 5834461, 2775059, 11495232},
+     {2938578, -4976932, -8401166, 561489, 5019407, 10326718, 17680297, 11025105, -7031260, -4010739}},
+    {{7456114, 13086011, 31218514, -2904783, -18880518, 10309041, -2638806, 13862565, -16814492, 1322835},
+     {6501728, 11706547, -15391546, -1750872, -30622514, 11148990, 20564116, 7087248, 3107262, -11937775},
+     {24972269, 8336351, -3422405, 13900051, -8427381, -2548378, 2477060, -13819286, -5915253, -11838624}},
+    {{-16208651, 13323193, 27902099, 2631740, -25950037, -13076023, -30026785, 12831404, 4366253, 8432308},
+     {13482043, -1531953, -27757582, -2511981, -32759694, 14988875, 14756917, 8240730, 30879104, 13164106},
+     {-12058466, -16682772, 13813531, -8996603, -19277668, 5121876, -16581202, 8760919, -17997583, 5643847}},
+    {{21385084, 12522084, -6542108, 2069852, 24981045, -12928073, 13719642, -5613475, -12278256, -15994534},
+     {-12866431, 11880634, -681077, -4694505, -18504237, 10111754, -1660177, -8913803, 15917514, 4460959},
+     {18635934, 14214025, -5350593, -7659383, -5182219, -9352203, 4580147, -5883107, 5574145, 3739233}}
+  },
+  {
+    {{4521278, 14799429, 5823493, -2812984, -7902486, -4229130, -15110484, 16376542, -867073, 12356956},
+     {-23938482, 14381733, -6350727, 14628252, 10933795, 4245030, 18232972, -14891135, -20376711, -15086232},
+     {-3851718, -15216085, -13252828, 14485546, 10172094, 13898682, 17986775, 14122181, 4777234, -11150622}},
+    {{-2410473, -3170103, -8027500, 8627803, 28230976, 12304737, 9114892, 3480647, -17901024, 3279285},
+     {25885457, 11537415, 829559, 13115449, -7560274, -2922809, -16962171, -16343448, 11397191, -13859710},
+     {-19098980, 11065625, 28845535, 2400733, 15385592, 7225601, -20065337, -389186, 9204270, 8891715}},
+    {{-3982507, -8709961, 21924338, -10768703, 23762026, 3482738, -28612021, 5652394, 21267247, -11434683},
+     {7836844, -15594000, -5200472, -7269762, -32520956, 11631697, -31224924, 16581966, -8839731, -10664069},
+     {19528111, -2787493, -11336081, -995746, 4782311, 360183, 9570420, 12504692, -6001038, 9216409}},
+    {{-32029910, 12580158, 27708351, 8964120, -3038324, -16514800, -27843257, 5090903, -9438901, -14474994},
+     {10138889, 10730172, -2927872, 13364495, 4612257, -346896, -21665967, -14890429, -29790334, -4135178},
+     {20352780, 13861308, -5810855, -16567230, -13976707, 15831245, -17384068, 10391542, 15709053, 5265755}},
+    {{-29505358, 8223147, 26936930, -5159589, 7128535, 9639403, -2381494, -1267340, 6030467, 978597},
+     {-1347245, -1328503, 3823499, 16694999, -21667077, -15301692, -13763262, -5572940, 7282166, -580418},
+     {10642717, 16136321, -3166419, 8371128, 29972791, -8816910, 26659975, 13931544, -7550197, -12033333}},
+    {{7313121, -7267845, 5168111, -9110008, -13566709, 2986469, -18472439, 6641507, 23831963, -227236},
+     {-13342912, 2145660, 19754333, 6178485, 5950472, 10150281, -20744931, 8545645, -5462375, 13226649},
+     {29561062, -3943833, 32943265, -14352497, 4151323, -5440567, 3974909, 2002688, -9034665, 11018130}},
+    {{-33120048, -12166441, -20064082, 1329620, 4727070, -11067176, 11887906, 7695849, -10562573, 1108005},
+     {5184911, -15579326, -31775928, 10097681, 661008, 11182536, 28614519, -16594802, -21698022, -5867498},
+     {25614615, -3260683, 20322453, -12136278, 8731227, 3237272, -26293685, 6523951, 4028054, -12215745}},
+    {{16302336, 7216441, -29702532, 4316790, 33085332, 7977961, 4395073, -13956569, 30686908, 3932294},
+     {-30352953, -12746435, 7706597, -501991, 8497102, 7670282, 18010926, 15888097, -13009576, -7509162},
+     {-19848676, 9855286, -544789, 9558234, 1195720, 13944134, -5248249, 8497871, -18152800, -1871405}}
+  },
+  {
+    {{9240336, -11995627, -20400013, 4764316, 32650363, -12498750, -12124656, 6585416, -14903900, -15901240},
+     {-16705856, 9025610, 30210354, -2435491, 32409479, 12845621, 16535157, -5385170, -28227706, -15889345},
+     {-18158037, -8826881, 14378369, -11042316, 17327822, -5530495, 2441963, 16271314, -27546419, -5078939}},
+    {{-126258, -8871148, -3373803, 10001096, -13383574, 10255639, -1061710, 5168108, 2259185, -13619433},
+     {29676352, 15117747, 33176188, 14353249, -1308296, 2184883, -22028729, 6050751, 26736017, 15761950},
+     {-4263553, -11042027, 20148725, -9888727, 10287237, 128371, -18266423, 6523582, -528591, 10692312}},
+    {{-6704946, -9050691, 31667142, -4130599, 9166839, 8795733, 21563664, 3621032, 33140264, -6945966},
+     {30709918, -12329682, 14616837, -11813404, -6772346, 12304613, 25451213, -3787624, -18391691, 2939811},
+     {31592210, 10956502, 11036614, 13914450, 25483467, 1491906, 56711, -13425069, 27382948, 450334}},
+    {{27568588, 4191069, -7129063, 8650073, -6198307, 6668112, 26678457, -4205628, -30799376, 14035320},
+     {-25643495, 647393, 14351475, -7489411, -9640483, -1277011, -9037114, 823287, 15945831, 2886167},
+     {21927645, 5062038, 12553207, 13260593, -9645590, -4005486, 5033712, -1402587, 2742114, 12190779}},
+    {{24055750, 8132485, -25461547, 11735718, -18120185, 8412776, 4168852, 14289644, -282014, 13455697},
+     {5507570, 15249656, -25601387, -8144146, -21382355, -12538053, -3024863, 13609991, 25532300, 2608026},
+     {-29686689, -9839364, 22801080, -14917658, -28659568, 5468012, -10648043, 7848856, 30170669, 13165037}},
+    {{21793890, 6543447, 32029797, -6293489, 25472919, -6578059, 26648926, -5248579, 20397130, 13532797},
+     {14045029, -5966677, -5631917, 8258110, -4414937, 14445691, -24131390, -1442498, -31108438, 635945},
+     {-17542761, -7229568, -5669837, 3442852, -28072146, 3818388, 27717339, 975648, -11974997, 15264270}},
+    {{-27010602, 2018240, 20081351, 2886276, 26432407, 15040904, 4405903, -11386900, -29860833, -15793575},
+     {21041480, 980107, 4451695, -3359460, 22732040, -7659138, -1630864, 10453807, 30676603, -13758200},
+     {-10152189, -7538777, -14958461, 4600524, -4294379, 10793796, -29445542, -10207780, -23510076, -7678100}},
+    {{18107144, -15174227, 188000, -8675134, -27777876, 16698293, 3761803, -9500552, 26595935, 14163458},
+     {24500756, -14217452, 31796197, 7172954, -811276, 10086509, 22806501, -9061181, -22373255, -16446672},
+     {2765273, 12691492, -21347410, -6815438, -12274721, 4522798, -8849475, 6996515, 28798826, -12089211}}
+  },
+  {
+    {{-16622019, 11011477, 2983797, -10778116, -18360576, -6891808, 27162174, -15971434, -8353476, 14859753},
+     {17017266, 13285173, 21601363, -14661687, -21163712, 10157381, -19014868, 11324765, 18418354, 8329742},
+     {17846466, 13652809, 1659057, -5090631, 4128826, -9620050, -19556406, 9090738, -31209802, -5610077}},
+    {{27491702, -8136436, 3877235, -6810598, -3065641, 16553733, -20747690, 2119837, -18591576, -15503802},
+     {29893101, 2314261, -846035, -4018107, 18143560, -6561943, 32058949, -3089685, -2661349, -7404192},
+     {30695548, 15436705, -7746579, 2181177, -32113985, 8732070, 10317450, -8290445, -19566606, 12237331}},
+    {{24971008, -6285249, 7006383, 1016338, 30841774, -6862895, 17542650, -4836453, -30797665, 3570923},
+     {-4317865, -7315354, -12413070, -10687308, 11042156, 5762105, -31129527, 5761652, -15452652, 12539804},
+     {3744421, -2400664, -15892202, -11981954, 18753177, -2383745, -27775643, -4795293, 21600203, -7519535}},
+    {{5842832, -6628511, 3714967, -757117, 2192765, 15403310, 4505331, 5685684, -20368987, -6085631},
+     {-23515223, -5005115, 313093, -3386406, 7599327, -4039849, 20587571, -11332361, -15751321, 14402634},
+     {-2721298, 5438481, -25020293, -6458677, -22718305, -3802955, -5732700, -13704134, 24461331, 14630914}},
+    {{17354812, 124921, -10151055, 2632206, 20474835, -2017880, 1109399, -14386106, -18318147, 8253366},
+     {29292329, 651409, 13214604, -14337893, -10398543, 4110439, 12920603, -15785571, 28807007, -473781},
+     {-2212195, 7566631, -4909100, 8044281, 33511261, 7312944, 17082880, -2182194, 7083170, 4476063}},
+    {{-20626649, -2335476, 381667, -3169365, -28771311, -7959587, -5450598, -15718451, -19686736, 687541},
+     {10118942, -180419, 8449560, 6751573, 27468039, 14451163, -17893194, -1557993, -22882750, -13446653},
+     {-24362834, -8927190, -16334459, 7935011, -15621533, -15974906, -17251983, -10587193, -24383062, -2313649}},
+    {{5995702, 9044218, 20949954, 8086345, -23853635, -4751679, -19221787, -13945508, -21080397, -6337920},
+     {29580129, -8118146, -6940394, -14050017, 11463235, 10530804, -8268373, -15151788, 6379351, 5816184},
+     {4050379, -12234144, 3017934, 12251179, -7088288, -8301970, 18853950, 12981824, -18491646, -1327252}},
+    {{-15876461, -1443759, -3241183, -12107642, 24272824, -4014108, -16684501, 11382422, -6823592, 3411007},
+     {-16014420, 579051, -33034029, -6711657, -8404086, -2804376, 11829054, 14632680, -29425635, 9039110},
+     {-15154071, 12575806, -23138746, 10285780, 1088870, 2785788, -25048639, 1282905, 20507381, 3395263}}
+  },
+  {
+    {{30365118, 13693489, -2883732, 14457002, 6304172, 16408093, -19414593, 6854739, 23840044, 5898684},
+     {21031761, -10104705, 21941181, -6636031, 3696151, 16602279, -15084443, -4058950, 23993798, 1898917},
+     {3990300, -12552983, 30541013, -8948075, -1414370, 4075900, -4041498, -12825240, -11684590, -14172285}},
+    {{1605226, -11366156, -28437639, -8105729, -22760958, -9470251, 5482211, -15914841, -16125131, -16415689},
+     {-21083534, -15326068, -24433460, -2357598, 24288777, 11508117, 12279390, 4331264, -9467810, -109552},
+     {-30717131, -8549981, 24096372, -14103524, 8347312, -7743285, 14193391, -6249818, 4361157, -11887028}},
+    {{-9157275, -2332662, -11852626, -4967640, 30077388, 11790026, -30803668, 2187124, -6551047, 14365365},
+     {31916065, -13128524, 32530239, 9734814, -29284325, -16371341, 13173382, -10631166, 16906512, 7214134},
+     {5699977, -11142058, -5478274, -8585470, 14802288, 9008896, -16762656, -15189173, 7719413, 3648380}},
+    {{-12570600, 11745537, 22229628, 9628240, 14440167, 6638374, 5292460, -9037116, -11370662, -9259858},
+     {16427747, -4831643, -9138816, 4129281, 12211098, -7233696, 2883114, 15478758, 12529900, -1612738},
+     {-32871702, -6931463, 21392465, 5103688, -1730791, -14581274, 9481790, 10397572, 17110867, 4834999}},
+    {{-9125377, 10423526, -29855803, 2233211, -3514688, -7702827, -7549482, 6609126, -12180102, 9768506},
+     {19699177, -7354285, 17079587, 7667114, -12836788, 8274212, 13191502, -1332853, -23476818, -11701835},
+     {-87034, 7468941, 1671206, -1162786, -27707660, 8362464, -7279395, -15715766, 15752414, -14341845}},
+    {{10269720, -1320056, 11687095, 3489540, 19216940, -1812711, -33166174, 8317114, -1075185, 6164879},
+     {-31864133, 4057820, -20096729, 12328095, 28449260, 5200576, -7894479, 11683845, -19054965, 11309002},
+     {-31381107, 16251296, -11943589, -1981461, 31016118, -1658486, 23569946, 10751542, -3633978, -7426526}},
+    {{316022, -2335394, 10672739, 2561268, 11275843, 3782299, 17744396, 2988710, 19774301, -6128949},
+     {24347532, 12263609, -29240407, 11942376, -5469325, 12897105, -21100600, -4326177, 9763960, -2164658},
+     {-5709770, -6054034, -2356509, -13041582, 6424567, -5776508, 25268476, 2865106, -13316065, 7313457}},
+    {{-27991957, 2783487, -16456763, 10320055, 4307128, -3025363, 21628186, -8756209, -1405988, -14792865},
+     {-3256002, 9120776, 8633257, 3035689, 21139379, 2628445, -1735113, 10127586, 19066473, 5408637},
+     {-1543358, -4462995, -17839454, -16308654, -32522006, -9802212, 25894027, 10930556, -20374701, -12388039}}
+  },
+  {
+    {{15796400, -2005485, -19655022, -12607185, 3557413, 6576877, 11739381, -15008208, 17214368, -2897604},
+     {-9712934, -15891815, 27592041, -8044140, -2294574, -4776637, -9096583, 12637383, -14660454, 7054114},
+     {19237461, 14535391, -25649022, -9917833, 12204470, 13753698, -4366264, -15767525, 2666845, 498571}},
+    {{12429454, 3692445, -24680389, -12340619, -8697454, -11078057, -29805414, 10263415, 8263396, -9120720},
+     {14437557, 10151434, 4135631, -11454437, -493419, -9873177, 28495572, -11087361, -28032316, -1525301},
+     {-2885307, 2112548, 3866327, 2393795, 18289016, 1048109, -1532796, 9470857, -4407866, -2513993}},
+    {{-28445909, -7839020, -17343213, 8623630, -10618201, -1194464, -14659234, -2138689, -6854855, -11495421},
+     {-703949, 13755822, -31965448, -8901799, -19896151, -13384062, 24471959, 9343966, 11830771, -13047326},
+     {15389567, -7279307, -13206341, 13621895, 31243575, -2708857, -5678328, -959205, 30698064, -8749745}},
+    {{-29545125, -5683143, -14555374, 2788574, 24632251, -16419998, -1349300, 6659972, -13499831, 10300613},
+     {-33514817, 11512425, -3447520, 3148645, -6717307, -4314667, -10358708, 8935535, -23327176, -14104815},
+     {-27855985, -14908810, 18704771, 14192474, -17670790, 15590031, 20249225, -9980263, -11770817, -14859}},
+    {{-8566802, -10991854, -7662946, -3759968, -7566214, -917064, 21520712, -5020159, 25399005, 11190604},
+     {24964938, 10815242, 10046111, -2208197, 7294410, 12133000, 21172026, -15600792, 27611404, -2406811},
+     {-26312285, 5126884, -10254415, 9763218, 23162236, 4291204, 24501062, 15464168, 31714991, -10374514}},
+    {{-28398382, -15065954, 1309408, 15195367, 9512952, 4586091, -7636471, -16293956, -22315599, 11370607},
+     {22723113, 8794515, -6945103, -12527342, 18753102, -8655876, 30368663, 8968673, -30795435, 10607797},
+     {-20746229, -2415956, -15742420, -8940087, -22972965, 5159779, -4053992, -524202, -15944878, 10700830}},
+    {{-3166884, -9106692, -29771335, -10143709, -27766234, -13967580, 3461788, -14968092, -5809322, 16649483},
+     {-1794386, 2970994, -7255165, 2971317, 24276517, -10193711, -24857503, -5358871, 3474507, -914254},
+     {-32713770, -490464, 29384148, -4144671, -3729709, 13830624, 24262971, 287412, -15097397, -6884835}},
+    {{-15165954, -7960586, 27940072, 13434353, -3358155, 15534281, 10065334, -12114123, 19395935, -13092977},
+     {32858398, -1440774, -26943826, 6094252, 25114927, -12568931, -21701369, -7513208, 15693115, 5768610},
+     {30804151, 10557146, 31450431, -4805347, -23567571, 11197377, 13408488, -4936190, -771674, 16111982}}
+  },
+  {
+    {{-26901166, 10541253, -2001906, -2220463, -29496876, -8800275, -19211281, 6775870, -30171083, -3526414},
+     {194346, 2834231, 21611589, 586985, -8276561, -1195941, 30212125, -14787114, 31101524, 15550477},
+     {13428012, 11633588, 649606, -11530162, -27366192, -10298829, 21406581, -9876924, 25404031, 14897878}},
+    {{16333848, 8457770, -27236905, -2732080, -3849963, -6367596, -5457396, -386214, -17537545, -13105240},
+     {2700320, -9442591, 28728595, -11685306, -29174001, -7429836, -15505416, -5196948, 4062723, -13020678},
+     {-14262232, 2975930, 13987324, -12586114, 32799203, 13645823, -28889417, -9273764, 3482928, 6327428}},
+    {{-9326881, 1075220, -25131987, -9758014, 24454142, -4267285, -15991395, 1569454, 22324014, 16067156},
+     {10712811, 11145068, 8987278, 3734641, 24178942, 2834171, 5079550, 5570919, -245850, -10148088},
+     {5232865, -15276923, -23718635, -2165651, 33504145, -158291, 28022079, -10648559, 27313770, -160200}},
+    {{3951042, -16263918, -28905183, 8876281, -14276987, 8274549, -2319469, -7824116, -28026874, 10297038},
+     {-2343026, -298138, 3382854, 15047989, 7036741, 5531103, 3737878, 804620, 6889971, -5840988},
+     {-26973501, -12659633, -4084334, -15734023, -4291337, -1984888, -23216481, 255526, 4821005, 1013217}},
+    {{-20614576, -7860446, 11891367, 14622973, 4373516, -7255542, 13062768, 2568380, -29101800, 6121302},
+     {17469699, 15680237, -31545575, 1104968, 27761096, 1091201, 23441603, -427183, 1592164, 10870316},
+     {-24894289, -6628216, 19462562, -7387307, 19128128, 13289039, 1104323, 3000690, -9044232, 5130885}},
+    {{23190309, 14226619, 22374049, -8422609, -20327926, 11937740, 23611320, 10322407, -4939054, -3537358},
+     {-18800193, -15014859, -14433311, -6066830, -10854965, -10953204, 8524087, 8511296, -32828918, 14746024},
+     {24159682, -12342360, 14063943, -11601522, -30987328, 105904, 9009882, -13778570, 26119422, 16328581}},
+    {{-27989836, 8013066, -10355568, -9078550, -11511433, 10774472, 17862934, -7784746, -31509817, 14513925},
+     {-33134687, -14812288, -21248933, -1657194, -833611, 14442058, 14776873, 11430898, 20356290, 8233864},
+     {10970981, -10884900, 17090017, 7145908, -10991678, 6513482, -12456259, 13703344, 15566191, 9303265}},
+    {{-3724002, 3601211, -9759407, 6155164, 28206672, -10895454, -20020702, 5542089, 11106190, -12944831},
+     {-24048778, -7187980, -22557782, 5851107, -31717207, 8635435, -32301087, 987680, -12994338, -9683987},
+     {-10369609, 16379301, -25330428, -6242520, -15743766, -7681089, -7607799, -606253, -3662881, -6651453}}
+  },
+  {
+    {{29825455, -9905397, 2183756, -3150562, -29880503, -11783141, 16149160, 8312465, 21469404, 441723},
+     {14978852, 14970389, 27465687, -5904401, -17164761, -7743137, -33399087, -3432056, -12124036, 587495},
+     {-23387923, -2030790, -14397501, -14254739, 29360314, -10597419, 16231960, -803705, -22615745, -11472448}},
+    {{-26082996, 9663905, -15047922, -746858, 9821755, -10173441, 30456468, -16091822, -26683516, -13679035},
+     {23642745, -3711468, 934197, 15470874, 29189546, 8530480, 19996921, 451829, 9641715, -6467654},
+     {-27057363, 2798068, -4473662, 15864498, -13880787, -4323551, 11778151, -284578, -4907214, 873848}},
+    {{-23429243, -15093442, -31980666, 6598811, 13024738, -8120925, 7144073, 11076051, -24606737, -9175770},
+     {1790446, -2551897, -2797566, 14870557, -30573755, 8031069, -15730869, -224535, 617694, -14877662},
+     {6646136, -8236497, 27682556, 16533266, 430491, -2561551, -29729212, -14315368, 4228773, 7757828}},
+    {{31156506, 9891356, 6233659, 12382974, 30513177, -5229066, 6550212, -14504824, 15145002, -14544524},
+     {12013711, 5860045, 21453189, -14672170, 20841517, 10831661, 29942200, -16719082, 7009212, 112505},
+     {19362942, -13276692, -10708726, -16570905, -27826479, 1608236, -23671719, -15152488, -4641782, -6850080}},
+    {{-17463882, 12061881, 16023366, 9069758, 26104793, -5739991, 23613729, -16648400, 9562699, 9892344},
+     {20313853, 5199586, -3173417, 15926996, -14513949, -16337334, 31982440, 6493330, 21921129, 3914986},
+     {6074981, -248043, 20582614, 12494737, -2686957, 8785592, 7557277, -13053536, 14902044, -4026705}},
+    {{-16528708, 12962709, 1598685, 5261424, -3264428, -15412810, 22538074, -14370314, 26664121, -1891055},
+     {29452918, -9508790, -2648834, 15158959, 7451568, -16481342, -33513618, -11297433, 1919052, 8102239},
+     {14571289, -4407854, 27866119, 4473128, 29207278, -8858824, 30337795, -12230688, -33298862, -10740352}},
+    {{22269175, 5595201, 30550316, -9495592, -21258280, 10444114, -24765857, 10731420, 1480972, -6931415},
+     {-17166665, 12237765, 13609720, 3965686, -24873093, -5467077, -29066661, -931354, -17297062, 2948330},
+     {18510031, 6947322, 11212509, 6992662, -11040951, -3593411, -1448725, -4324304, -834879, 16015322}},
+    {{10354211, 5277147, -15765625, -15614761, -31048423, 11987936, -23931692, -3082271, 11379159, 9955291},
+     {-31878019, 2215017, -3098965, 16558806, 19066661, 3779060, 11209354, 12700815, -1810921, -7206936},
+     {904505, -1760696, -13220913, -16232534, -26140076, -3163708, 11805217, -123371, -9009074, 16774441}}
+  },
+  {
+    {{-13196173, 15121893, -10940215, 11214788, -24378425, -5641510, 26358242, 2283375, 12691506, -15803220},
+     {-31567757, 13469341, 23440950, 15102208, 26175123, -16298559, -7244009, 786960, -12285056, -12685295},
+     {-1588403, 4151949, 12751612, -13358520, -23776637, 5224097, -25870990, -15904370, -15673299, -838805}},
+    {{-27583438, 14992554, -27845574, 15438480, 14316451, 12327197, -14687681, 7205979, -22523827, 9878341},
+     {21424999, 2163347, -17707190, 9967220, -2330785, -565720, -1301380, -16183595, 957257, -14754576},
+     {-22593589, -7798728, 23852354, -52119, -23229312, -15478889, -24486024, -16356262, 25453389, -1997807}},
+    {{-15947554, 457078, 9533744, 12545631, 13602668, -3289607, 26850558, -8916282, -16522447, 6291810},
+     {-33317612, 1626907, -30383197, -12089676, 26413276, -1746117, 4881053, -14058731, -22799567, 723605},
+     {-25358421, -11759471, 14721279, 3270766, 32632436, -8962622, -10008658, 13139648, -30021004, 5346225}},
+    {{-618275, -12893354, -13122874, 6488637, -1275364, -13041936, 27389337, 5540426, -15852168, 6061824},
+     {-26123907, 9039349, 31882282, 13364655, -4864162, -14780560, 7691287, 2436407, 6468232, 4062536},
+     {10452155, -680993, -9496591, -11180033, -16545184, 15058580, 26371734, -13332273, -5345466, -10016460}},
+    {{7382495, -15908965, 22767565, 3666784, 19842540, -13159735, -26094151, -11804833, 28900103, 12170830},
+     {13584585, -16356277, 33331554, 10899782, 28785381, 16400318, -19092400, 16193823, -9563841, -7710993},
+     {19163647, 13636858, 820641, -956474, -24818302, 794133, 11960052, -643953, 30654410, 9457753}},
+    {{-6807629, -14170936, -27129030, 7223776, -10373476, 7419847, -4863992, -3299974, -22654238, -933573},
+     {27538269, -8159826, 23575295, -4857710, -13487047, 9920889, 11320034, 7572172, -10181633, 12214706},
+     {-23084105, -2683796, -19664953, -2977198, 9656406, 11598997, 31909565, -113148, -30917724, -12412426}},
+    {{-28789613, 9308683, -14047339, -6249715, -2389043, 13461796, -9638816, -1487450, -28173786, -5747698},
+     {12798771, 2333656, -22396809, -16074642, -30115543, 13590150, 8409105, 9419872, -8699329, -9133677},
+     {-1952668, 10675440, 657895, 7918310, -13833842, 13470306, -21096427, 4143842, 1575506, 8944775}},
+    {{-14707284, -16161246, -10821121, -16544819, 32516081, 8891374, 1801571, -658461, 19623231, -3864184},
+     {-4867533, 2629467, 30383426, 8144283, 1070134, 6109895, 24889597, 12397081, -1065220, 15725094},
+     {-26243241, -2658080, -25734377, -4373034, 17563597, -2127843, 22140428, -1112739, 1122057, 6736080}}
+  },
+  {
+    {{24814451, 11276454, 15489365, 12881865, 33141351, -11622149, 18843894, -10658672, 31571600, -8395462},
+     {-32389237, -1428064, 24699560, 10732260, -14238994, -15238541, -23041829, 10804117, 14384679, -15110789},
+     {30160327, -12407780, -27096057, -12288913, 5504241, -10137131, 16449579, 13999318, 15274610, -16391885}},
+    {{-14340837, -4670304, -19540593, -11910910, 24895422, 3442578, -7176656, -483433, 15571931, -9593820},
+     {-27626837, 10785749, -33083966, 16677923, -30422697, 14837004, 31691366, -4935180, 1648214, 1884924},
+     {-10239276, 5935656, -21514903, -6690345, 19847176, 9303787, -17012962, -14236213, 14992070, -6664565}},
+    {{-20056966, 4664470, -7425822, -5877561, 25802158, -14326888, -24311421, -9093925, 31097958, -8375005},
+     {29375518, 3724265, 28975715, 8802283, -1855150, -14540458, 14174135, 1839117, 27152486, 1295200},
+     {13058623, -950587, 21759143, 9727824, -31498155, -660779, -31825936, 1531983, 31252536, -11354160}},
+    {{29879385, -11390060, -668135, -9665241, -22063901, 16027429, -5965141, -5635646, -4896029, -11655211},
+     {-29975681, -13994239, -12589831, 12710976, -30298694, -9064838, -1036271, -11611208, -28343774, 5563490},
+     {18878613, -10963733, -27596700, 8650447, 17766078, 15350683, 22577546, -16272964, 20101337, -9044323}},
+    {{5257057, 10570290, -22091510, -12918141, -5275319, -5799966, -12143580, 11194881, 30360840, -11432991},
+     {5510805, 14042490, -2486366, -10691746, -26271517, -4785384, 9890157, 14058321, 30544983, -6586890},
+     {13940581, -11575631, -10396475, -8150641, -25085040, -9011703, 10723693, -2112918, 12097261, 503202}},
+    {{-12252342, -14801545, 24471989, 13096476, -30765035, -10124256, -11674913, 64891, -754671, 3628525},
+     {2009259, 7812137, -11474871, -10735037, -23964179, -2699701, 2151706, -6651257, 215414, -1095809},
+     {-10477313, -4296236, 17349253, 16054839, 3058389, -12211750, -26787835, 14694479, 7050164, -8079202}},
+    {{6829516, 9823232, -16998516, -16086598, -10592845, 11951489, 2211226, 14478212, 10953841, 13433026},
+     {-30104497, -8051983, -327280, 7857944, 7073622, 16576100, 14022183, -13613987, -1266574, -3399991},
+     {8784062, -11930733, 23661356, -12365440, -22464805, -12035023, -19970088, -16617044, -7814705, -6697337}},
+    {{25132883, 3068649, 7277053, -2522321, -12001131, -13231803, -6787286, 5298900, 30439667, -8130339},
+     {20164661, -9832574, -20651039, 10721867, 6576588, -5502012, -18997875, 11054362, 14526298, 2239678},
+     {4110983, 8506238, -10236183, 1706840, -27268628, 15454097, 13253257, 16214168, 9814559, 5898586}}
+  },
+  {
+    {{-857226, 16572276, 16092895, -14972110, 2098256, 317054, 6606350, -6021331, 16853004, 5977094},
+     {-4834277, 10857584, -8414910, -4273278, 4221413, 11258556, -8432531, 11739860, -4628576, 9000223},
+     {-32429502, -4930521, -8013120, -6271700, 22098636, -13037984, -17814771, 11310805, 33365942, -644957}},
+    {{-32974266, -4465072, 18111683, 2154625, 14954795, 4798009, -3259061, 12428751, 25722868, 2714570},
+     {14134763, -16116526, -24826619, 5686595, 21509100, 8838323, 16173581, 7663365, 29278159, -5355352},
+     {18510301, 3961511, -11468754, -16618301, 18529647, 6637747, 13759887, 4672914, 23515940, -10684891}},
+    {{27904950, 1608654, -13549242, -8540807, -11883798, 10271815, -23754076, -14338908, 17942785, 7826255},
+     {-18467976, -1573028, -25081541, 15375978, -16199131, -1347431, -4412440, -7730061, -31906857, -9430643},
+     {25072237, 1500222, -3088604, -4737418, -25894309, -6138752, 33072553, -6844327, 28172273, 11721412}},
+    {{13741524, -4733740, -19333541, -13340306, 150636, -5247831, -16324928, -6277952, 8009862, -16203814},
+     {-16913917, -8642301, 18052388, -16607760, -21876, 4492852, -6740552, -12972666, -16411988, 16264931},
+     {9549233, 16429244, -16192996, -7340635, 9172636, -13710373, -28331818, -6369267, 14383365, 2043558}},
+    {{13104928, 3084084, 5850489, -11924989, -13742495, 14948524, -13913296, -14541929, -9725267, 15360557},
+     {3940013, 12346354, -21449612, -3061188, -24376464, 4213691, 76144, -10454733, -4746772, 6110082},
+     {28950947, 11961260, -25607246, 14229152, -11944854, 15410061, 33043489, -6603599, -3618164, -6471119}},
+    {{14677147, 13570951, -28539737, -11716300, -9618645, -1725619, 5160975, 13564073, 25125283, 4793532},
+     {16930194, 3411452, -30235397, -1473089, -9220157, -2038275, -12595805, -13452310, 7519731, -7196439},
+     {32328523, -1901883, 17139168, -9655095, -8749698, 13605148, 7309572, -3787889, 33365768, 9196243}},
+    {{-25405750, 8891237, -30734782, -13361858, -19915363, 16293033, 17446589, -4856586, -16517930, -16373622},
+     {15889837, 8039133, -83388, 16238915, -11708698, -5011677, 27891558, -6290297, 14327509, 12371378},
+     {-12626270, -8009011, -25049758, -9421293, 30879587, -11632970, -23113152, -12877263, -5731429, 16423654}},
+    {{-4602736, -12704357, 26662116, 5745605, -17135601, -7688239, 33546601, -7278004, -8409889, -10366282},
+     {-19452547, -3323559, 20324244, 15544858, -2970508, 16040249, -28285855, -10721181, 8468161, 6317400},
+     {12944441, 9919811, -8425213, 14244690, 28045327, 13957376, 16358122, -3789068, -26657346, 14718183}}
+  },
+  {
+    {{26097572, 3350008, -9557599, -2284712, 7805213, -6457576, -6919653, -1576579, -16926991, 9042538},
+     {-23601864, -3067436, 12722274, -4660072, -4967003, 10499561, -17382557, 14631683, -23163793, 12828179},
+     {-23458984, 5723875, -3485747, -8498172, -1982407, -10234021, -32307965, 15956641, 12338397, 6761738}},
+    {{6677213, 726861, -26122445, 10611336, -29277956, 7779672, -4217841, 4894184, -28618878, 7628978},
+     {28290798, 16113289, 19919037, 2206831, -12074017, -8459109, -3710266, 15705229, -29651603, -2839365},
+     {-6123319, 9178761, 33426743, -5071362, 24591569, 14849878, -21589785, -9942553, 14684825, -299742}},
+    {{18022038, 875863, -22665937, -13021575, -17585585, -8403108, -12352569, -6298149, -27421117, 4665429},
+     {-22618662, -640634, 12785741, -14102332, 506231, -10019667, 20678759, -10360888, -4020150, -635623},
+     {-21548226, 5524912, 15577320, -9285952, -28568309, -1551507, 19962744, -16201776, 16968677, -3413569}},
+    {{-12037840, -251777, 30838986, 14131505, 9602323, 10519277, -38836, -156924, -32721299, -11261440},
+     {11816216, 15458474, 15542737, -233201, -17399936, -8676000, -24840165, -4021874, 1041625, -11628909},
+     {-10000197, -5113360, -20794994, 8493370, 2264207, 10035643, 11376786, 385114, -4922741, 15371245}},
+    {{-32786770, 11218309, 26543431, 16522276, -20355625, -7622632, 11099628, 8953155, 3301218, 2973639},
+     {16358643, 4118774, -5398769, 4201162, -12466629, -3856806, -13738962, 4659398, -19703003, -3893456},
+     {26863513, -5459718, -6193708, 1682129, 33406711, -2409148, -27014348, 7748464, -19772920, 4905877}},
+    {{14277974, 3625638, 5491314, -9761716, -12170907, 11197916, 10047149, -15624739, 5551067, -14121793},
+     {-28039856, 12540194, 17841047, 11116355, 20214643, -16701026, 9518421, -11299114, -22635002, -12507765},
+     {15935509, 13598704, -431091, -1622572, 9752925, 6329903, -31965926, 8282193, -6376941, -14717809}},
+    {{31271230, 6469405, 20334323, 13766332, -10637397, -14517300, 26609788, 15412797, 22697833, 10347270},
+     {14396448, 821971, 15445570, -412487, -7343669, 8015803, -5583835, -14940957, 19218438, -8307047},
+     {-30314955, 7361841, -12557292, 2972863, -14268068, -1921164, 30642097, -16000607, 1081607, -514098}},
+    {{22616336, -10772650, -17037572, -15275857, 30238260, -11244130, 30651752, 4420061, -9420255, 11776461},
+     {13839791, -9382014, 25316433, -1534569, 21131600, 16154535, 27948630, -195366, -25540316, 9088781},
+     {791632, -12796323, -20202364, -5170248, -6436901, 2776786, -10651720, 4754002, -18480456, 7783726}}
+  },
+  {
+    {{-13540348, 12938372, 25407120, 7742920, -30158040, 1484980, 16947502, 11903525, 33066549, -6445213},
+     {33146326, -5412713, 1912480, 10078700, 3484063, -382957, -20550515, 6014130, -10363440, 13588078},
+     {-4088945, -10379524, 30105311, 2020908, -14098026, -16248871, 28851630, 13690016, 3146015, 9955687}},
+    {{6025971, 3924188, -27030415, 15132719, -15619385, -1630278, -10212271, 4905002, -8110797, -635203},
+     {-3764356, 16230832, 2067111, 6083762, -23919854, 15414196, -3178326, 4396584, 11221162, 818081},
+     {-12258069, 13214804, -29092090, 1814020, 5569541, -1947898, -33193260, -15623252, 27857759, 12040321}},
+    {{18541325, -9009947, -14071576, 3216781, -4739833, -10400311, 21107655, 15747273, -18407033, -5716598},
+     {29521046, -14867120, -27822214, 13254196, 25634420, 12557588, 12396114, -5213934, -25887108, -6304656},
+     {-27002314, 4112197, -7785524, -1026430, 8195436, -9573896, 33107374, -4935235, -13208213, 4106939}},
+    {{-11810863, 6344514, 12829072, 15672373, -26057379, -15350258, 27421144, 285372, 18272750, -3763401},
+     {15104787, -3352711, 30128536, -6558480, -22997352, -15368846, 20763344, 8276584, -21480740, -12777945},
+     {2989439, -2582066, -32585609, 8368591, -20385932, -7589874, -27773714, -10730898, 784256, -11258748}},
+    {{-24898003, 947638, 26594912, -15280840, 14054368, 13489772, 21434311, 505806, 11801685, 1243742},
+     {-6715337, 596705, -9937676, -10444882, -8853873, -3990638, -11694426, -5012686, -5186612, 4899451},
+     {27351124, 12996148, 24693635, 4102205, 32045841, -12525321, 29905233, 10271436, 6748908, 5316231}},
+    {{24463336, -15275649, 8003437, -10071619, -28063497, 16077593, 607592, 211720, 8058651, 7022693},
+     {6269520, 1756175, -18136682, -14019480, 16144410, -16230706, -6627869, 892227, -32082198, -10584084},
+     {-31499129, 15704581, -11078695, -6289039, 17270896, 4251987, 7418784, -16425334, -7430433, -8576109}},
+    {{-25336536, 8852963, -12543846, 9681054, 28469296, 9497121, 3353471, -3092011, 9160153, 3195282},
+     {32432746, 13493163, -7871153, -13202150, 7051303, -16422145, -3077170, -2789016, 23847874, -7164465},
+     {28695747, -15862937, 24290998, 3622348, -22613852, -10973276, 23781033, 13679304, 18902742, -1027654}},
+    {{-18459838, -14796549, -1832465, 3793042, 16587584, 9603345, -26684440, 7886335, 32871324, 11711892},
+     {9576066, -12530750, 7501038, -12015329, 9409214, -7584601, -26183396, -5290411, -9217713, -2626041},
+     {27365330, -11164821, -18495855, 8020855, 24926529, -4310846, -4292554, -6220518, -2452895, 8660818}}
+  },
+  {
+    {{27347487, -4378104, 13951940, 755437, -21260462, -14460873, 7003338, -7870091, -13469633, -10479098},
+     {5419534, -2977092, -18145940, 13760467, 4750588, 6224853, -23277517, 7872963, 32601623, -8789216},
+     {14802284, 172963, -8008457, 3483553, -23724722, 4182862, 24400962, 13906448, -17954318, -10173774}},
+    {{-30117510, -11922174, 6183831, 326262, 291791, 16097586, 19024757, -6381505, 14873558, 3128759},
+     {-16824563, -11237931, -14768110, 9358045, -5126155, 9908711, -24459613, -16037896, 8436933, -13969783},
+     {-3426466, 2693382, -11110984, -14662795, 23072183, -7781964, -25065304, -12016991, 1352623, -4198608}},
+    {{-2976942, -6322673, -9607318, 10621196, 9854913, 15680687, -29633182, -12649370, -1913318, 4680381},
+     {31656850, 4154427, 20995602, -1900504, 27211018, -8944364, -22348199, -12145155, 12213052, 7175034},
+     {1128419, 3107700, 19067576, -14022830, 4459957, -10913658, -945324, 13201319, -3955227, 8983711}},
+    {{12789575, -6714952, -20545709, -4463798, 22858218, -13568753, -17534964, 4059722, -14682328, -8473153},
+     {-29997106, 3378898, -28235714, -11684972, 20249792, 9165882, 10367899, -7883022, -19322428, -11689760},
+     {-8815171, -1569695, 24556425, 6653461, 4454969, -16485044, 25198715, 10269037, 32802487, 6420418}},
+    {{21739643, 16680760, 20654535, 6213573, 11876934, -1843622, -21210565, -12068399, 3481841, 11581973},
+     {-28570177, -11542594, 23340118, -10782667, 31546454, -4508433, -19794231, -652819, -32403577, -7237606},
+     {-16667430, 8634253, -9812997, -2552749, -3908762, -2057664, -7882081, -7370052, -5357229, 16136098}},
+    {{-29097653, 3706219, -25190906, -16463636, -24878474, -7549752, 19125696, -16372648, 20879734, 597826},
+     {21450635, 15666499, 12030421, 12879056, -24284829, 2130325, 19743151, 2950084, 31855037, 1249814},
+     {7500563, 5383822, -10123112, 8556703, -18858858, -3735199, 23514785, 1161048, 28777718, 7976394}},
+    {{-1892256, 11940011, -15965928, -13281278, 16066845, -11707761, -6657711, -9390012, 21313571, 3946793},
+     {-9885112, 206992, -25672901, -1464831, 28769191, 9693275, 20926292, -15974250, 31622612, -3645236},
+     {-21698976, -7798867, 8920646, -16730977, 29231211, -14648501, 24417923, -3726193, 30270348, 4018508}},
+    {{27593565, 3082844, -9705344, 3428328, -23621558, 9885237, 27733891, -9271688, -26265884, 2885388},
+     {-32758020, 16378611, -13076838, 15959129, 11879100, -14841009, -17416298, 8639323, -11956777, 10036781},
+     {-8753250, -5517129, 10993691, -1191586, 27337008, -1901566, 12811823, -9493943, 1516880, -15980247}}
+  },
+  {
+    {{-4704801, -9979315, 19323501, 10569839, 5654973, 7580745, 7140397, 1464396, -10316882, 12528492},
+     {16424647, -6597537, 1109449, 10923747, -26592848, -9532142, -12978053, -14741569, 12605798, -12200134},
+     {-29225520, 1500463, -296709, 5522181, 22665010, 266242, 32378976, -6261957, 23737528, 7519751}},
+    {{25228404, 10387020, 33100102, 5191381, 15562553, -16737713, -8356447, -14493775, 24732224, -9595679},
+     {768266, 4865957, 15278199, -2657606, 15010332, 2695024, 12828161, 7420257, 18056540, 9806727},
+     {20378415, -4624389, 14481844, -15125827, -28480122, 4186685, -20922984, -670304, 12953324, 11092491}},
+    {{26173251, -8417765, -31666478, 6132323, -11504536, -3782279, -14332487, -12914331, 12836796, -14253365},
+     {-29309734, 7527438, 1979511, -13765448, -14998236, -13850026, 18391297, 13241673, -24395705, 5073738},
+     {-25768784, -13997605, -23911229, -15585855, 5575260, -7432646, -29173704, 14510971, 32529425, -10868373}},
+    {{19323658, 479739, -8971812, -6440813, -3965325, 2321651, 12489007, 8678119, -30849267, 8943597},
+     {5207884, -16318826, -8090785, 2364250, -25830253, 4153021, 22309251, 2970879, -18782013, 7328182},
+     {11281054, 4701418, 23621589, 12280241, -24978682, -10447590, -6626225, 4391939, 8715622, 13196232}},
+    {{-22007837, -11095745, -16471075, 9096693, 27085700, 8055797, 10230337, 5515722, -9694301, -4435435},
+     {28516787, -15585370, -6364438, 5406562, -5713714, -16672135, 15941662, 262492, 174944, -16116582},
+     {-22010834, -14047536, -6441066, 1619398, -20930021, -3609572, 21475041, -13609149, 30272802, 14967702}},
+    {{1003737, -7196489, -12608312, 4240929, -10590303, -3734932, -2706637, 16667861, 19730822, -3304712},
+     {-15475278, 13704678, 26377519, -16321687, -18219020, -13871392, -21833014, -11022612, -24649279, -15796730},
+     {21604770, -7841000, 8671718, -9163491, -22658170, 6954713, -29429465, -7459954, -1707715, -11472043}},
+    {{-12723760, -11188912, 7605781, 7399888, -21907828, 7456186, -3662301, 6980253, -16071855, 12514792},
+     {-20847708, -431642, -4712390, -9540398, -25989727, 5221993, -8292282, 14827453, -9740730, 16743893},
+     {3130904, -9976555, -612329, 9006397, 21267953, -9120442, -16578816, 932604, -1682295, 9693037}},
+    {{10910639, 8168764, 6070614, -1798170, -18938903, 16057386, -32997354, -3968061, -20816089, 8318312},
+     {14396650, -3471968, 18045042, -8918583, 18588348, -6001448, 25320497, -3394872, -16921288, 4206147},
+     {-31934018, -8085465, 2158308, -509544, 1667027, 6140796, 418421, 6810155, 9627752, -2060675}}
+  },
+  {
+    {{24352625, 1328599, -12529411, 8165058, 18990037, -8336635, 25619082, 3053906, 25329875, 8587888},
+     {-32796527, -9053843, 31184821, -7186714, -18915416, -14943010, 9654398, -9610165, 32044276, -39701},
+     {30070107, -9549137, 27088917, 15016362, 26951987, -810281, -3474217, -8227987, -3949668, -14024983}},
+    {{-11806419, -173649, -12464592, 1152840, -4824925, -9262854, -4978528, 13193919, 24250680, 7400827},
+     {20829278, -9636220, 24437799, -7088904, -15281705, 3121955, -6492412, -7539205, -7905894, -15247884},
+     {-10011436, -2057499, 19785967, -5493387, -10120811, 1619619, -19191754, -12873687, 24641699, -8908842}},
+    {{-26047598, 13067320, 27964977, -4255321, 11168447, 10002348, 814919, 6738778, 7052475, -15074737},
+     {-30829333, 5150883, 12889977, -8051212, -17962688, -4139351, 15324771, -8171327, -23819247, -1720393},
+     {-16270638, 592023, 26810369, 10951416, -23962012, 5714745, 18295436, -10229052, -18302860, -19975}},
+    {{4484088, 16063954, 1418838, -8611635, 18502484, 13659027, 31121908, 11389956, 14431251, -9566786},
+     {-17905044, -16582473, 25347505, -8168023, -9167780, -4867114, -29257349, 14338558, 20768491, 16071604},
+     {26687752, 11243061, 10434081, 8961364, -916635, -6300932, 10654496, -12453832, -1501679, -7259393}},
+    {{18056402, 7194941, -25049061, -1486752, 5449946, 93148, 24728970, -4505739, 18707714, -5983627},
+     {30671183, -640585, -15993892, -8768144, -9997991, -980521, -14259225, -13929065, 29496099, 3890342},
+     {-7515681, 9419646, -22875859, -12414404, 32315364, 2344492, 18250118, 10187515, 6280594, -15048451}},
+    {{12956011, -13886543, 20813214, 2166619, -24743327, 15585087, 19416000, 8539561, -9592191, -1982328},
+     {-24425824, 9042657, 28751672, 11390961, -20814337, 6975459, 19101839, -5291352, -2532184, 5688409},
+     {10835324, 10850702, 22244211, 4993684, 21720569, 4436868, -7875437, -2988823, -1121172, -16550549}},
+    {{-16302426, 8675, 569677, -3259298, 8977139, -12030541, -11426836, 11530805, 25829700, 8081522},
+     {32020938, 4748714, 30127804, -4696562, 33281840, 9991040, -32780602, 3081745, 33190066, 3195868},
+     {6410544, 5809933, -16371785, 9246855, 21628508, -1499240, -6475720, 10721360, -16254950, -11324142}},
+    {{32309335, 13080586, 2650412, -13951196, 2613675, 3115245, 15784580, 8018518, 25436951, -6498666},
+     {7683611, -5943303, -2132605, -366046, -18253626, 67117, 24546684, -16666535, -20420396, -7870317},
+     {21472752, 14331475, 14838395, 5470498, 18372800, -15949632, 4941523, -2644875, -30354861, 14589181}}
+  },
+  {
+    {{-4297888, -14639733, 32872306, 12410766, -17358724, 6728320, 25705225, -696502, -7136439, -3151367},
+     {-26565503, -14610058, -17985988, -13618253, 16156013, -10115934, -16069209, 14988626, 27131518, 16366556},
+     {17464707, -1166206, 9022475, 11033475, 23557454, -9662624, -30845972, -9463523, 30917462, 2988448}},
+    {{-26749878, 16610658, -26201026, -3444447, -15089845, -8719569, 28052291, -10269299, 20492619, -16144321},
+     {-31666475, -5568222, -10411053, -14255300, 16973427, -11731632, 29563696, -596825, 13689977, 6200734},
+     {820524, -11540306, -8660346, 4358353, -4246616, -11051189, 2101295, 10036330, 15019159, 6437841}},
+    {{10111843, 7586482, 25694693, -6240766, -12804870, -10390207, 14571872, 7708450, 18925351, 13548784},
+     {22436740, -15585521, -17119075, 8418270, 23485847, 16330649, 18629992, 9246807, 5956550, 9926573},
+     {3768953, -14620871, 7509537, 9704728, -22836328, -10084641, -9186495, 2212369, -17869519, 3465772}},
+    {{16971081, -16030051, -18854159, 16167316, 9738504, 10480839, -27835122, 4762746, -23314520, -8540516},
+     {-10912998, -2713314, 24952893, -15999846, -7086199, 7387083, -14726107, 8032083, -23544864, -6267450},
+     {-23802727, 9717706, -25971473, -2309696, 26432690, 9948486, 8148236, -6021635, -15641227, -10942405}},
+    {{-18657236, -538502, 30417008, -3370748, 21296945, -3674004, 17397197, -5759915, 3649901, 8608755},
+     {-13419136, 1163511, 10552753, -12252087, -11628335, 764242, 22165507, -4049314, 25853393, 6922671},
+     {28351068, 134843, 8433852, -11083420, 25196180, -15277357, 7921303, -1375769, -19638536, -11739926}},
+    {{-6731323, 9449542, -7182869, -3882058, -27856591, -9872136, -5635792, -15668201, 1886940, -12500762},
+     {-17131156, 11841296, -27277252, -13045827, -22953941, -14771133, -19265904, 12234784, 864363, 16478856},
+     {24901885, -641493, 12481892, -15190026, -3521352, 3664500, -8584243, -7823336, 24715272, 1600601}},
+    {{-13493314, 12071957, 24155591, -2465319, -747260, -2460241, -21436914, 4355433, 11086839, -11620000},
+     {16332177, 9318291, 12296329, -4103752, -19709525, 9139672, -2997761, 574807, 27000740, -13070693},
+     {13936565, -9327301, -734399, 13626977, 31237304, 13753320, -17103295, 7655355, -32919895, -5036059}},
+    {{-15016316, 4302890, 16300234, 12804255, -10063471, -11558554, -19686643, -15685382, -30874551, -1915982},
+     {-26284224, -5777814, 5667797, -8796744, 26108657, 12770369, 9469776, -9331543, 4176315, 1019046},
+     {-15308160, 3175053, 23678748, -16739405, -18173109, 774464, 12061465, 4877261, -14379358, 13552193}}
+  },
+  {
+    {{24965184, 8622546, -27633202, -9435537, -17896851, -16686129, -24861192, 16434787, -17155690, 12829510},
+     {13786729, 12497005, 9020566, 1747605, 31194637, 4168047, 27814797, -4884850, 19097142, 11962842},
+     {21967776, 13297582, -31435833, 210194, -8636673, -11984852, 16329795, 4864888, 11458472, 4332668}},
+    {{2503733, 13040018, 6327259, 10989378, -1841566, -14708097, -32081205, -5796748, 11888156, -13574421},
+     {15973154, -3782710, -13206421, -6597566, -10509537, -10960026, 26304524, 9393207, -33214640, -4657596},
+     {24594630, -15920316, -33038524, -8461211, 7040392, 3168192, 5017290, 6338095, 17890687, 8802970}},
+    {{-10541540, -1784346, 21660858, 15507213, -30231333, -8334526, -26712552, -5285945, 11610305, 9037929},
+     {26137956, -13914277, -21327429, -7347323, -31251774, -839026, 23596519, -10420781, 26686033, -13175823},
+     {-25840751, 12602141, -28987311, -1017424, 18928928, 16303004, 23754156, 8734320, -11645615, -1764626}},
+    {{16053908, -1050266, -25601375, 9679256, -16867845, 16312883, 28705694, -16047431, -21766848, 1317951},
+     {33455773, -10943066, -22459545, -6488120, 7722331, 4025769, -26246774, 10271547, 26870080, 14967080},
+     {-28089827, 16623329, -2733867, 15230610, 6014759, 6380454, 13816836, -4311465, -29763549, -14093905}},
+    {{16065018, 10926868, 16449443, 6274760, -20269, -10108456, -429046, 6527913, 11043563, -1321890},
+     {21542816, 10601642, 26201248, -16052836, 786013, 4575489, -20531512, -3786748, -22463868, 5820805},
+     {29246595, 428512, 8710401, 5721120, -1842545, 16753836, 16314879, -6213864, 28883346, 1775613}},
+    {{-22523610, 7033375, -24076479, -7528829, 15515820, -6459198, -9841943, -2139112, -13572343, 16101878},
+     {15508310, -1064978, -19582449, -313882, -18957000, 5604185, -25283528, -6446414, -15446702, -14903726},
+     {30799104, 12815104, -6686164, -10911631, 11548197, 4758565, -3660908, 11073514, 22154348, -16592412}},
+    {{5486369, -7576545, -30933443, -9528078, 18473515, 12572960, -19578556, 9704124, 25910492, -2514458},
+     {-3472317, 1693731, -14598471, -9502629, -8685195, 5127746, -19671149, -6414552, 18218875, -7542671},
+     {20570412, 10097889, -5281088, -4745147, 12899554, -7451509, 5470768, 10018175, 5762412, -2346407}},
+    {{17527971, -3690975, -24455394, -14883794, -5597142, 15401291, 25636367, 10152510, -23607276, -14270526},
+     {5792107, 8624116, 4562050, -16359577, 31868109, -12721236, -28831452, -10751402, -6899194, 13792986},
+     {26013000, 8673374, -5989651, 10203714, -27608180, -8041490, -2278982, 1124978, 27362795, -10644818}}
+  },
+  {
+    {{24435985, 6803775, -31076339, -7466654, -2894164, -12329268, -19100843, 10407537, -28170996, 2213612},
+     {18228012, -1434622, 9568248, 2505439, 15240861, 1670408, -17280607, -129824, -30061126, -64143},
+     {12121468, -3513346, 5838290, 7696672, -28957891, -12953190, 32330746, -12832963, 27555048, 15344032}},
+    {{-15502674, -4758179, -12677782, -14088054, 21647236, -7268682, -9474634, 11700859, 22625030, -3010874},
+     {24614287, -13827705, -14878600, -1597235, -20400181, -11358936, 28662354, 14114259, -13992151, 16301806},
+     {-30651192, -5483651, 26521927, 6679271, 22069101, -15013918, -4864663, 8664649, -11180994, 5490425}},
+    {{-15306729, -442564, 28635781, 5377975, -5373156, -15004035, -15406209, -4357913, -22747970, 16526065},
+     {20822113, -6188604, 32540264, 13771973, 23886683, -3901060, 1676229, 8413065, 20024146, 4278883},
+     {-26359243, -13123502, 1605295, 8035605, -2262553, -5777163, 13522571, 4065557, 26090054, -11996430}},
+    {{7302951, 9355424, 32095859, 13407875, 9663034, 9992348, 22928563, 16294812, 18243239, -8708266},
+     {-32892183, 12942272, 24985516, 13685744, -28464483, 7866274, 6738050, -6526590, -6738780, -15512276},
+     {-13102947, 14148798, -27535613, 10308190, 21128353, -5188718, 19150915, 1636084, 977139, -1089628}},
+    {{-7191083, 128809, 16664280, -6956071, 4676481, 3133678, 32363521, -10117988, -1613966, -9405540},
+     {28146810, -6218447, 2036329, -9458421, 26869407, -9444320, -5313800, 3912481, 19469052, -2456848},
+     {-31084776, 6391081, -2655687, 9556761, -28192263, 5339359, -24291352, 796670, 12140779, 6488114}},
+    {{-32499157, -3227499, -3434699, 9612896, 12150648, -10123471, 5056069, -2577756, -21283972, -8219786},
+     {-30532296, 10721493, 27384468, 16424765, -6937715, 2844780, 18369502, -3099603, 20772418, 7056030},
+     {-3993002, -8501138, -8119162, -13872790, -15645302, -5269938, -12193818, 129264, -5509087, -13762575}},
+    {{18990918, -5067159, -24400829, -10745577, -29516847, -7740507, 11768591, -4322403, -22024281, 1520886},
+     {13980793, -14168161, 13448862, -14323102, 17965834, -12736782, -8092432, -12472253, 26096327, -1399422},
+     {28072503, -6944822, 9930927, -9041398, 15575371, -14560508, -2957350, -5258860, -3308938, -4654517}},
+    {{-32500182, 1412287, -7747611, 6135730, 4614329, 7563620, -5489379, 10474628, -21224069, -5230466},
+     {8560429, -9329595, -13807881, 1957120, -24666863, -8499412, 8695, -13373220, -19647079, -219309},
+     {22661684, 16113540, -25999245, -15778215, -25487591, -14866420, -3845119, 12153291, 23157079, 11668071}}
+  },
+  {
+    {{30283185, 4383202, 22967501, -387033, 9852954, 11041809, -21302635, 13387175, 29710915, 8055145},
+     {13782788, 9305080, -20035329, -4002775, 31073249, 6387206, -27640322, 10961325, -30423344, -9431107},
+     {9030081, -11032459, -11043720, 11935823, 2915780, 11537369, -21175322, -9154321, 20060320, -12132404}},
+    {{-7473855, 2742926, 24276647, -1049148, 11278694, -5066538, 22377578, 2585351, 3637392, 5608671},
+     {-4982601, -2975897, -22094057, 401244, 18947681, 4355532, 14361699, -6722950, -31256486, -6952726},
+     {10683396, -4260836, 3466573, -4922582, 29529689, -3946156, -375125, 4055997, 10497319, -4006242}},
+    {{22436957, 4057215, -6526789, 9898849, -15029043, 6313850, -26974730, 8021732, 18572257, 2558573},
+     {-17738456, 8564143, -12738216, -16723620, 10398780, 15408137, -13666720, 4569786, -7373906, 16188608},
+     {24527845, -14054699, 8524884, -1633071, -9740944, -13004302, -33253844, -16066047, 24642551, 7179894}},
+    {{30429994, -216234, 30704612, -571952, -12606181, -15618020, -17893081, 6740728, -25240723, -3864886},
+     {-9195030, 16508302, 25913965, -9065451, 2648704, 15048293, 31540336, 8324372, -11698505, -13789141},
+     {-31039174, -5234994, -2897067, -11185068, -21188609, 14599195, 7771290, 5541721, 8437454, 6092695}},
+    {{-11768569, -6109175, -17703064, -8175960, -6504972, -10365343, -19789471, 5931465, -19186974, -4036910},
+     {2568367, -9658571, 9293695, 14794064, 24400907, 13513196, 3609251, -1311951, -9615122, 16523198},
+     {-599246, -14482257, 23088791, -15757240, 15336159, -10948025, 23869165, 15219459, -18974826, 12918865}},
+    {{-19741416, -4712459, -27220937, -6201926, 11938682, 3830263, 24685920, -9895118, 7404618, -9521658},
+     {-16916228, 7989777, 25317470, -1304424, -12027452, -9153514, 28441059, -15979695, -11717202, -12604504},
+     {-3748323, 6077355, 15681315, -14598566, -6187760, -6559629, -18847217, 1649015, 18006785, 14830027}},
+    {{-6115746, -16492143, 10763431, 9754868, 32298822, 5289729, 2772466, 10458574, 28985509, -9591678},
+     {20076303, -127350, 31749646, 11446629, -18314212, 6643674, -1434404, 1082171, 29030305, -16359190},
+     {29003024, 4128248, 23902668, -5628173, 9880423, 3357212, -9833642, -10689666, -16041418, -5256843}},
+    {{-5470531, 5611945, 10662137, -14183034, 31767159, 1273192, 2239623, 9503555, -26306797, 11890023},
+     {-23019221, 7043464, 1219064, -7659901, 14018226, -6179289, -18071667, -779312, -6281568, -337223},
+     {27446006, 16615761, -22494590, -14636773, 28716333, -12039889, 31863669, 9828177, 30058085, -4866476}}
+  },
+  {
+    {{-22629278, 6097630, -1080948, -10622197, 10786996, -13886971, 18019972, 8508278, 4612382, 724305},
+     {11986035, 14818868, 8991685, -14770622, 7473691, 9834166, -1853039, -182314, -330773, -14185782},
+     {25115657, -7300120, -27297806, -13459303, -31116745, 14941193, -24046851, 8933824, -22641511, -16224773}},
+    {{-17531748, -8630599, -31189292, 10090815, -9062041, -12355979, 13314409, 6612842, 17283625, -8166367},
+     {-29454724, -4215867, 18170889, -11901801, -1126870, -6987073, 17222487, -11495193, -23154860, 3027911},
+     {26537449, -10225392, 1755292, 1635894, -16094688, 9091476, 1624054, 669519, 21452227, 6624706}},
+    {{-29452013, -7998399, -6503952, -11703326, 17333823, -1732402, 14761159, 8528856, 5075903, 439672},
+     {8212815, 11871930, -30812525, 2521080, -10357831, 5730021, -14739090, 2313546, 6351197, -14068516},
+     {11488841, -486512, -8935889, -8008170, -5248794, -15737243, -20604349, -10495123, -14285126, -15062211}},
+    {{-24953117, -14919961, 14367201, 3216886, 3478602, -9855190, 17835340, -14225247, -14388837, 10678411},
+     {18027421, 11936051, -10735728, -10371816, 3337120, 277552, -2374004, 2681937, -2541177, 362648},
+     {7346992, 1720412, 15482626, -14286418, 17239270, -11710162, 25503202, 3218149, 15457990, 15141478}},
+    {{16061194, 14328985, -13448390, -11731464, 26888640, -10106173, 31686196, 13446758, 26972767, 12191018},
+     {-31745239, 8053883, 6603193, -4958116, -12432918, -3962573, 14497027, -10023498, 12751897, 2306762},
+     {22706930, 12702394, 8224889, -4151018, 9724867, -2202343, 13301283, -1375339, -2412293, 13976629}},
+    {{-11540758, -7905418, -17182934, -8154119, -7026415, 7329102, 17812992, 1104242, -17409369, 16226538},
+     {12469577, -4962420, 4682765, 2566792, 25215186, 4760426, -1080840, -14533491, -32019287, -1276606},
+     {-31105608, -6067523, 26018705, 3151710, -21924736, -16246799, -16510792, -3950852, -26519404, -4155007}},
+    {{-18157234, -2515875, 8344033, -9704850, -15948824, -11956111, 4402884, -6579925, -2281899, 15954356},
+     {-21460875, 7653007, 7756053, -414321, -14307453, 6631249, -22447103, 5219807, -2194235, 12931729},
+     {-21425694, -16349890, -28226219, 4106805, -13114817, 9267486, -5723075, -12970842, -27848957, -8545688}},
+    {{31907294, -13468739, -28960470, -3191723, -779137, -8515737, 23400970, -1271502, -8047205, -11250797},
+     {-10904050, 3224922, 14676923, -9393782, 18421009, -11082627, -22325014, 12533847, -4189782, -7986283},
+     {-11173739, 14816855, 3207503, 2996543, -20080232, -2452992, -2668235, -14717169, 8348423, 13182917}}
+  },
+  {
+    {{11476243, -7406704, -27216401, -5282008, -30308315, 1284191, -7894899, 15327927, 4085242, 1652522},
+     {-30252873, 5715348, 16594838, -895549, 7588415, 8136338, -20266077, 2180244, 24945099, 15070917},
+     {4281926, 7871083, -12813132, -3167909, -26145086, 8620959, 30895191, -1412237, 4567028, -12433143}},
+    {{25185539, -16216017, 9682755, -6135229, -5192300, -15130426, 27694168, -15116306, -24034047, 5766535},
+     {23288591, -6328342, -20976527, -6639657, 14620307, 4976265, 23956924, -311897, 1396070, -5801282},
+     {-25713536, -7075913, -4421642, 15695713, 29552118, 1542629, 5495519, -592947, 25254996, -7697787}},
+    {{25979775, -9749933, -4506469, -8653351, 9324938, 47064, 26590441, 3730171, 31444300, 587530},
+     {20494629, 4055894, -13406590, -9394632, 25839450, -11574150, 28259883, -7791181, -28612109, 1011631},
+     {-22860482, 6403548, -11816647, -3206309, 32729994, 4488526, 6386042, -6933394, -11264355, 1894151}},
+    {{31331407, 14254822, -9167990, -14823116, -29479640, 14516554, -13722411, -12728535, -1292201, 11846395},
+     {16453460, -5949624, 8378253, -15350347, 9900577, 5704168, -28192047, -3124075, 29432830, -5083066},
+     {-14374236, 3690074, 675143, 10379782, 13231924, 16015813, -32498341, 14608361, 28884974, 846463}},
+    {{6124497, -10221521, 15710912, 12770982, -26787195, -3822168, -26313987, 62645, 4522656, -327278},
+     {19696852, -12080188, -29724631, 605208, -22634622, -16624522, -28973282, -14673822, -7617994, -12389284},
+     {30402812, 11909369, 24423604, -7539954, 28093013, 1392349, 16677689, -7022989, 23720058, -4110011}},
+    {{22869552, 15019951, 8386140, 5923500, 2413230, 3857423, 31178861, 2050111, -9333516, -6661958},
+     {-648846, 9313398, 5545200, -4057822, 32548296, -3616551, -8103278, -1300813, 18165712, 15993572},
+     {32544671, 11592008, 32159318, 10974770, 16445589, -13678373, 25856704, 11412806, -32157895, -9270850}},
+    {{24498413, 4649649, -3509712, -12200553, -3472035, -9847129, -27891808, -5678060, 2659997, -6741739},
+     {3467622, 45246, -14445146, -13766784, 28980752, -14204387, -32845495, -11472656, 26736207, -11075557},
+     {9305115, 4353218, -31925840, 4408188, 30037138, 5044380, -15505384, -5627499, -9522109, 5539030}},
+    {{13485311, -16694838, -26646378, -13721969, 3780628, -824407, 7543988, -962880, -16472551, -13333745},
+     {30116859, -15713270, -15801570, 10724719, 1206128, -1785734, -10699765, 963160, 19524485, 13651852},
+     {-33263820, 2413188, 31616108, 4297182, -5703321, 3634115, 23067855, 14732585, -24415443, 6397475}}
+  },
+  {
+    {{32305808, -13351389, -3846694, 14275858, 14054948, -14118134, -32831080, -12783304, 2202902, -10423998},
+     {11777178, 13027715, 12934784, -11779343, -25928467, 7345137, -16347595, 13744345, 13416906, -9181968},
+     {10019803, -11136837, -11508204, 9984721, -26911349, -6234649, -33294684, 2783269, -7288601, 8787593}},
+    {{1794661, -16153544, 20991280, 15449294, -27631172, -742980, 17973861, -7206849, 26446453, -7593900},
+     {-4966767, -8525926, 8246728, -11100570, 33311484, 6307876, -7639156, 289538, -4667715, 10251720},
+     {17458736, 6665743, 12141356, -991699, -11881150, 5043093, 6908220, -2552755, 15186593, -1958007}},
+    {{32844966, 7917544, 26429782, -739811, -31011082, 1892512, -7447789, -3498108, -14833120, -575007},
+     {30900784, -360635, 17778287, -7076107, -11361356, -2950526, -8165625, -3773597, -29119533, 272303},
+     {-1460730, -2189383, 3780212, -957865, -1524045, 1343301, -24135596, -16605569, 31295596, 4695324}},
+    {{-29720171, -10070821, -14556348, 6704653, -11843534, -8689096, 1331764, 11481223, -10676697, 16243362},
+     {32250863, -16055229, 14522414, 11029691, 14954539, 14327002, 21598285, -10227241, 33232427, -5520730},
+     {31484866, 11696123, 25711989, -1133353, -26217736, 6792259, -25527353, -9518965, 24594859, 5543420}},
+    {{18573799, 2834169, -31705080, 6653143, -3766734, 15322557, -22655378, -748529, 1026632, -12006534},
+     {-19954582, 8592606, -32293435, 12936229, 20810905, -6420696, -17682005, -2830613, -12299873, -2269794},
+     {-1412913, 9473425, -3484882, 7324166, 2749592, 3829953, -12725104, 8362376, -26335188, -5184795}},
+    {{-3053228, -5285107, -17574254, -4017747, -16767799, 6211780, -537487, 4736838, -28007532, 4620245},
+     {-32556445, -11096240, -2700934, -13108301, 11453618, -14046868, -471950, -14086897, -4710310, -4600486},
+     {-28781665, -9509822, 8619419, 6857564, 22760481, 5904120, 7464496, -12859654, -16818399, 12224011}},
+    {{-1046031, -11221126, 19680089, 1171913, -14888790, -2858912, 31952258, -8742587, -7356032, -2730512},
+     {23242914, 4115123, -4506056, -16757460, 11473432, -8232604, -9250920, 3468640, -3564772, 8120310},
+     {-20635693, -13701320, 14149130, 10264371, -33272554, -6117696, 5071713, -16288107, -10716719, 5328206}},
+    {{-6882024, 14671035, 12017712, 8955179, 25818693, -3395336, 8375774, -6862408, 19735539, 14961612},
+     {15029337, -15252798, -103395, 4422077, -18613474, -1330295, -28025914, -16735033, 18309985, 16123254},
+     {8593789, 11837261, 19318275, -15618521, 18917923, 13175582, 3564028, -16299983, 9345501, -158896}}
+  },
+  {
+    {{6241101, 8572046, 16299456, -477231, 7043202, 12101924, -13842733, -15166345, 26384670, 14406747},
+     {-30857648, -3016308, -7477276, 5015162, 24474945, -11859590, -21725808, 11221804, -30967043, -2296561},
+     {7890592, 14932782, -7814270, -149340, 29770168, -2547579, -11561452, 7246398, -21596346, 9586374}},
+    {{-12818646, -3795435, 7362316, 13082088, -13923277, -9870432, 7041161, -6184176, 19346696, 2404110},
+     {22821346, 7734872, -16389458, 14830385, 17107668, -5706411, -21946638, 6043917, -27555183, 14488435},
+     {25377224, 16744651, 17912244, -3291119, -28778530, 9633526, 17843836, 3634552, 8272728, 9418866}},
+    {{-9341726, -443706, 10832779, 265377, 1902353, 3374527, -27049758, -10930460, 17831970, -12614738},
+     {32045668, 14905231, -18003090, -9672180, -5989229, 12656872, -4781313, -1539844, 32032430, 6539265},
+     {-2637532, 5858601, -32466097, -11662453, -22243422, 10343035, 9337756, -13396963, 16547532, -7167575}},
+    {{30387034, -4284966, 19058595, 11280348, -28278483, 4358167, 18064499, -617144, -31859562, 976102},
+     {20079440, 9278103, -5653134, -714839, 12843291, 11080601, 21939691, 11875838, 21722163, 16094351},
+     {-29369706, 11005484, -29397107, -6052775, -8825673, 13923059, -14107968, -16742054, -17149241, -5104440}},
+    {{-5794484, 12608776, 10369051, -9830373, -31665226, 6428417, 6472250, -5011634, 2721393, 11293599},
+     {-32446280, 4578827, 16887621, -775953, -11063827, -10694200, -21137468, 12463008, -2305658, 12073930},
+     {-15587335, -10144960, 1115590, -6278201, 26979368, -12533455, -25177299, 3314382, 26131076, 2935896}},
+    {{11031675, -12022463, 5099592, 4517165, 32293559, 15776054, -17064172, -2832891, -17636202, 11239500},
+     {-740698, 8270583, -8862902, 1381493, 6560137, 10989217, 13676335, -768175, -4341242, 14463747},
+     {17546322, 4814624, -17509869, 9458660, 6869565, 15584704, 7011063, 14564844, 31488527, -3010331}},
+    {{-20172792, 9884713, -21445169, -15267305, 27613730, -9059481, 18320667, -5550345, 21455294, 11136844},
+     {-2625224, -110409, 14397092, 5765493, 9731137, 5077016, 15294589, -13980081, -8709176, -14452283},
+     {9216453, 11060898, -74812, -10671045, -7383142, 1557938, -4863238, -4535733, -20790112, -7509908}},
+    {{-7231387, 14044194, 14507764, 1889294, 14935233, 15842638, -28391623, 8847956, 19091033, -4791018},
+     {-17168174, -12156975, -4098311, 7136291, -13427932, -5779261, -16713770, -8087975, 8231381, -13111259},
+     {11034783, 12549555, -660515, 8797019, -10984279, -5029915, 31016300, -3758732, -33402893, 8821577}}
+  },
+  {
+    {{3939664, 5712038, 17675331, -4011938, -30018664, -14082242, 29072632, 13322010, -22161146, -2618165},
+     {5895949, -11915391, 6971190, -14931404, 7207125, -15622899, -27728491, -9041264, 14038511, -13541776},
+     {18604207, -10929, -21101215, -13388442, 876464, 6156662, -10836003, 15810080, 32371294, 7716184}},
+    {{-14829370, -10358861, -11993685, -5253524, -1546336, -10794249, 20827564, -3153820, -31839159, -3710413},
+     {22129501, 861671, -29738137, 9635058, -16963912, 5676918, -22196395, 11748367, -1994664, -4596207},
+     {-26288700, -11156549, 7517221, 7939697, 13899335, 16744581, -16338237, -244671, 29303015, -16047395}},
+    {{10666096, 2830004, 2512848, 12496756, 26515062, 7664761, -19856217, 6900186, -27449120, 2124096},
+     {-8561158, 16442355, 26491570, -15779346, 15596107, -10012903, 30498557, -10685992, 4981550, -14097564},
+     {-33159879, -7880088, 15453571, -6796690, 22993669, -1932838, -1045198, -4641881, 18553883, 14635476}},
+    {{1768758, 2063429, -14007999, -13849325, 22041207, 11378551, -11270654, 1533558, -8808700, 9634152},
+     {28989815, -7106236, 11551711, 2041440, 4325157, 6117290, -11636099, 14494334, 7024610, -14139531},
+     {5078206, -12156118, -6256963, 3987341, 28884427, 3919252, 6885953, -1545874, 26919821, 4290997}},
+    {{15399133, 6645563, -24453668, 7574922, -15513410, 15348741, 11613463, 3527338, 26268, 1298538},
+     {-17264175, 6950721, -14374541, 988938, -17545725, 6581720, -28822091, 14369456, -10428437, -10034202},
+     {-10636948, -15801753, -32251582, -8190895, 10543882, 12080353, 16691351, -6351575, 446227, -8733976}},
+    {{-6703339, -3027979, -13433451, -9440261, 2862045, -14521189, -28732997, 10487461, -3334535, -15656981},
+     {-6345721, 2213329, 10931206, -7151684, -1593084, 1831545, 12648235, 8272798, -27617808, -1218727},
+     {16763325, 4673102, 2833638, -16199422, 9361555, -1754993, 10078983, 12791413, 28459055, 16014176}},
+    {{-25650743, 851827, 4915431, -3786522, -18625392, -3245598, -26504782, 9164704, 24416234, 6646807},
+     {13657299, 11061091, -32427662, 9128878, 23365275, -12914849, -18926502, -9962964, -16078878, 13101575},
+     {-7035539, -12575717, 28295290, -4069668, 1236154, -2640950, -15726079, 9595411, -25832252, -14132583}},
+    {{1072952, -14386186, -13697409, -6051410, -9539771, -11776161, -9914294, 967599, 23727628, 6243597},
+     {3900475, 710394, -28192003, -11137569, 16103196, -11737451, 25117491, -2805132, 11555798, 10297883},
+     {-24875460, -13589319, 12351448, -12080292, 20930441, -305354, 8862708, 6378932, -19163609, 1151449}}
+  },
+  {
+    {{30526305, -16207948, 9912231, 11178716, 763935, 12997221, -6825276, 9428063, 9780770, -11045898},
+     {-12222341, 55037, -9236760, -8241871, 32611673, 16328377, -14165514, -8859283, 21096128, 15837088},
+     {18709324, -3689207, -20297305, -5789376, -19874298, -12922552, 8143142, -7541949, -33298346, -8989495}},
+    {{-1272470, 4587312, 7823775, -16523749, -13164672, -4627991, 25899521, 3628276, -29167376, -16534655},
+     {-11472608, -3034287, 14443374, -15170078, 17973452, 8208609, 23910348, 11546655, -19349311, -13848663},
+     {-23188571, 11285442, -25106610, -39583, -6387178, 14175661, 28855059, 1370906, -9278852, -10367399}},
+    {{6142754, 7957897, -27392772, 6671310, 19329934, 3513389, 32870210, 8163286, 20977124, 15125824},
+     {-9616727, -8319228, 10375775, -5593630, -27002334, -6595111, 31271621, -834574, -10342829, -2179208},
+     {32682236, -15611114, -16860200, 6555415, 28223396, 846546, -18648590, 5404993, 24369684, 8792437}},
+    {{18383195, 15008157, 2763760, 11085497, -30654185, -15704262, -33294069, -1826077, 9666248, -13859951},
+     {-16591192, 11459730, -28359960, -11671918, -5107398, 12738963, -13625075, -5054107, -19263651, 15430032},
+     {-13794919, 5841957, -22981817, -1488504, 15150117, 11981282, 29460687, 1538238, 12528991, -16643210}},
+    {{3368840, 11325776, 5562545, 7562924, 31159303, -8293081, 21911750, -1642196, 3642715, 10354878},
+     {16876865, 5861265, 22471953, -2063960, 9511824, 15438797, -20668505, 2626192, -14651220, -6909064},
+     {-17035433, -10714702, -3819158, 14021768, 20971160, 10099757, -20099445, -7651759, -31026047, 10789695}},
+    {{4525558, 7104939, -27276113, 13632079, -17813509, -13504253, -6439646, -15096634, 32222291, 1591414},
+     {22970279, -4827668, 26743044, -15973307, 31509423, 7354884, -14797837, 3709798, 18854811, -7294517},
+     {-4730253, 3895118, 4668738, 8908301, 8786139, 8867706, 1937581, 14539777, -23257328, 4062083}},
+    {{13974168, 15694507, 30439475, -3046188, 33096940, 1277192, -31931940, -4904232, 7457138, -8455767},
+     {728506, -2803788, 11222208, -1372145, -27171254, 8545557, 7067397, 13084747, -32856560, 13336084},
+     {-8239024, 9754105, -18648548, 11721319, -21268233, -1062762, -32352839, 4270789, -5315465, -3844661}},
+    {{11553454, -14197121, 30699139, 7140243, -6024422, -13045573, 17129123, 13516336, -9820115, 10100777},
+     {-22552368, -11112803, -2767422, -15079034, 16512792, -6815068, -20448129, 1901416, 142426, 2723200},
+     {26269676, -477830, 33551015, -14677382, -23148599, 9207617, -21160194, -7941682, 31552126, -5651183}}
+  },
+  {
+    {{-26171765, -9849767, -24850121, 1333662, 10862903, 6312283, 5445731, 4840157, 3249200, -16339046},
+     {-6105643, -12706718, 21164561, -7783684, 13729165, -9257026, -233861, 859102, -13941008, 12978029},
+     {-1893979, -2431340, -33477518, -4868858, 11484623, -8198911, 95391, 11594527, 25751101, 998192}},
+    {{11115726, 13704930, -1608143, -14896332, 8418499, -11001567, 6219741, -4205670, 30189756, -15961956},
+     {8811378, -134672, 17392490, -9051694, 6535692, -6733728, 3404042, 10487467, 19335116, -12872394},
+     {16137777, 3333047, 33448241, -10623792, 27859863, -9902353, 11406652, -12128437, 25259456, 4304656}},
+    {{22236975, -6503556, -5954034, -15171139, -21931632, 2288886, -22223685, 16250601, -3453322, 16027176},
+     {19268454, 15250422, -20204583, -2070587, 16617736, 5324668, -22503124, -4001981, 16412514, -11056828},
+     {8381443, -6232497, -11904555, 13496051, -8444313, -11186469, 20994058, -6230165, -801412, -15323239}},
+    {{-23245105, -9006205, 5520246, 3715791, 15012708, 9481940, 26056737, -10077162, 11992902, -3235474},
+     {22768359, 1091475, 6576688, -6387430, 3587570, 7673930, -32177279, 11146678, 14527955, 12585263},
+     {27811239, 15616350, -32240399, -5389177, -26208591, -6241421, -15743337, -1107706, 11317022, -3011441}},
+    {{-20740665, 10948738, 21039471, 1797553, 9324988, -3136757, 32009462, 9735733, -7900763, 9353241},
+     {26407586, 5571433, 8595672, -15557873, -33325084, -12304173, -5745015, 825218, 5885320, 3417184},
+     {12388237, 6116491, -8457610, 3137955, 30458895, -13242726, 1972932, 2208929, -4497717, 11594945}},
+    {{-17480671, -4366167, -18204968, 12882181, -33020424, 5946981, 27965122, 1555716, -14427638, 2386312},
+     {-19510827, -1550706, -9542753, 9007358, -3760299, 4643873, 8190592, -15510604, 28630980, 14774960},
+     {17835307, 14602409, 17361775, -10504970, -14969037, -5783395, 26580518, -2171260, 11871561, -12503163}},
+    {{-8717181, -16734525, 29482188, 9476476, -2297507, -3261282, 27725282, 2543777, 13419914, 3029682},
+     {7467750, 14690104, 24985150, -14610735, -10519992, 1558601, 9498818, 4312619, -25320942, -2344174},
+     {-23341760, 7660358, 28763288, -11900417, 20581954, -16565750, 17311584, -5465123, 13709591, -7813382}},
+    {{-22474559, -9775872, 9979593, -6009841, -2288629, 4460809, -20203445, 2587288, 4822268, -15914442},
+     {-15622984, 16630219, -20008931, -2316223, -5552202, -14579393, 10940510, -8583086, -17074839, -8785749},
+     {11991854, -323802, -16544536, -5546199, -1080202, -14548366, -12058677, 2619729, 17577368, -7959372}}
+  },
+  {
+    {{-10286928, 5863751, 24819839, -3359809, 22685243, 8668428, 4333488, -12439900, -26662998, 9765491},
+     {9485223, 4635504, -1342389, 924712, -13910599, 15881090, 1225773, 4445275, -18841782, 11244362},
+     {-15398638, -8255456, 31497898, 3553347, 15454652, 5071419, 4495808, 852964, 31701964, -13006870}},
+    {{-9174156, -10939635, -29921688, -1291585, -33385601, 1431557, -591194, 6358916, 3874380, 5456256},
+     {30937097, 15154860, -17546795, 13038174, -1038243, 2741942, 9440070, 8211005, 27114608, 3099760},
+     {-22593146, 4842992, -28800031, -5110088, -8813356, -3809968, -24101791, -3670670, -33432052, 13577425}},
+    {{32027722, -14450632, 17203594, 4340103, 12230934, 8102829, 19827816, -15858969, 27343400, -10937292},
+     {-13279203, 1706844, 5635136, -14571528, -15908460, -1703233, -25664299, 16608939, -31491030, 2258466},
+     {-25806435, -12880232, -26798671, 4768388, -14552258, 758123, -9793050, -14036604, 29370678, 14877426}},
+    {{-31778110, 9937098, 18185209, -9263999, -16503063, -9096519, -11531178, 16017089, -8497006, -432391},
+     {-33188219, -15370285, 16777182, 4298700, -10377179, 5476959, -20984256, -8077060, 14943017, -16294124},
+     {-31500346, 4117707, 7830302, 226806, 11521408, 8592261, 6289224, 1001460, 29360258, -13853309}},
+    {{5872082, -4304762, -5528775, 12591154, -4271966, 7606715, 22416423, 12357081, -11749257, -1789453},
+     {-22872825, 11969526, 31171636, -9115604, 21881204, -1249809, -11543861, -1098584, -31446295, 5483516},
+     {-13844248, 5637726, 12482792, -6433144, -27370840, 12707337, -216822, -13992862, 3070215, 962399}},
+    {{983082, 2815907, 5909933, -16769585, 26026458, -2698861, 23188360, 15470762, -1855901, -476338},
+     {7553204, 7900154, -29764317, -3160128, -11031293, -15890028, 1187400, -10628757, 14159803, 3037222},
+     {30724173, 5546876, -25339787, 6482116, 4191846, 14688781, 31121390, -7954751, 29603223, 546506}},
+    {{3195057, 890916, -29818339, -2031221, 25963324, -8195044, -19627475, -14685071, 19177335, 8951632},
+     {-24107078, -7635746, 15147467, -8182006, -30108896, 15341508, 6382867, -10375808, 30505259, -16700229},
+     {1197368, -14102167, -14968886, 14112011, 31508209, -14882858, 12060611, 12607889, -8069971, -15783697}},
+    {{-3912237, -15762635, -18588163, -3642364, -5027028, 11615911, -4100957, -6863004, -7828193, 3822685},
+     {-9965867, 736384, 16696364, -6812898, 21827263, 9562889, -13020349, -2137346, 15805979, 9703961},
+     {-4418017, 9953846, -5019311, -1814762, -10275208, 8664654, -23579453, -14577570, 3443216, -2199328}}
+  },
+  {
+    {{-29757103, 11552286, -29171871, -8865124, 3550467, -9704439, -13567666, -3449763, 5370292, -12693263},
+     {-14404091, 16602377, 7656628, -4776042, -1104959, 8746668, 12221810, -10553084, -14332664, -13010636},
+     {-16734334, 12410768, 12472561, 10154264, 27566992, -4256173, 1332817, -16242737, 150358, 153066}},
+    {{32866981, -4830516, -22851074, -10322740, 20465835, 6770442, -7542420, -6913143, 23362042, -8657902},
+     {2694705, 7110824, 31787018, -1372789, 30410934, 4377862, 32626242, 12830002, 18695034, -9954676},
+     {32853408, 10167960, 23154879, -8864933, -3259860, 657283, 13298577, 14968584, 11610985, -13913251}},
+    {{-16382777, 4942556, 15916369, 5384485, -15110311, -13748963, 5211707, -5128628, -10834480, -10241919},
+     {-1221658, 6675935, -28744718, 13071990, 10880296, 3559817, -11725180, 13048333, 19987922, 307541},
+     {-12619350, 9703839, 29028606, 12251913, -1216279, 979199, -18058926, -2006805, 31495141, 2705517}},
+    {{22453185, -7943019, 25309182, -14087062, -26533146, 6159115, -14152736, 16349060, -16814254, 10130381},
+     {-27618824, -1539239, 28941041, 8485921, -24992171, 262775, 23032716, -3915544, -16879584, 12611008},
+     {5503548, -14325845, 806701, 13975375, -24863079, -13813024, 6488201, -9938623, -19717736, 5484901}},
+    {{969545, 8657697, -8556248, -14361580, 14872974, -6910549, 13728991, -3929265, 15665055, -11207258},
+     {26718379, 4795370, -7320424, -11366766, -20382783, 10654067, 20301180, -9571739, -10329838, 11348902},
+     {19854831, 13411464, 15792922, -14683245, 28955759, 6368069, 10376150, -5285019, 25734803, 13574790}},
+    {{-6767492, 14218289, 8383722, 16627549, 8078649, -1525884, 18688817, -289676, -21682382, -203478},
+     {-21971500, 11542932, -23971816, -14362164, -29558996, 15601305, -14260064, -5397801, -33194586, -5284019},
+     {32518366, -11115377, 14041406, 4147477, 8731177, 2624461, -28913220, 336469, 15599186, -14615872}},
+    {{-5562939, -10158700, 19220330, 12862537, -26908467, 7539227, 32617786, 6576169, -9275984, -1396086},
+     {-7001035, 15800466, -8319446, -6725606, -5665007, -9225024, 21019848, -9234441, 29067432, -15187738},
+     {-5466415, 11752415, -7607574, -16123974, 4443882, -916328, 31203847, -3229732, -32858551, -7765613}},
+    {{5041587, -12366207, -20818550, -5083921, 21388919, 5920553, -20149162, 5278297, -15864706, -12977520},
+     {29496779, -4411912, 6252319, -14532813, 14900028, 4857731, 4934166, -2868514, 16615004, -11022470},
+     {-10152, -3615821, 15293437, -8115062, 20450817, 13722415, -17814732, -2419456, 16065468, -2589563}}
+  }
+};
+
 /* A = 2 * (1 - d) / (1 + d) = 486662 */
 const fe fe_ma2 = {-12721188, -3529, 0, 0, 0, 0, 0, 0, 0, 0}; /* -A^2 */
 const fe fe_ma = {-486662, 0, 0, 0, 0, 0, 0, 0, 0, 0}; /* -A */
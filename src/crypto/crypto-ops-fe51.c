@@ -0,0 +1,767 @@
+// Copyright (c) 2014-2019, The Monero Project
+// 
+// All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without modification, are
+// permitted provided that the following conditions are met:
+// 
+// 1. Redistributions of source code must retain the above copyright notice, this list of
+//    conditions and the following disclaimer.
+// 
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list
+//    of conditions and the following disclaimer in the documentation and/or other
+//    materials provided with the distribution.
+// 
+// 3. Neither the name of the copyright holder nor the names of its contributors may be
+//    used to endorse or promote products derived from this software without specific
+//    prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL
+// THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+/*
+Radix 2^51 field arithmetic backend for the hot group routines of crypto-ops.c.
+
+On 64 bit targets with a 64x64->128 bit multiplier, five 51 bit limbs need
+25 wide multiplications per fe_mul where ref10 needs 100 narrow ones. Points
+are converted from/to the ref10 representation at the entry/exit of each
+routine only, so callers get the same points as with ref10.
+*/
+
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "crypto-ops.h"
+
+/* Backend selection */
+
+/* Read on every group operation from any thread, so atomic; relaxed is enough as
+   it guards no other data */
+static atomic_int crypto_ops_backend_selected = -1;
+
+enum crypto_ops_backend crypto_ops_get_backend(void) {
+  const char *env;
+  int expected = -1;
+  int backend = atomic_load_explicit(&crypto_ops_backend_selected, memory_order_relaxed);
+
+  if (backend != -1)
+    return (enum crypto_ops_backend) backend;
+
+  env = getenv("MONERO_CRYPTO_OPS_BACKEND");
+  if (!CRYPTO_OPS_HAVE_FE51 || (env && !strcmp(env, "ref10")))
+    backend = CRYPTO_OPS_BACKEND_REF10;
+  else
+    backend = CRYPTO_OPS_BACKEND_FE51;
+  /* Only the first caller sets the default, so it can't undo a crypto_ops_set_backend */
+  if (!atomic_compare_exchange_strong_explicit(&crypto_ops_backend_selected, &expected, backend, memory_order_relaxed, memory_order_relaxed))
+    backend = expected;
+  return (enum crypto_ops_backend) backend;
+}
+
+int crypto_ops_set_backend(enum crypto_ops_backend backend) {
+  if (backend != CRYPTO_OPS_BACKEND_REF10 && (backend != CRYPTO_OPS_BACKEND_FE51 || !CRYPTO_OPS_HAVE_FE51))
+    return -1;
+  atomic_store_explicit(&crypto_ops_backend_selected, backend, memory_order_relaxed);
+  return 0;
+}
+
+#if CRYPTO_OPS_HAVE_FE51
+
+typedef unsigned __int128 uint128_t;
+
+typedef uint64_t fe51[5];
+
+typedef struct {
+  fe51 X;
+  fe51 Y;
+  fe51 Z;
+} ge51_p2;
+
+typedef struct {
+  fe51 X;
+  fe51 Y;
+  fe51 Z;
+  fe51 T;
+} ge51_p3;
+
+typedef struct {
+  fe51 X;
+  fe51 Y;
+  fe51 Z;
+  fe51 T;
+} ge51_p1p1;
+
+typedef struct {
+  fe51 yplusx;
+  fe51 yminusx;
+  fe51 xy2d;
+} ge51_precomp;
+
+typedef struct {
+  fe51 YplusX;
+  fe51 YminusX;
+  fe51 Z;
+  fe51 T2d;
+} ge51_cached;
+
+typedef ge51_cached ge51_dsmp[8];
+
+#define FE51_MASK ((((uint64_t) 1) << 51) - 1)
+
+/* 4 * p, added before subtracting so limbs stay positive */
+#define FE51_4P0 0x1fffffffffffb4
+#define FE51_4P1 0x1ffffffffffffc
+
+/* Ed25519 base point multiples B, 3B, ..., 15B, as ge_Bi */
+static const ge51_precomp ge51_Bi[8] = {
+  {
+    { 0x493c6f58c3b85, 0xdf7181c325f7, 0xf50b0b3e4cb7, 0x5329385a44c32, 0x7cf9d3a33d4b },
+    { 0x3905d740913e, 0xba2817d673a2, 0x23e2827f4e67c, 0x133d2e0c21a34, 0x44fd2f9298f81 },
+    { 0x11205877aaa68, 0x479955893d579, 0x50d66309b67a0, 0x2d42d0dbee5ee, 0x6f117b689f0c6 }
+  },
+  {
+    { 0x5b0a84cee9730, 0x61d10c97155e4, 0x4059cc8096a10, 0x47a608da8014f, 0x7a164e1b9a80f },
+    { 0x11fe8a4fcd265, 0x7bcb8374faacc, 0x52f5af4ef4d4f, 0x5314098f98d10, 0x2ab91587555bd },
+    { 0x6933f0dd0d889, 0x44386bb4c4295, 0x3cb6d3162508c, 0x26368b872a2c6, 0x5a2826af12b9b }
+  },
+  {
+    { 0x2bc4408a5bb33, 0x78ebdda05442, 0x2ffb112354123, 0x375ee8df5862d, 0x2945ccf146e20 },
+    { 0x182c3a447d6ba, 0x22964e536eff2, 0x192821f540053, 0x2f9f19e788e5c, 0x154a7e73eb1b5 },
+    { 0x3dbf1812a8285, 0xfa17ba3f9797, 0x6f69cb49c3820, 0x34d5a0db3858d, 0x43aabe696b3bb }
+  },
+  {
+    { 0x25cd0944ea3bf, 0x75673b81a4d63, 0x150b925d1c0d4, 0x13f38d9294114, 0x461bea69283c9 },
+    { 0x72c9aaa3221b1, 0x267774474f74d, 0x64b0e9b28085, 0x3f04ef53b27c9, 0x1d6edd5d2e531 },
+    { 0x36dc801b8b3a2, 0xe0a7d4935e30, 0x1deb7cecc0d7d, 0x53a94e20dd2c, 0x7a9fbb1c6a0f9 }
+  },
+  {
+    { 0x6678aa6a8632f, 0x5ea3788d8b365, 0x21bd6d6994279, 0x7ace75919e4e3, 0x34b9ed338add7 },
+    { 0x6217e039d8064, 0x6dea408337e6d, 0x57ac112628206, 0x647cb65e30473, 0x49c05a51fadc9 },
+    { 0x4e8bf9045af1b, 0x514e33a45e0d6, 0x7533c5b8bfe0f, 0x583557b7e14c9, 0x73c172021b008 }
+  },
+  {
+    { 0x700848a802ade, 0x1e04605c4e5f7, 0x5c0d01b9767fb, 0x7d7889f42388b, 0x4275aae2546d8 },
+    { 0x75b0249864348, 0x52ee11070262b, 0x237ae54fb5acd, 0x3bfd1d03aaab5, 0x18ab598029d5c },
+    { 0x32cc5fd6089e9, 0x426505c949b05, 0x46a18880c7ad2, 0x4a4221888ccda, 0x3dc65522b53df }
+  },
+  {
+    { 0xc222a2007f6d, 0x356b79bdb77ee, 0x41ee81efe12ce, 0x120a9bd07097d, 0x234fd7eec346f },
+    { 0x7013b327fbf93, 0x1336eeded6a0d, 0x2b565a2bbf3af, 0x253ce89591955, 0x267882d17602 },
+    { 0xa119732ea378, 0x63bf1ba8e2a6c, 0x69f94cc90df9a, 0x431d1779bfc48, 0x497ba6fdaa097 }
+  },
+  {
+    { 0x6cc0313cfeaa0, 0x1a313848da499, 0x7cb534219230a, 0x39596dedefd60, 0x61e22917f12de },
+    { 0x3cd86468ccf0b, 0x48553221ac081, 0x6c9464b4e0a6e, 0x75fba84180403, 0x43b5cd4218d05 },
+    { 0x2762f9bd0b516, 0x1c6e7fbddcbb3, 0x75909c3ace2bd, 0x42101972d3ec9, 0x511d61210ae4d }
+  }
+};
+
+/* 2 * d */
+static const fe51 fe51_d2 = {
+  0x69b9426b2f159, 0x35050762add7a, 0x3cf44c0038052, 0x6738cc7407977, 0x2406d9dc56dff
+};
+
+/* Field elements */
+
+static void fe51_0(fe51 h) {
+  h[0] = 0; h[1] = 0; h[2] = 0; h[3] = 0; h[4] = 0;
+}
+
+static void fe51_1(fe51 h) {
+  h[0] = 1; h[1] = 0; h[2] = 0; h[3] = 0; h[4] = 0;
+}
+
+static void fe51_copy(fe51 h, const fe51 f) {
+  h[0] = f[0]; h[1] = f[1]; h[2] = f[2]; h[3] = f[3]; h[4] = f[4];
+}
+
+/* Limbs of the result may exceed 2^51 by one bit; fe51_mul and fe51_sub accept that */
+static void fe51_add(fe51 h, const fe51 f, const fe51 g) {
+  h[0] = f[0] + g[0];
+  h[1] = f[1] + g[1];
+  h[2] = f[2] + g[2];
+  h[3] = f[3] + g[3];
+  h[4] = f[4] + g[4];
+}
+
+static void fe51_carry(fe51 h) {
+  h[1] += h[0] >> 51; h[0] &= FE51_MASK;
+  h[2] += h[1] >> 51; h[1] &= FE51_MASK;
+  h[3] += h[2] >> 51; h[2] &= FE51_MASK;
+  h[4] += h[3] >> 51; h[3] &= FE51_MASK;
+  h[0] += 19 * (h[4] >> 51); h[4] &= FE51_MASK;
+}
+
+/* g must have limbs below 2^53 */
+static void fe51_sub(fe51 h, const fe51 f, const fe51 g) {
+  h[0] = f[0] + FE51_4P0 - g[0];
+  h[1] = f[1] + FE51_4P1 - g[1];
+  h[2] = f[2] + FE51_4P1 - g[2];
+  h[3] = f[3] + FE51_4P1 - g[3];
+  h[4] = f[4] + FE51_4P1 - g[4];
+  fe51_carry(h);
+}
+
+static void fe51_neg(fe51 h, const fe51 f) {
+  fe51 zero;
+  fe51_0(zero);
+  fe51_sub(h, zero, f);
+}
+
+static void fe51_cmov(fe51 f, const fe51 g, unsigned int b) {
+  uint64_t mask = -(uint64_t) b;
+  f[0] ^= mask & (f[0] ^ g[0]);
+  f[1] ^= mask & (f[1] ^ g[1]);
+  f[2] ^= mask & (f[2] ^ g[2]);
+  f[3] ^= mask & (f[3] ^ g[3]);
+  f[4] ^= mask & (f[4] ^ g[4]);
+}
+
+static void fe51_reduce(fe51 h, uint128_t r0, uint128_t r1, uint128_t r2, uint128_t r3, uint128_t r4) {
+  uint64_t c;
+  r1 += (uint64_t) (r0 >> 51); h[0] = (uint64_t) r0 & FE51_MASK;
+  r2 += (uint64_t) (r1 >> 51); h[1] = (uint64_t) r1 & FE51_MASK;
+  r3 += (uint64_t) (r2 >> 51); h[2] = (uint64_t) r2 & FE51_MASK;
+  r4 += (uint64_t) (r3 >> 51); h[3] = (uint64_t) r3 & FE51_MASK;
+  c = (uint64_t) (r4 >> 51); h[4] = (uint64_t) r4 & FE51_MASK;
+  h[0] += c * 19;
+  h[1] += h[0] >> 51; h[0] &= FE51_MASK;
+}
+
+/* Inputs must have limbs below 2^54 */
+static void fe51_mul(fe51 h, const fe51 f, const fe51 g) {
+  const uint64_t f0 = f[0], f1 = f[1], f2 = f[2], f3 = f[3], f4 = f[4];
+  const uint64_t g0 = g[0], g1 = g[1], g2 = g[2], g3 = g[3], g4 = g[4];
+  const uint64_t g1_19 = 19 * g1, g2_19 = 19 * g2, g3_19 = 19 * g3, g4_19 = 19 * g4;
+  uint128_t r0, r1, r2, r3, r4;
+
+  r0 = (uint128_t) f0 * g0 + (uint128_t) f1 * g4_19 + (uint128_t) f2 * g3_19 + (uint128_t) f3 * g2_19 + (uint128_t) f4 * g1_19;
+  r1 = (uint128_t) f0 * g1 + (uint128_t) f1 * g0 + (uint128_t) f2 * g4_19 + (uint128_t) f3 * g3_19 + (uint128_t) f4 * g2_19;
+  r2 = (uint128_t) f0 * g2 + (uint128_t) f1 * g1 + (uint128_t) f2 * g0 + (uint128_t) f3 * g4_19 + (uint128_t) f4 * g3_19;
+  r3 = (uint128_t) f0 * g3 + (uint128_t) f1 * g2 + (uint128_t) f2 * g1 + (uint128_t) f3 * g0 + (uint128_t) f4 * g4_19;
+  r4 = (uint128_t) f0 * g4 + (uint128_t) f1 * g3 + (uint128_t) f2 * g2 + (uint128_t) f3 * g1 + (uint128_t) f4 * g0;
+
+  fe51_reduce(h, r0, r1, r2, r3, r4);
+}
+
+static void fe51_sq(fe51 h, const fe51 f) {
+  const uint64_t f0 = f[0], f1 = f[1], f2 = f[2], f3 = f[3], f4 = f[4];
+  const uint64_t f0_2 = 2 * f0, f1_2 = 2 * f1;
+  const uint64_t f3_19 = 19 * f3, f4_19 = 19 * f4;
+  uint128_t r0, r1, r2, r3, r4;
+
+  r0 = (uint128_t) f0 * f0 + (uint128_t) (2 * f1) * f4_19 + (uint128_t) (2 * f2) * f3_19;
+  r1 = (uint128_t) f0_2 * f1 + (uint128_t) (2 * f2) * f4_19 + (uint128_t) f3 * f3_19;
+  r2 = (uint128_t) f0_2 * f2 + (uint128_t) f1 * f1 + (uint128_t) (2 * f3) * f4_19;
+  r3 = (uint128_t) f0_2 * f3 + (uint128_t) f1_2 * f2 + (uint128_t) f4 * f4_19;
+  r4 = (uint128_t) f0_2 * f4 + (uint128_t) f1_2 * f3 + (uint128_t) f2 * f2;
+
+  fe51_reduce(h, r0, r1, r2, r3, r4);
+}
+
+static void fe51_sq2(fe51 h, const fe51 f) {
+  fe51_sq(h, f);
+  fe51_add(h, h, h);
+}
+
+/* Conversions from/to ref10 limbs */
+
+/* ref10 limbs alternate 26 and 25 bits, so each pair makes a 51 bit limb */
+static void fe51_from_fe(fe51 h, const fe f) {
+  h[0] = (uint64_t) ((int64_t) f[0] + (int64_t) f[1] * ((int64_t) 1 << 26) + FE51_4P0);
+  h[1] = (uint64_t) ((int64_t) f[2] + (int64_t) f[3] * ((int64_t) 1 << 26) + FE51_4P1);
+  h[2] = (uint64_t) ((int64_t) f[4] + (int64_t) f[5] * ((int64_t) 1 << 26) + FE51_4P1);
+  h[3] = (uint64_t) ((int64_t) f[6] + (int64_t) f[7] * ((int64_t) 1 << 26) + FE51_4P1);
+  h[4] = (uint64_t) ((int64_t) f[8] + (int64_t) f[9] * ((int64_t) 1 << 26) + FE51_4P1);
+  fe51_carry(h);
+}
+
+/* Carried as in fe_frombytes, so limbs are within the bounds ref10 expects of its inputs */
+static void fe_from_fe51(fe h, const fe51 f) {
+  uint64_t t[5];
+  int64_t h0, h1, h2, h3, h4, h5, h6, h7, h8, h9;
+  int64_t carry0, carry1, carry2, carry3, carry4, carry5, carry6, carry7, carry8, carry9;
+
+  fe51_copy(t, f);
+  fe51_carry(t);
+
+  h0 = t[0] & 0x3ffffff; h1 = t[0] >> 26;
+  h2 = t[1] & 0x3ffffff; h3 = t[1] >> 26;
+  h4 = t[2] & 0x3ffffff; h5 = t[2] >> 26;
+  h6 = t[3] & 0x3ffffff; h7 = t[3] >> 26;
+  h8 = t[4] & 0x3ffffff; h9 = t[4] >> 26;
+
+  carry9 = (h9 + (int64_t) (1<<24)) >> 25; h0 += carry9 * 19; h9 -= carry9 << 25;
+  carry1 = (h1 + (int64_t) (1<<24)) >> 25; h2 += carry1; h1 -= carry1 << 25;
+  carry3 = (h3 + (int64_t) (1<<24)) >> 25; h4 += carry3; h3 -= carry3 << 25;
+  carry5 = (h5 + (int64_t) (1<<24)) >> 25; h6 += carry5; h5 -= carry5 << 25;
+  carry7 = (h7 + (int64_t) (1<<24)) >> 25; h8 += carry7; h7 -= carry7 << 25;
+
+  carry0 = (h0 + (int64_t) (1<<25)) >> 26; h1 += carry0; h0 -= carry0 << 26;
+  carry2 = (h2 + (int64_t) (1<<25)) >> 26; h3 += carry2; h2 -= carry2 << 26;
+  carry4 = (h4 + (int64_t) (1<<25)) >> 26; h5 += carry4; h4 -= carry4 << 26;
+  carry6 = (h6 + (int64_t) (1<<25)) >> 26; h7 += carry6; h6 -= carry6 << 26;
+  carry8 = (h8 + (int64_t) (1<<25)) >> 26; h9 += carry8; h8 -= carry8 << 26;
+
+  h[0] = (int32_t) h0;
+  h[1] = (int32_t) h1;
+  h[2] = (int32_t) h2;
+  h[3] = (int32_t) h3;
+  h[4] = (int32_t) h4;
+  h[5] = (int32_t) h5;
+  h[6] = (int32_t) h6;
+  h[7] = (int32_t) h7;
+  h[8] = (int32_t) h8;
+  h[9] = (int32_t) h9;
+}
+
+static void ge51_from_p3(ge51_p3 *r, const ge_p3 *p) {
+  fe51_from_fe(r->X, p->X);
+  fe51_from_fe(r->Y, p->Y);
+  fe51_from_fe(r->Z, p->Z);
+  fe51_from_fe(r->T, p->T);
+}
+
+static void ge51_from_cached(ge51_cached *r, const ge_cached *p) {
+  fe51_from_fe(r->YplusX, p->YplusX);
+  fe51_from_fe(r->YminusX, p->YminusX);
+  fe51_from_fe(r->Z, p->Z);
+  fe51_from_fe(r->T2d, p->T2d);
+}
+
+static void ge51_from_dsmp(ge51_dsmp r, const ge_dsmp p) {
+  int i;
+  for (i = 0; i < 8; ++i)
+    ge51_from_cached(&r[i], &p[i]);
+}
+
+static void ge_from_p2(ge_p2 *r, const ge51_p2 *p) {
+  fe_from_fe51(r->X, p->X);
+  fe_from_fe51(r->Y, p->Y);
+  fe_from_fe51(r->Z, p->Z);
+}
+
+static void ge_from_p3(ge_p3 *r, const ge51_p3 *p) {
+  fe_from_fe51(r->X, p->X);
+  fe_from_fe51(r->Y, p->Y);
+  fe_from_fe51(r->Z, p->Z);
+  fe_from_fe51(r->T, p->T);
+}
+
+static void ge_from_cached(ge_cached *r, const ge51_cached *p) {
+  fe_from_fe51(r->YplusX, p->YplusX);
+  fe_from_fe51(r->YminusX, p->YminusX);
+  fe_from_fe51(r->Z, p->Z);
+  fe_from_fe51(r->T2d, p->T2d);
+}
+
+/* Group operations, as their ref10 counterparts */
+
+static void ge51_p2_0(ge51_p2 *h) {
+  fe51_0(h->X);
+  fe51_1(h->Y);
+  fe51_1(h->Z);
+}
+
+static void ge51_add(ge51_p1p1 *r, const ge51_p3 *p, const ge51_cached *q) {
+  fe51 t0;
+  fe51_add(r->X, p->Y, p->X);
+  fe51_sub(r->Y, p->Y, p->X);
+  fe51_mul(r->Z, r->X, q->YplusX);
+  fe51_mul(r->Y, r->Y, q->YminusX);
+  fe51_mul(r->T, q->T2d, p->T);
+  fe51_mul(r->X, p->Z, q->Z);
+  fe51_add(t0, r->X, r->X);
+  fe51_sub(r->X, r->Z, r->Y);
+  fe51_add(r->Y, r->Z, r->Y);
+  fe51_add(r->Z, t0, r->T);
+  fe51_sub(r->T, t0, r->T);
+}
+
+static void ge51_sub(ge51_p1p1 *r, const ge51_p3 *p, const ge51_cached *q) {
+  fe51 t0;
+  fe51_add(r->X, p->Y, p->X);
+  fe51_sub(r->Y, p->Y, p->X);
+  fe51_mul(r->Z, r->X, q->YminusX);
+  fe51_mul(r->Y, r->Y, q->YplusX);
+  fe51_mul(r->T, q->T2d, p->T);
+  fe51_mul(r->X, p->Z, q->Z);
+  fe51_add(t0, r->X, r->X);
+  fe51_sub(r->X, r->Z, r->Y);
+  fe51_add(r->Y, r->Z, r->Y);
+  fe51_sub(r->Z, t0, r->T);
+  fe51_add(r->T, t0, r->T);
+}
+
+static void ge51_madd(ge51_p1p1 *r, const ge51_p3 *p, const ge51_precomp *q) {
+  fe51 t0;
+  fe51_add(r->X, p->Y, p->X);
+  fe51_sub(r->Y, p->Y, p->X);
+  fe51_mul(r->Z, r->X, q->yplusx);
+  fe51_mul(r->Y, r->Y, q->yminusx);
+  fe51_mul(r->T, q->xy2d, p->T);
+  fe51_add(t0, p->Z, p->Z);
+  fe51_sub(r->X, r->Z, r->Y);
+  fe51_add(r->Y, r->Z, r->Y);
+  fe51_add(r->Z, t0, r->T);
+  fe51_sub(r->T, t0, r->T);
+}
+
+static void ge51_msub(ge51_p1p1 *r, const ge51_p3 *p, const ge51_precomp *q) {
+  fe51 t0;
+  fe51_add(r->X, p->Y, p->X);
+  fe51_sub(r->Y, p->Y, p->X);
+  fe51_mul(r->Z, r->X, q->yminusx);
+  fe51_mul(r->Y, r->Y, q->yplusx);
+  fe51_mul(r->T, q->xy2d, p->T);
+  fe51_add(t0, p->Z, p->Z);
+  fe51_sub(r->X, r->Z, r->Y);
+  fe51_add(r->Y, r->Z, r->Y);
+  fe51_sub(r->Z, t0, r->T);
+  fe51_add(r->T, t0, r->T);
+}
+
+static void ge51_p1p1_to_p2(ge51_p2 *r, const ge51_p1p1 *p) {
+  fe51_mul(r->X, p->X, p->T);
+  fe51_mul(r->Y, p->Y, p->Z);
+  fe51_mul(r->Z, p->Z, p->T);
+}
+
+static void ge51_p1p1_to_p3(ge51_p3 *r, const ge51_p1p1 *p) {
+  fe51_mul(r->X, p->X, p->T);
+  fe51_mul(r->Y, p->Y, p->Z);
+  fe51_mul(r->Z, p->Z, p->T);
+  fe51_mul(r->T, p->X, p->Y);
+}
+
+static void ge51_p2_dbl(ge51_p1p1 *r, const ge51_p2 *p) {
+  fe51 t0;
+  fe51_sq(r->X, p->X);
+  fe51_sq(r->Z, p->Y);
+  fe51_sq2(r->T, p->Z);
+  fe51_add(r->Y, p->X, p->Y);
+  fe51_sq(t0, r->Y);
+  fe51_add(r->Y, r->Z, r->X);
+  fe51_sub(r->Z, r->Z, r->X);
+  fe51_sub(r->X, t0, r->Y);
+  fe51_sub(r->T, r->T, r->Z);
+}
+
+static void ge51_p3_dbl(ge51_p1p1 *r, const ge51_p3 *p) {
+  ge51_p2 q;
+  fe51_copy(q.X, p->X);
+  fe51_copy(q.Y, p->Y);
+  fe51_copy(q.Z, p->Z);
+  ge51_p2_dbl(r, &q);
+}
+
+static void ge51_p3_to_cached(ge51_cached *r, const ge51_p3 *p) {
+  fe51_add(r->YplusX, p->Y, p->X);
+  fe51_sub(r->YminusX, p->Y, p->X);
+  fe51_copy(r->Z, p->Z);
+  fe51_mul(r->T2d, p->T, fe51_d2);
+}
+
+static void ge51_cached_0(ge51_cached *r) {
+  fe51_1(r->YplusX);
+  fe51_1(r->YminusX);
+  fe51_1(r->Z);
+  fe51_0(r->T2d);
+}
+
+static void ge51_cached_cmov(ge51_cached *t, const ge51_cached *u, unsigned char b) {
+  fe51_cmov(t->YplusX, u->YplusX, b);
+  fe51_cmov(t->YminusX, u->YminusX, b);
+  fe51_cmov(t->Z, u->Z, b);
+  fe51_cmov(t->T2d, u->T2d, b);
+}
+
+static unsigned char equal(signed char b, signed char c) {
+  unsigned char ub = b;
+  unsigned char uc = c;
+  unsigned char x = ub ^ uc; /* 0: yes; 1..255: no */
+  uint32_t y = x; /* 0: yes; 1..255: no */
+  y -= 1; /* 4294967295: yes; 0..254: no */
+  y >>= 31; /* 1: yes; 0: no */
+  return y;
+}
+
+static unsigned char negative(signed char b) {
+  unsigned long long x = b; /* 18446744073709551361..18446744073709551615: yes; 0..255: no */
+  x >>= 63; /* 1: yes; 0: no */
+  return x;
+}
+
+static void ge51_dsm_precomp_internal(ge51_dsmp r, const ge51_p3 *s) {
+  ge51_p1p1 t;
+  ge51_p3 s2, u;
+  int i;
+  ge51_p3_to_cached(&r[0], s);
+  ge51_p3_dbl(&t, s); ge51_p1p1_to_p3(&s2, &t);
+  for (i = 0; i < 7; ++i) {
+    ge51_add(&t, &s2, &r[i]); ge51_p1p1_to_p3(&u, &t); ge51_p3_to_cached(&r[i + 1], &u);
+  }
+}
+
+/* Entry points, dispatched to from crypto-ops.c */
+
+void ge51_dsm_precomp(ge_dsmp r, const ge_p3 *s) {
+  ge51_p3 s51;
+  ge51_dsmp r51;
+  int i;
+
+  ge51_from_p3(&s51, s);
+  ge51_dsm_precomp_internal(r51, &s51);
+  for (i = 0; i < 8; ++i)
+    ge_from_cached(&r[i], &r51[i]);
+}
+
+/* Constant time, as ge_scalarmult; a[31] <= 127, e computed by the caller */
+static void ge51_scalarmult_internal(ge51_p1p1 *t, const signed char e[64], const ge51_p3 *A) {
+  ge51_cached Ai[8]; /* 1 * A, 2 * A, ..., 8 * A */
+  ge51_p3 u;
+  ge51_p2 r;
+  int i;
+
+  ge51_p3_to_cached(&Ai[0], A);
+  for (i = 0; i < 7; i++) {
+    ge51_add(t, A, &Ai[i]);
+    ge51_p1p1_to_p3(&u, t);
+    ge51_p3_to_cached(&Ai[i + 1], &u);
+  }
+
+  ge51_p2_0(&r);
+  for (i = 63; i >= 0; i--) {
+    signed char b = e[i];
+    unsigned char bnegative = negative(b);
+    unsigned char babs = b - ((-bnegative) & b) * 2;
+    ge51_cached cur, minuscur;
+    ge51_p2_dbl(t, &r);
+    ge51_p1p1_to_p2(&r, t);
+    ge51_p2_dbl(t, &r);
+    ge51_p1p1_to_p2(&r, t);
+    ge51_p2_dbl(t, &r);
+    ge51_p1p1_to_p2(&r, t);
+    ge51_p2_dbl(t, &r);
+    ge51_p1p1_to_p3(&u, t);
+    ge51_cached_0(&cur);
+    ge51_cached_cmov(&cur, &Ai[0], equal(babs, 1));
+    ge51_cached_cmov(&cur, &Ai[1], equal(babs, 2));
+    ge51_cached_cmov(&cur, &Ai[2], equal(babs, 3));
+    ge51_cached_cmov(&cur, &Ai[3], equal(babs, 4));
+    ge51_cached_cmov(&cur, &Ai[4], equal(babs, 5));
+    ge51_cached_cmov(&cur, &Ai[5], equal(babs, 6));
+    ge51_cached_cmov(&cur, &Ai[6], equal(babs, 7));
+    ge51_cached_cmov(&cur, &Ai[7], equal(babs, 8));
+    fe51_copy(minuscur.YplusX, cur.YminusX);
+    fe51_copy(minuscur.YminusX, cur.YplusX);
+    fe51_copy(minuscur.Z, cur.Z);
+    fe51_neg(minuscur.T2d, cur.T2d);
+    ge51_cached_cmov(&cur, &minuscur, bnegative);
+    ge51_add(t, &u, &cur);
+    if (i > 0)
+      ge51_p1p1_to_p2(&r, t);
+  }
+}
+
+/* Single group operations, worth the conversions for the 2 to 3 times cheaper products */
+
+void ge51_p3_add_cached(ge_p3 *r, const ge_p3 *p, const ge_cached *q) {
+  ge51_p3 p51;
+  ge51_cached q51;
+  ge51_p1p1 t;
+
+  ge51_from_p3(&p51, p);
+  ge51_from_cached(&q51, q);
+  ge51_add(&t, &p51, &q51);
+  ge51_p1p1_to_p3(&p51, &t);
+  ge_from_p3(r, &p51);
+}
+
+void ge51_p3_dbl_n(ge_p3 *r, const ge_p3 *p, unsigned int n) {
+  ge51_p3 p51;
+  ge51_p2 s;
+  ge51_p1p1 t;
+
+  ge51_from_p3(&p51, p);
+  fe51_copy(s.X, p51.X);
+  fe51_copy(s.Y, p51.Y);
+  fe51_copy(s.Z, p51.Z);
+  while (--n) {
+    ge51_p2_dbl(&t, &s);
+    ge51_p1p1_to_p2(&s, &t);
+  }
+  ge51_p2_dbl(&t, &s);
+  ge51_p1p1_to_p3(&p51, &t);
+  ge_from_p3(r, &p51);
+}
+
+void ge51_scalarmult(ge_p2 *r, const signed char e[64], const ge_p3 *A) {
+  ge51_p3 A51;
+  ge51_p1p1 t;
+  ge51_p2 r51;
+
+  ge51_from_p3(&A51, A);
+  ge51_scalarmult_internal(&t, e, &A51);
+  ge51_p1p1_to_p2(&r51, &t);
+  ge_from_p2(r, &r51);
+}
+
+void ge51_scalarmult_p3(ge_p3 *r3, const signed char e[64], const ge_p3 *A) {
+  ge51_p3 A51;
+  ge51_p1p1 t;
+  ge51_p3 r51;
+
+  ge51_from_p3(&A51, A);
+  ge51_scalarmult_internal(&t, e, &A51);
+  ge51_p1p1_to_p3(&r51, &t);
+  ge_from_p3(r3, &r51);
+}
+
+/*
+Variable time sum of up to three multiples, with sliding windows from slide():
+each of the terms uses either a precomputed table of odd multiples (Xi) or,
+when Xi is NULL, the fixed base point table ge51_Bi.
+*/
+static void ge51_multi_scalarmult_vartime(ge51_p1p1 *t, const signed char *const slides[3], const ge51_cached *const tables[3], int n) {
+  ge51_p2 r;
+  ge51_p3 u;
+  int i, k;
+
+  ge51_p2_0(&r);
+
+  for (i = 255; i >= 0; --i) {
+    for (k = 0; k < n; ++k)
+      if (slides[k][i]) break;
+    if (k < n) break;
+  }
+  if (i < 0) {
+    /* all scalars are zero: t becomes the identity */
+    ge51_p2_dbl(t, &r);
+    return;
+  }
+
+  for (; i >= 0; --i) {
+    ge51_p2_dbl(t, &r);
+
+    for (k = 0; k < n; ++k) {
+      const signed char s = slides[k][i];
+      if (s == 0)
+        continue;
+      ge51_p1p1_to_p3(&u, t);
+      if (tables[k]) {
+        if (s > 0)
+          ge51_add(t, &u, &tables[k][s/2]);
+        else
+          ge51_sub(t, &u, &tables[k][(-s)/2]);
+      } else {
+        if (s > 0)
+          ge51_madd(t, &u, &ge51_Bi[s/2]);
+        else
+          ge51_msub(t, &u, &ge51_Bi[(-s)/2]);
+      }
+    }
+
+    if (i > 0)
+      ge51_p1p1_to_p2(&r, t);
+  }
+}
+
+static void ge51_multi_to_p2(ge_p2 *r, const ge51_p1p1 *t) {
+  ge51_p2 r51;
+  ge51_p1p1_to_p2(&r51, t);
+  ge_from_p2(r, &r51);
+}
+
+static void ge51_multi_to_p3(ge_p3 *r3, const ge51_p1p1 *t) {
+  ge51_p3 r51;
+  ge51_p1p1_to_p3(&r51, t);
+  ge_from_p3(r3, &r51);
+}
+
+void ge51_double_scalarmult_base_vartime(ge_p2 *r, const signed char *aslide, const ge_p3 *A, const signed char *bslide) {
+  ge51_p3 A51;
+  ge51_dsmp Ai;
+  ge51_p1p1 t;
+  const signed char *const slides[3] = {aslide, bslide, NULL};
+  const ge51_cached *const tables[3] = {Ai, NULL, NULL};
+
+  ge51_from_p3(&A51, A);
+  ge51_dsm_precomp_internal(Ai, &A51);
+  ge51_multi_scalarmult_vartime(&t, slides, tables, 2);
+  ge51_multi_to_p2(r, &t);
+}
+
+void ge51_double_scalarmult_base_vartime_p3(ge_p3 *r3, const signed char *aslide, const ge_p3 *A, const signed char *bslide) {
+  ge51_p3 A51;
+  ge51_dsmp Ai;
+  ge51_p1p1 t;
+  const signed char *const slides[3] = {aslide, bslide, NULL};
+  const ge51_cached *const tables[3] = {Ai, NULL, NULL};
+
+  ge51_from_p3(&A51, A);
+  ge51_dsm_precomp_internal(Ai, &A51);
+  ge51_multi_scalarmult_vartime(&t, slides, tables, 2);
+  ge51_multi_to_p3(r3, &t);
+}
+
+void ge51_triple_scalarmult_base_vartime(ge_p2 *r, const signed char *aslide, const signed char *bslide, const ge_dsmp Bi, const signed char *cslide, const ge_dsmp Ci) {
+  ge51_dsmp Bi51, Ci51;
+  ge51_p1p1 t;
+  const signed char *const slides[3] = {aslide, bslide, cslide};
+  const ge51_cached *const tables[3] = {NULL, Bi51, Ci51};
+
+  ge51_from_dsmp(Bi51, Bi);
+  ge51_from_dsmp(Ci51, Ci);
+  ge51_multi_scalarmult_vartime(&t, slides, tables, 3);
+  ge51_multi_to_p2(r, &t);
+}
+
+void ge51_double_scalarmult_precomp_vartime2(ge_p2 *r, const signed char *aslide, const ge_dsmp Ai, const signed char *bslide, const ge_dsmp Bi) {
+  ge51_dsmp Ai51, Bi51;
+  ge51_p1p1 t;
+  const signed char *const slides[3] = {aslide, bslide, NULL};
+  const ge51_cached *const tables[3] = {Ai51, Bi51, NULL};
+
+  ge51_from_dsmp(Ai51, Ai);
+  ge51_from_dsmp(Bi51, Bi);
+  ge51_multi_scalarmult_vartime(&t, slides, tables, 2);
+  ge51_multi_to_p2(r, &t);
+}
+
+void ge51_double_scalarmult_precomp_vartime2_p3(ge_p3 *r3, const signed char *aslide, const ge_dsmp Ai, const signed char *bslide, const ge_dsmp Bi) {
+  ge51_dsmp Ai51, Bi51;
+  ge51_p1p1 t;
+  const signed char *const slides[3] = {aslide, bslide, NULL};
+  const ge51_cached *const tables[3] = {Ai51, Bi51, NULL};
+
+  ge51_from_dsmp(Ai51, Ai);
+  ge51_from_dsmp(Bi51, Bi);
+  ge51_multi_scalarmult_vartime(&t, slides, tables, 2);
+  ge51_multi_to_p3(r3, &t);
+}
+
+void ge51_triple_scalarmult_precomp_vartime(ge_p2 *r, const signed char *aslide, const ge_dsmp Ai, const signed char *bslide, const ge_dsmp Bi, const signed char *cslide, const ge_dsmp Ci) {
+  ge51_dsmp Ai51, Bi51, Ci51;
+  ge51_p1p1 t;
+  const signed char *const slides[3] = {aslide, bslide, cslide};
+  const ge51_cached *const tables[3] = {Ai51, Bi51, Ci51};
+
+  ge51_from_dsmp(Ai51, Ai);
+  ge51_from_dsmp(Bi51, Bi);
+  ge51_from_dsmp(Ci51, Ci);
+  ge51_multi_scalarmult_vartime(&t, slides, tables, 3);
+  ge51_multi_to_p2(r, &t);
+}
+
+#endif
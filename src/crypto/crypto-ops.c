@@ -46,6 +46,8 @@ static void ge_p2_0(ge_p2 *);
 static void ge_p3_dbl(ge_p1p1 *, const ge_p3 *);
 static void fe_divpowm1(fe, const fe, const fe);
 
+#define USE_FE51 (crypto_ops_get_backend() == CRYPTO_OPS_BACKEND_FE51)
+
 /* Common functions */
 
 uint64_t load_3(const unsigned char *in) {
@@ -1175,6 +1177,14 @@ static void slide(signed char *r, const unsigned char *a) {
 void ge_dsm_precomp(ge_dsmp r, const ge_p3 *s) {
   ge_p1p1 t;
   ge_p3 s2, u;
+
+#if CRYPTO_OPS_HAVE_FE51
+  if (USE_FE51) {
+    ge51_dsm_precomp(r, s);
+    return;
+  }
+#endif
+
   ge_p3_to_cached(&r[0], s);
   ge_p3_dbl(&t, s); ge_p1p1_to_p3(&s2, &t);
   ge_add(&t, &s2, &r[0]); ge_p1p1_to_p3(&u, &t); ge_p3_to_cached(&r[1], &u);
@@ -1203,6 +1213,14 @@ void ge_double_scalarmult_base_vartime(ge_p2 *r, const unsigned char *a, const g
 
   slide(aslide, a);
   slide(bslide, b);
+
+#if CRYPTO_OPS_HAVE_FE51
+  if (USE_FE51) {
+    ge51_double_scalarmult_base_vartime(r, aslide, A, bslide);
+    return;
+  }
+#endif
+
   ge_dsm_precomp(Ai, A);
 
   ge_p2_0(r);
@@ -1247,6 +1265,13 @@ void ge_triple_scalarmult_base_vartime(ge_p2 *r, const unsigned char *a, const u
   slide(bslide, b);
   slide(cslide, c);
 
+#if CRYPTO_OPS_HAVE_FE51
+  if (USE_FE51) {
+    ge51_triple_scalarmult_base_vartime(r, aslide, bslide, Bi, cslide, Ci);
+    return;
+  }
+#endif
+
   ge_p2_0(r);
 
   for (i = 255; i >= 0; --i) {
@@ -1295,6 +1320,14 @@ void ge_double_scalarmult_base_vartime_p3(ge_p3 *r3, const unsigned char *a, con
 
   slide(aslide, a);
   slide(bslide, b);
+
+#if CRYPTO_OPS_HAVE_FE51
+  if (USE_FE51) {
+    ge51_double_scalarmult_base_vartime_p3(r3, aslide, A, bslide);
+    return;
+  }
+#endif
+
   ge_dsm_precomp(Ai, A);
 
   ge_p2_0(&r);
@@ -1536,6 +1569,53 @@ static void ge_p3_dbl(ge_p1p1 *r, const ge_p3 *p) {
   ge_p2_dbl(r, &q);
 }
 
+/*
+r = p + q, with the result in extended coordinates
+*/
+
+void ge_p3_add_cached(ge_p3 *r, const ge_p3 *p, const ge_cached *q) {
+  ge_p1p1 t;
+
+#if CRYPTO_OPS_HAVE_FE51
+  if (USE_FE51) {
+    ge51_p3_add_cached(r, p, q);
+    return;
+  }
+#endif
+
+  ge_add(&t, p, q);
+  ge_p1p1_to_p3(r, &t);
+}
+
+/*
+r = 2^n * p
+*/
+
+void ge_p3_dbl_n(ge_p3 *r, const ge_p3 *p, unsigned int n) {
+  ge_p1p1 t;
+  ge_p2 s;
+
+  if (n == 0) {
+    *r = *p;
+    return;
+  }
+
+#if CRYPTO_OPS_HAVE_FE51
+  if (USE_FE51) {
+    ge51_p3_dbl_n(r, p, n);
+    return;
+  }
+#endif
+
+  ge_p3_to_p2(&s, p);
+  while (--n) {
+    ge_p2_dbl(&t, &s);
+    ge_p1p1_to_p2(&s, &t);
+  }
+  ge_p2_dbl(&t, &s);
+  ge_p1p1_to_p3(r, &t);
+}
+
 /* From ge_p3_to_cached.c */
 
 /*
@@ -1607,20 +1687,20 @@ static void ge_precomp_cmov(ge_precomp *t, const ge_precomp *u, unsigned char b)
   fe_cmov(t->xy2d, u->xy2d, b);
 }
 
-static void select(ge_precomp *t, int pos, signed char b) {
+static void select(ge_precomp *t, const ge_precomp table[8], signed char b) {
   ge_precomp minust;
   unsigned char bnegative = negative(b);
   unsigned char babs = b - (((-bnegative) & b) << 1);
 
   ge_precomp_0(t);
-  ge_precomp_cmov(t, &ge_base[pos][0], equal(babs, 1));
-  ge_precomp_cmov(t, &ge_base[pos][1], equal(babs, 2));
-  ge_precomp_cmov(t, &ge_base[pos][2], equal(babs, 3));
-  ge_precomp_cmov(t, &ge_base[pos][3], equal(babs, 4));
-  ge_precomp_cmov(t, &ge_base[pos][4], equal(babs, 5));
-  ge_precomp_cmov(t, &ge_base[pos][5], equal(babs, 6));
-  ge_precomp_cmov(t, &ge_base[pos][6], equal(babs, 7));
-  ge_precomp_cmov(t, &ge_base[pos][7], equal(babs, 8));
+  ge_precomp_cmov(t, &table[0], equal(babs, 1));
+  ge_precomp_cmov(t, &table[1], equal(babs, 2));
+  ge_precomp_cmov(t, &table[2], equal(babs, 3));
+  ge_precomp_cmov(t, &table[3], equal(babs, 4));
+  ge_precomp_cmov(t, &table[4], equal(babs, 5));
+  ge_precomp_cmov(t, &table[5], equal(babs, 6));
+  ge_precomp_cmov(t, &table[6], equal(babs, 7));
+  ge_precomp_cmov(t, &table[7], equal(babs, 8));
   fe_copy(minust.yplusx, t->yminusx);
   fe_copy(minust.yminusx, t->yplusx);
   fe_neg(minust.xy2d, t->xy2d);
@@ -1628,15 +1708,15 @@ static void select(ge_precomp *t, int pos, signed char b) {
 }
 
 /*
-h = a * B
+h = a * P
 where a = a[0]+256*a[1]+...+256^31 a[31]
-B is the Ed25519 base point (x,4/5) with x positive.
+and table[i][j] = (j+1)*256^i*P for a fixed point P.
 
 Preconditions:
   a[31] <= 127
 */
 
-void ge_scalarmult_base(ge_p3 *h, const unsigned char *a) {
+static void ge_scalarmult_fixed(ge_p3 *h, const unsigned char *a, const ge_precomp table[32][8]) {
   signed char e[64];
   signed char carry;
   ge_p1p1 r;
@@ -1663,7 +1743,7 @@ void ge_scalarmult_base(ge_p3 *h, const unsigned char *a) {
 
   ge_p3_0(h);
   for (i = 1; i < 64; i += 2) {
-    select(&t, i / 2, e[i]);
+    select(&t, table[i / 2], e[i]);
     ge_madd(&r, h, &t); ge_p1p1_to_p3(h, &r);
   }
 
@@ -1673,11 +1753,37 @@ void ge_scalarmult_base(ge_p3 *h, const unsigned char *a) {
   ge_p2_dbl(&r, &s); ge_p1p1_to_p3(h, &r);
 
   for (i = 0; i < 64; i += 2) {
-    select(&t, i / 2, e[i]);
+    select(&t, table[i / 2], e[i]);
     ge_madd(&r, h, &t); ge_p1p1_to_p3(h, &r);
   }
 }
 
+/*
+h = a * B
+where a = a[0]+256*a[1]+...+256^31 a[31]
+B is the Ed25519 base point (x,4/5) with x positive.
+
+Preconditions:
+  a[31] <= 127
+*/
+
+void ge_scalarmult_base(ge_p3 *h, const unsigned char *a) {
+  ge_scalarmult_fixed(h, a, ge_base);
+}
+
+/*
+h = a * H
+where a = a[0]+256*a[1]+...+256^31 a[31]
+H is the RingCT amount commitment generator, see ge_p3_H.
+
+Preconditions:
+  a[31] <= 127
+*/
+
+void ge_scalarmult_H(ge_p3 *h, const unsigned char *a) {
+  ge_scalarmult_fixed(h, a, ge_H_base);
+}
+
 /* From ge_sub.c */
 
 /*
@@ -2055,6 +2161,13 @@ void ge_scalarmult(ge_p2 *r, const unsigned char *a, const ge_p3 *A) {
   e[62] = carry - (carry2 << 4); /* -8..7 */
   e[63] = carry2; /* 0..8 */
 
+#if CRYPTO_OPS_HAVE_FE51
+  if (USE_FE51) {
+    ge51_scalarmult(r, e, A);
+    return;
+  }
+#endif
+
   ge_p3_to_cached(&Ai[0], A);
   for (i = 0; i < 7; i++) {
     ge_add(&t, A, &Ai[i]);
@@ -2116,6 +2229,13 @@ void ge_scalarmult_p3(ge_p3 *r3, const unsigned char *a, const ge_p3 *A) {
   e[62] = carry - (carry2 << 4); /* -8..7 */
   e[63] = carry2; /* 0..8 */
 
+#if CRYPTO_OPS_HAVE_FE51
+  if (USE_FE51) {
+    ge51_scalarmult_p3(r3, e, A);
+    return;
+  }
+#endif
+
   ge_p3_to_cached(&Ai[0], A);
   for (i = 0; i < 7; i++) {
     ge_add(&t, A, &Ai[i]);
@@ -2169,6 +2289,13 @@ void ge_double_scalarmult_precomp_vartime2(ge_p2 *r, const unsigned char *a, con
   slide(aslide, a);
   slide(bslide, b);
 
+#if CRYPTO_OPS_HAVE_FE51
+  if (USE_FE51) {
+    ge51_double_scalarmult_precomp_vartime2(r, aslide, Ai, bslide, Bi);
+    return;
+  }
+#endif
+
   ge_p2_0(r);
 
   for (i = 255; i >= 0; --i) {
@@ -2211,6 +2338,13 @@ void ge_triple_scalarmult_precomp_vartime(ge_p2 *r, const unsigned char *a, cons
   slide(bslide, b);
   slide(cslide, c);
 
+#if CRYPTO_OPS_HAVE_FE51
+  if (USE_FE51) {
+    ge51_triple_scalarmult_precomp_vartime(r, aslide, Ai, bslide, Bi, cslide, Ci);
+    return;
+  }
+#endif
+
   ge_p2_0(r);
 
   for (i = 255; i >= 0; --i) {
@@ -2259,6 +2393,13 @@ void ge_double_scalarmult_precomp_vartime2_p3(ge_p3 *r3, const unsigned char *a,
   slide(aslide, a);
   slide(bslide, b);
 
+#if CRYPTO_OPS_HAVE_FE51
+  if (USE_FE51) {
+    ge51_double_scalarmult_precomp_vartime2_p3(r3, aslide, Ai, bslide, Bi);
+    return;
+  }
+#endif
+
   ge_p2_0(&r);
 
   for (i = 255; i >= 0; --i) {
@@ -3830,6 +3971,25 @@ int sc_isnonzero(const unsigned char *s) {
     s[27] | s[28] | s[29] | s[30] | s[31]) - 1) >> 8) + 1;
 }
 
+/* Returns 1 if l*A is the identity, ie A has no small order component. Variable time,
+   for public points such as key images: l*A goes through the sliding window routine and
+   the identity test is done projectively (X == 0, Y == Z), without an inversion. */
+int ge_p3_is_torsion_free_vartime(const ge_p3 *A) {
+  static const unsigned char l[32] = {
+    0xed, 0xd3, 0xf5, 0x5c, 0x1a, 0x63, 0x12, 0x58, 0xd6, 0x9c, 0xf7, 0xa2, 0xde, 0xf9, 0xde, 0x14,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10
+  };
+  static const unsigned char zero[32] = {0};
+  ge_p3 r;
+  fe t;
+
+  ge_double_scalarmult_base_vartime_p3(&r, l, A, zero);
+  if (fe_isnonzero(r.X))
+    return 0;
+  fe_sub(t, r.Y, r.Z);
+  return !fe_isnonzero(t);
+}
+
 int ge_p3_is_point_at_infinity(const ge_p3 *p) {
   // X = 0 and Y == Z
   int n;
@@ -117,6 +117,8 @@ void ge_p3_tobytes(unsigned char *, const ge_p3 *);
 
 extern const ge_precomp ge_base[32][8];
 void ge_scalarmult_base(ge_p3 *, const unsigned char *);
+extern const ge_precomp ge_H_base[32][8];
+void ge_scalarmult_H(ge_p3 *, const unsigned char *);
 
 /* From ge_tobytes.c */
 
@@ -163,3 +165,39 @@ void fe_tobytes(unsigned char *, const fe);
 void fe_invert(fe out, const fe z);
 
 int ge_p3_is_point_at_infinity(const ge_p3 *p);
+/* r = p + q and r = 2^n p, on the selected backend: for callers chaining group operations themselves */
+void ge_p3_add_cached(ge_p3 *r, const ge_p3 *p, const ge_cached *q);
+void ge_p3_dbl_n(ge_p3 *r, const ge_p3 *p, unsigned int n);
+int ge_p3_is_torsion_free_vartime(const ge_p3 *A);
+
+/* Field arithmetic backends */
+
+#if defined(__SIZEOF_INT128__)
+#define CRYPTO_OPS_HAVE_FE51 1
+#else
+#define CRYPTO_OPS_HAVE_FE51 0
+#endif
+
+enum crypto_ops_backend {
+  CRYPTO_OPS_BACKEND_REF10, /* 10 limbs of 25.5 bits, portable */
+  CRYPTO_OPS_BACKEND_FE51   /* 5 limbs of 51 bits, needs a 128 bit product */
+};
+/* Defaults to the fastest backend built in; MONERO_CRYPTO_OPS_BACKEND=ref10 forces ref10 */
+enum crypto_ops_backend crypto_ops_get_backend(void);
+/* Returns 0 on success, -1 if the backend is not available in this build */
+int crypto_ops_set_backend(enum crypto_ops_backend backend);
+
+#if CRYPTO_OPS_HAVE_FE51
+/* From crypto-ops-fe51.c, on scalars already recoded by the callers in crypto-ops.c */
+void ge51_dsm_precomp(ge_dsmp r, const ge_p3 *s);
+void ge51_p3_add_cached(ge_p3 *r, const ge_p3 *p, const ge_cached *q);
+void ge51_p3_dbl_n(ge_p3 *r, const ge_p3 *p, unsigned int n);
+void ge51_scalarmult(ge_p2 *r, const signed char e[64], const ge_p3 *A);
+void ge51_scalarmult_p3(ge_p3 *r3, const signed char e[64], const ge_p3 *A);
+void ge51_double_scalarmult_base_vartime(ge_p2 *r, const signed char *aslide, const ge_p3 *A, const signed char *bslide);
+void ge51_double_scalarmult_base_vartime_p3(ge_p3 *r3, const signed char *aslide, const ge_p3 *A, const signed char *bslide);
+void ge51_triple_scalarmult_base_vartime(ge_p2 *r, const signed char *aslide, const signed char *bslide, const ge_dsmp Bi, const signed char *cslide, const ge_dsmp Ci);
+void ge51_double_scalarmult_precomp_vartime2(ge_p2 *r, const signed char *aslide, const ge_dsmp Ai, const signed char *bslide, const ge_dsmp Bi);
+void ge51_double_scalarmult_precomp_vartime2_p3(ge_p3 *r3, const signed char *aslide, const ge_dsmp Ai, const signed char *bslide, const ge_dsmp Bi);
+void ge51_triple_scalarmult_precomp_vartime(ge_p2 *r, const signed char *aslide, const ge_dsmp Ai, const signed char *bslide, const ge_dsmp Bi, const signed char *cslide, const ge_dsmp Ci);
+#endif
@@ -79,6 +79,9 @@ enum {
 };
 
 void cn_fast_hash(const void *data, size_t length, char *hash);
+// hashes count independent blobs into count consecutive hashes; hash i is
+// only written once blobs 0..i have been read, so it may overlap them
+void cn_fast_hash_multi(const void *const *data, const size_t *lengths, size_t count, char *hashes);
 void cn_slow_hash(const void *data, size_t length, char *hash, int variant, int prehashed);
 
 void hash_extra_blake(const void *data, size_t length, char *hash);
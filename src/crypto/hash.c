@@ -55,3 +55,29 @@ void cn_fast_hash(const void *data, size_t length, char *hash) {
   hash_process(&state, data, length);
   memcpy(hash, &state, HASH_SIZE);
 }
+
+void cn_fast_hash_multi(const void *const *data, const size_t *lengths, size_t count, char *hashes) {
+  size_t i = 0, l, n;
+  // without AVX2 a 4 way permutation costs about as much as four scalar
+  // ones, and lanes of uneven length would only add work
+  if (keccakf_x4_uses_avx2()) {
+    while (i + 1 < count) {
+      union hash_state state[4];
+      const uint8_t *in[4];
+      size_t len[4];
+      uint8_t *md[4];
+      n = count - i < 4 ? count - i : 4;
+      for (l = 0; l < 4; ++l) {
+        in[l] = l < n ? (const uint8_t*)data[i + l] : NULL;
+        len[l] = l < n ? lengths[i + l] : 0;
+        md[l] = state[l].b;
+      }
+      keccak_x4(in, len, md, HASH_SIZE);
+      for (l = 0; l < n; ++l)
+        memcpy(hashes + (i + l) * HASH_SIZE, &state[l], HASH_SIZE);
+      i += n;
+    }
+  }
+  for (; i < count; ++i)
+    cn_fast_hash(data[i], lengths[i], hashes + i * HASH_SIZE);
+}
@@ -70,6 +70,10 @@ namespace crypto {
     return h;
   }
 
+  inline void cn_fast_hash_multi(const void *const *data, const std::size_t *lengths, std::size_t count, hash *hashes) {
+    cn_fast_hash_multi(data, lengths, count, reinterpret_cast<char *>(hashes));
+  }
+
   inline void tree_hash(const hash *hashes, std::size_t count, hash &root_hash) {
     tree_hash(reinterpret_cast<const char (*)[HASH_SIZE]>(hashes), count, reinterpret_cast<char *>(&root_hash));
   }
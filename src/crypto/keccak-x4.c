@@ -0,0 +1,263 @@
+// Copyright (c) 2019, The Monero Project
+// 
+// All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without modification, are
+// permitted provided that the following conditions are met:
+// 
+// 1. Redistributions of source code must retain the above copyright notice, this list of
+//    conditions and the following disclaimer.
+// 
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list
+//    of conditions and the following disclaimer in the documentation and/or other
+//    materials provided with the distribution.
+// 
+// 3. Neither the name of the copyright holder nor the names of its contributors may be
+//    used to endorse or promote products derived from this software without specific
+//    prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL
+// THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+/*
+Multi-buffer Keccak: four independent messages are absorbed side by side,
+one 64 bit lane of each message per state word, so a single permutation
+call advances all four hashes. The AVX2 permutation keeps each state word in
+one ymm register; the portable one still benefits from the four independent
+dependency chains.
+*/
+
+#include <stdatomic.h>
+#include <stdlib.h>
+#include "int-util.h"
+#include "hash-ops.h"
+#include "keccak.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define KECCAK_X4_HAVE_AVX2 1
+#include <immintrin.h>
+#else
+#define KECCAK_X4_HAVE_AVX2 0
+#endif
+
+extern const uint64_t keccakf_rndc[24];
+extern const int keccakf_rotc[24];
+extern const int keccakf_piln[24];
+void keccak_abort(const char *msg);
+
+static void keccakf_x4_portable(uint64_t st[25][4], int rounds)
+{
+    int i, j, l, round;
+    uint64_t t[4], bc[5][4];
+
+    for (round = 0; round < rounds; round++) {
+
+        // Theta
+        for (i = 0; i < 5; i++)
+            for (l = 0; l < 4; l++)
+                bc[i][l] = st[i][l] ^ st[i + 5][l] ^ st[i + 10][l] ^ st[i + 15][l] ^ st[i + 20][l];
+
+        for (i = 0; i < 5; i++) {
+            for (l = 0; l < 4; l++)
+                t[l] = bc[(i + 4) % 5][l] ^ ROTL64(bc[(i + 1) % 5][l], 1);
+            for (j = 0; j < 25; j += 5)
+                for (l = 0; l < 4; l++)
+                    st[j + i][l] ^= t[l];
+        }
+
+        // Rho Pi
+        for (l = 0; l < 4; l++)
+            t[l] = st[1][l];
+        for (i = 0; i < 24; i++) {
+            j = keccakf_piln[i];
+            for (l = 0; l < 4; l++) {
+                bc[0][l] = st[j][l];
+                st[j][l] = ROTL64(t[l], keccakf_rotc[i]);
+                t[l] = bc[0][l];
+            }
+        }
+
+        //  Chi
+        for (j = 0; j < 25; j += 5) {
+            for (i = 0; i < 5; i++)
+                for (l = 0; l < 4; l++)
+                    bc[i][l] = st[j + i][l];
+            for (i = 0; i < 5; i++)
+                for (l = 0; l < 4; l++)
+                    st[j + i][l] ^= (~bc[(i + 1) % 5][l]) & bc[(i + 2) % 5][l];
+        }
+
+        //  Iota
+        for (l = 0; l < 4; l++)
+            st[0][l] ^= keccakf_rndc[round];
+    }
+}
+
+#if KECCAK_X4_HAVE_AVX2
+
+#define ROTL256(x, y) _mm256_or_si256(_mm256_sll_epi64((x), _mm_cvtsi32_si128(y)), _mm256_srl_epi64((x), _mm_cvtsi32_si128(64 - (y))))
+
+__attribute__((target("avx2")))
+static void keccakf_x4_avx2(uint64_t st[25][4], int rounds)
+{
+    int i, j, round;
+    __m256i s[25], t, bc[5];
+
+    for (i = 0; i < 25; i++)
+        s[i] = _mm256_loadu_si256((const __m256i*)st[i]);
+
+    for (round = 0; round < rounds; round++) {
+
+        // Theta
+        for (i = 0; i < 5; i++)
+            bc[i] = _mm256_xor_si256(_mm256_xor_si256(_mm256_xor_si256(s[i], s[i + 5]), _mm256_xor_si256(s[i + 10], s[i + 15])), s[i + 20]);
+
+        for (i = 0; i < 5; i++) {
+            t = _mm256_xor_si256(bc[(i + 4) % 5], ROTL256(bc[(i + 1) % 5], 1));
+            for (j = 0; j < 25; j += 5)
+                s[j + i] = _mm256_xor_si256(s[j + i], t);
+        }
+
+        // Rho Pi
+        t = s[1];
+        for (i = 0; i < 24; i++) {
+            j = keccakf_piln[i];
+            bc[0] = s[j];
+            s[j] = ROTL256(t, keccakf_rotc[i]);
+            t = bc[0];
+        }
+
+        //  Chi
+        for (j = 0; j < 25; j += 5) {
+            for (i = 0; i < 5; i++)
+                bc[i] = s[j + i];
+            for (i = 0; i < 5; i++)
+                s[j + i] = _mm256_xor_si256(s[j + i], _mm256_andnot_si256(bc[(i + 1) % 5], bc[(i + 2) % 5]));
+        }
+
+        //  Iota
+        s[0] = _mm256_xor_si256(s[0], _mm256_set1_epi64x((long long)keccakf_rndc[round]));
+    }
+
+    for (i = 0; i < 25; i++)
+        _mm256_storeu_si256((__m256i*)st[i], s[i]);
+}
+
+#endif
+
+typedef void (*keccakf_x4_fn)(uint64_t st[25][4], int rounds);
+
+/* Picked on first use by whichever thread hashes first, so published atomically */
+static _Atomic(keccakf_x4_fn) keccakf_x4_selected = NULL;
+
+static keccakf_x4_fn keccakf_x4_select(void)
+{
+  keccakf_x4_fn expected = NULL;
+  keccakf_x4_fn fn = atomic_load_explicit(&keccakf_x4_selected, memory_order_relaxed);
+  const char *env;
+
+  if (fn)
+    return fn;
+
+  fn = keccakf_x4_portable;
+#if KECCAK_X4_HAVE_AVX2
+  env = getenv("MONERO_KECCAK_NO_AVX2");
+  if (!(env && strcmp(env, "0") && strcmp(env, "no")) && __builtin_cpu_supports("avx2"))
+    fn = keccakf_x4_avx2;
+#else
+  (void)env;
+#endif
+  if (!atomic_compare_exchange_strong_explicit(&keccakf_x4_selected, &expected, fn, memory_order_relaxed, memory_order_relaxed))
+    fn = expected;
+  return fn;
+}
+
+void keccakf_x4(uint64_t st[25][4], int rounds)
+{
+    keccakf_x4_select()(st, rounds);
+}
+
+int keccakf_x4_uses_avx2(void)
+{
+#if KECCAK_X4_HAVE_AVX2
+    return keccakf_x4_select() == keccakf_x4_avx2;
+#else
+    return 0;
+#endif
+}
+
+// compute four keccak hashes of given byte length; each lane gets its
+// padded last block absorbed at its own block count, and its digest is read
+// out right after that permutation, so lanes may have different lengths
+
+void keccak_x4(const uint8_t *const in[4], const size_t inlen[4], uint8_t *const md[4], int mdlen)
+{
+    uint64_t st[25][4];
+    uint8_t temp[144];
+    size_t i, l, b, rsiz, rsizw, nblocks[4], maxblocks = 0;
+    const keccakf_x4_fn permute = keccakf_x4_select();
+
+    static_assert(HASH_DATA_AREA <= sizeof(temp), "Bad keccak preconditions");
+    if (mdlen <= 0 || (mdlen > 100 && 200 != mdlen) || ((size_t)mdlen % sizeof(uint64_t)) != 0)
+    {
+      keccak_abort("Bad keccak use");
+    }
+
+    rsiz = 200 == mdlen ? HASH_DATA_AREA : 200 - 2 * mdlen;
+    rsizw = rsiz / 8;
+    if (rsiz == 0 || rsiz > sizeof(temp))
+    {
+      keccak_abort("Bad keccak use");
+    }
+
+    for (l = 0; l < 4; l++) {
+      nblocks[l] = inlen[l] / rsiz + 1;
+      if (nblocks[l] > maxblocks)
+        maxblocks = nblocks[l];
+    }
+
+    memset(st, 0, sizeof(st));
+
+    for (b = 0; b < maxblocks; b++) {
+      for (l = 0; l < 4; l++) {
+        if (b + 1 < nblocks[l]) {
+          for (i = 0; i < rsizw; i++) {
+            uint64_t ina;
+            memcpy(&ina, in[l] + b * rsiz + i * 8, 8);
+            st[i][l] ^= swap64le(ina);
+          }
+        } else if (b + 1 == nblocks[l]) {
+          // last block and padding
+          const size_t rem = inlen[l] - b * rsiz;
+          if (rem > 0)
+            memcpy(temp, in[l] + b * rsiz, rem);
+          temp[rem] = 1;
+          memset(temp + rem + 1, 0, rsiz - rem - 1);
+          temp[rsiz - 1] |= 0x80;
+          for (i = 0; i < rsizw; i++) {
+            uint64_t ina;
+            memcpy(&ina, temp + i * 8, 8);
+            st[i][l] ^= swap64le(ina);
+          }
+        }
+      }
+
+      permute(st, KECCAK_ROUNDS);
+
+      for (l = 0; l < 4; l++) {
+        if (b + 1 == nblocks[l]) {
+          for (i = 0; i < (size_t)mdlen / 8; i++) {
+            const uint64_t w = swap64le(st[i][l]);
+            memcpy(md[l] + i * 8, &w, 8);
+          }
+        }
+      }
+    }
+}
@@ -9,7 +9,7 @@
 #include "hash-ops.h"
 #include "keccak.h"
 
-static void local_abort(const char *msg)
+void keccak_abort(const char *msg)
 {
   fprintf(stderr, "%s\n", msg);
 #ifdef NDEBUG
@@ -96,7 +96,7 @@ void keccak(const uint8_t *in, size_t inlen, uint8_t *md, int mdlen)
     static_assert(HASH_DATA_AREA <= sizeof(temp), "Bad keccak preconditions");
     if (mdlen <= 0 || (mdlen > 100 && sizeof(st) != (size_t)mdlen))
     {
-      local_abort("Bad keccak use");
+      keccak_abort("Bad keccak use");
     }
 
     rsiz = sizeof(state_t) == mdlen ? HASH_DATA_AREA : 200 - 2 * mdlen;
@@ -116,7 +116,7 @@ void keccak(const uint8_t *in, size_t inlen, uint8_t *md, int mdlen)
     // last block and padding
     if (inlen + 1 >= sizeof(temp) || inlen > rsiz || rsiz - inlen + inlen + 1 >= sizeof(temp) || rsiz == 0 || rsiz - 1 >= sizeof(temp) || rsizw * 8 > sizeof(temp))
     {
-      local_abort("Bad keccak use");
+      keccak_abort("Bad keccak use");
     }
 
     if (inlen > 0)
@@ -132,7 +132,7 @@ void keccak(const uint8_t *in, size_t inlen, uint8_t *md, int mdlen)
 
     if (((size_t)mdlen % sizeof(uint64_t)) != 0)
     {
-      local_abort("Bad keccak use");
+      keccak_abort("Bad keccak use");
     }
     memcpy_swap64le(md, st, mdlen/sizeof(uint64_t));
 }
@@ -160,7 +160,7 @@ void keccak_init(KECCAK_CTX * ctx){
 
 void keccak_update(KECCAK_CTX * ctx, const uint8_t *in, size_t inlen){
     if (ctx->rest & KECCAK_FINALIZED) {
-        local_abort("Bad keccak use");
+        keccak_abort("Bad keccak use");
     }
 
     const size_t idx = ctx->rest;
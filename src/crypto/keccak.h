@@ -34,6 +34,13 @@ void keccakf(uint64_t st[25], int norounds);
 
 void keccak1600(const uint8_t *in, size_t inlen, uint8_t *md);
 
+// 4-way keccak: state word i of message l lives in st[i][l]
+void keccakf_x4(uint64_t st[25][4], int norounds);
+int keccakf_x4_uses_avx2(void);
+
+// compute four independent keccak hashes at once, same output as keccak()
+void keccak_x4(const uint8_t *const in[4], const size_t inlen[4], uint8_t *const md[4], int mdlen);
+
 void keccak_init(KECCAK_CTX * ctx);
 void keccak_update(KECCAK_CTX * ctx, const uint8_t *in, size_t inlen);
 void keccak_finish(KECCAK_CTX * ctx, uint8_t *md);
@@ -85,22 +85,33 @@ void tree_hash(const char (*hashes)[HASH_SIZE], size_t count, char *root_hash) {
 
     char *ints = calloc(cnt, HASH_SIZE);  // zero out as extra protection for using uninitialized mem
     assert(ints);
+    const void **pairs = malloc(cnt * sizeof(*pairs));
+    size_t *lengths = malloc(cnt * sizeof(*lengths));
+    assert(pairs && lengths);
+    for (j = 0; j < cnt; ++j)
+      lengths[j] = 64;
 
     memcpy(ints, hashes, (2 * cnt - count) * HASH_SIZE);
 
-    for (i = 2 * cnt - count, j = 2 * cnt - count; j < cnt; i += 2, ++j) {
-      cn_fast_hash(hashes[i], 64, ints + j * HASH_SIZE);
+    // each level is hashed as one batch of independent 64 byte pairs
+    for (i = 2 * cnt - count, j = 0; i < count; i += 2, ++j) {
+      pairs[j] = hashes[i];
     }
+    cn_fast_hash_multi(pairs, lengths, j, ints + (2 * cnt - count) * HASH_SIZE);
     assert(i == count);
+    assert(j == count - cnt);
 
     while (cnt > 2) {
       cnt >>= 1;
       for (i = 0, j = 0; j < cnt; i += 2, ++j) {
-        cn_fast_hash(ints + i * HASH_SIZE, 64, ints + j * HASH_SIZE);
+        pairs[j] = ints + i * HASH_SIZE;
       }
+      cn_fast_hash_multi(pairs, lengths, cnt, ints);
     }
 
     cn_fast_hash(ints, 64, root_hash);
+    free(lengths);
+    free(pairs);
     free(ints);
   }
 }
@@ -43,7 +43,8 @@ namespace cryptonote
   {
     cryptonote_connection_context(): m_state(state_before_handshake), m_remote_blockchain_height(0), m_last_response_height(0),
         m_last_request_time(boost::date_time::not_a_date_time), m_callback_request_count(0),
-        m_last_known_hash(crypto::null_hash), m_pruning_seed(0), m_rpc_port(0), m_rpc_credits_per_hash(0),  m_anchor(false) {}
+        m_last_known_hash(crypto::null_hash), m_pruning_seed(0), m_rpc_port(0), m_rpc_credits_per_hash(0),  m_anchor(false),
+        m_sync_download_rate(0.0f), m_sync_rtt(0.0f), m_txpool_sketch_sent(false), m_sync_serve_tat(0) {}
 
     enum state
     {
@@ -66,6 +67,10 @@ namespace cryptonote
     uint16_t m_rpc_port;
     uint32_t m_rpc_credits_per_hash;
     bool m_anchor;
+    float m_sync_download_rate; // bytes/sec over recent block responses, 0 if unknown
+    float m_sync_rtt; // seconds, from recent chain entry responses, 0 if unknown
+    bool m_txpool_sketch_sent;
+    uint64_t m_sync_serve_tat; // this peer's share of the block sync budget, see handler_response_blocks_now
     //size_t m_score;  TODO: add score calculations
   };
 
@@ -32,11 +32,13 @@
 #include <boost/algorithm/string.hpp>
 #include "wipeable_string.h"
 #include "string_tools.h"
+#include "int-util.h"
 #include "serialization/string.h"
 #include "cryptonote_format_utils.h"
 #include "cryptonote_config.h"
 #include "crypto/crypto.h"
 #include "crypto/hash.h"
+#include "crypto/siphash.h"
 #include "ringct/rctSigs.h"
 
 using namespace epee;
@@ -1139,6 +1141,19 @@ namespace cryptonote
     cn_fast_hash(blob.data(), blob.size(), res);
   }
   //---------------------------------------------------------------
+  void get_blob_hashes(const epee::span<const epee::span<const char>>& blobs, epee::span<crypto::hash> hashes)
+  {
+    CHECK_AND_ASSERT_THROW_MES(blobs.size() == hashes.size(), "Mismatched blob and hash counts");
+    std::vector<const void*> data(blobs.size());
+    std::vector<size_t> lengths(blobs.size());
+    for (size_t i = 0; i < blobs.size(); ++i)
+    {
+      data[i] = blobs[i].data();
+      lengths[i] = blobs[i].size();
+    }
+    crypto::cn_fast_hash_multi(data.data(), lengths.data(), blobs.size(), hashes.data());
+  }
+  //---------------------------------------------------------------
   void set_default_decimal_point(unsigned int decimal_point)
   {
     switch (decimal_point)
@@ -1342,16 +1357,19 @@ namespace cryptonote
     // v2 transactions hash different parts together, than hash the set of those hashes
     crypto::hash hashes[3];
 
-    // prefix
-    get_transaction_prefix_hash(t, hashes[0]);
-
     const blobdata blob = tx_to_blob(t);
     const unsigned int unprunable_size = t.unprunable_size;
     const unsigned int prefix_size = t.prefix_size;
-
-    // base rct
     CHECK_AND_ASSERT_MES(prefix_size <= unprunable_size && unprunable_size <= blob.size(), false, "Inconsistent transaction prefix, unprunable and blob sizes");
-    cryptonote::get_blob_hash(epee::span<const char>(blob.data() + prefix_size, unprunable_size - prefix_size), hashes[1]);
+
+    // prefix, base rct and prunable rct are independent hashes of the blob
+    // we just serialized, so they can go through keccak side by side
+    const epee::span<const char> parts[3] = {
+      epee::span<const char>(blob.data(), prefix_size),
+      epee::span<const char>(blob.data() + prefix_size, unprunable_size - prefix_size),
+      epee::span<const char>(blob.data() + unprunable_size, blob.size() - unprunable_size)
+    };
+    size_t nparts = 2;
 
     // prunable rct
     if (t.rct_signatures.type == rct::RCTTypeNull)
@@ -1360,9 +1378,12 @@ namespace cryptonote
     }
     else
     {
-      CHECK_AND_ASSERT_MES(calculate_transaction_prunable_hash(t, &blob, hashes[2]), false, "Failed to get tx prunable hash");
+      CHECK_AND_ASSERT_MES(t.version > 1, false, "Failed to get tx prunable hash");
+      nparts = 3;
     }
 
+    get_blob_hashes(epee::span<const epee::span<const char>>(parts, nparts), epee::span<crypto::hash>(hashes, nparts));
+
     // the tx hash is the hash of the 3 hashes
     res = cn_fast_hash(hashes, sizeof(hashes));
 
@@ -1424,6 +1445,20 @@ namespace cryptonote
     return blob;
   }
   //---------------------------------------------------------------
+  size_t get_nonce_offset(const block& b)
+  {
+    // the nonce follows the varint versions and timestamp and the previous block id
+    return tools::get_varint_data(b.major_version).size() + tools::get_varint_data(b.minor_version).size() +
+      tools::get_varint_data(b.timestamp).size() + sizeof(crypto::hash);
+  }
+  //---------------------------------------------------------------
+  void set_blob_nonce(blobdata& blob, size_t offset, uint32_t nonce)
+  {
+    CHECK_AND_ASSERT_THROW_MES(offset + sizeof(nonce) <= blob.size(), "Nonce offset out of the hashing blob");
+    nonce = SWAP32LE(nonce);
+    memcpy(&blob[offset], &nonce, sizeof(nonce));
+  }
+  //---------------------------------------------------------------
   bool calculate_block_hash(const block& b, crypto::hash& res, const blobdata *blob)
   {
     blobdata bd;
@@ -1493,6 +1528,26 @@ namespace cryptonote
     return p;
   }
   //---------------------------------------------------------------
+  short_tx_id_key get_short_tx_id_key(const crypto::hash& block_hash, uint64_t salt)
+  {
+    static_assert(sizeof(short_tx_id_key::data) == SIPHASH_KEYLEN, "Unexpected siphash key size");
+    char data[sizeof(crypto::hash) + sizeof(uint64_t)];
+    memcpy(data, &block_hash, sizeof(crypto::hash));
+    salt = SWAP64LE(salt);
+    memcpy(data + sizeof(crypto::hash), &salt, sizeof(uint64_t));
+    const crypto::hash h = crypto::cn_fast_hash(data, sizeof(data));
+    short_tx_id_key key;
+    memcpy(key.data, &h, sizeof(key.data));
+    return key;
+  }
+  //---------------------------------------------------------------
+  uint64_t get_short_tx_id(const short_tx_id_key& key, const crypto::hash& tx_hash)
+  {
+    static_assert(COMPACT_BLOCK_SHORT_TX_ID_SIZE < sizeof(uint64_t), "Short tx id too large");
+    const uint64_t h = siphash24(key.data, (const uint8_t*)tx_hash.data, sizeof(tx_hash.data));
+    return h & ((((uint64_t)1) << (8 * COMPACT_BLOCK_SHORT_TX_ID_SIZE)) - 1);
+  }
+  //---------------------------------------------------------------
   std::vector<uint64_t> relative_output_offsets_to_absolute(const std::vector<uint64_t>& off)
   {
     std::vector<uint64_t> res = off;
@@ -109,6 +109,7 @@ namespace cryptonote
   void get_blob_hash(const epee::span<const char>& blob, crypto::hash& res);
   crypto::hash get_blob_hash(const blobdata& blob);
   crypto::hash get_blob_hash(const epee::span<const char>& blob);
+  void get_blob_hashes(const epee::span<const epee::span<const char>>& blobs, epee::span<crypto::hash> hashes);
   std::string short_hash_str(const crypto::hash& h);
 
   crypto::hash get_transaction_hash(const transaction& t);
@@ -121,12 +122,17 @@ namespace cryptonote
   crypto::hash get_pruned_transaction_hash(const transaction& t, const crypto::hash &pruned_data_hash);
 
   blobdata get_block_hashing_blob(const block& b);
+  size_t get_nonce_offset(const block& b); // where the nonce sits in get_block_hashing_blob(b)
+  void set_blob_nonce(blobdata& blob, size_t offset, uint32_t nonce);
   bool calculate_block_hash(const block& b, crypto::hash& res, const blobdata *blob = NULL);
   bool get_block_hash(const block& b, crypto::hash& res);
   crypto::hash get_block_hash(const block& b);
   bool parse_and_validate_block_from_blob(const blobdata& b_blob, block& b, crypto::hash *block_hash);
   bool parse_and_validate_block_from_blob(const blobdata& b_blob, block& b);
   bool parse_and_validate_block_from_blob(const blobdata& b_blob, block& b, crypto::hash &block_hash);
+  struct short_tx_id_key { uint8_t data[16]; };
+  short_tx_id_key get_short_tx_id_key(const crypto::hash& block_hash, uint64_t salt);
+  uint64_t get_short_tx_id(const short_tx_id_key& key, const crypto::hash& tx_hash);
   bool get_inputs_money_amount(const transaction& tx, uint64_t& money);
   std::map<std::string, uint64_t> get_outs_money_amount(const transaction& tx);
   bool check_inputs_types_supported(const transaction& tx);
@@ -79,6 +79,10 @@
 #define AUTODETECT_WINDOW 10 // seconds
 #define AUTODETECT_GAIN_THRESHOLD 1.02f  // 2%
 
+// nonces hashed together by each thread with the interleaved CN-Heavy kernel; two lanes
+// already hide most of the latency without doubling every thread's cache footprint again
+#define MINER_HASH_WAYS 2
+
 using namespace epee;
 
 #include "miner.h"
@@ -205,7 +209,14 @@ namespace cryptonote
   {
     if(m_last_hr_merge_time && is_mining())
     {
-      m_current_hash_rate = m_hashes * 1000 / ((misc_utils::get_tick_count() - m_last_hr_merge_time + 1));
+      const uint64_t dt = misc_utils::get_tick_count() - m_last_hr_merge_time + 1;
+      m_current_hash_rate = m_hashes * 1000 / dt;
+      {
+        CRITICAL_REGION_LOCAL(m_thread_hashes_lock);
+        m_thread_hash_rates.resize(std::min<size_t>(m_thread_hashes.size(), m_threads_total));
+        for (size_t i = 0; i < m_thread_hash_rates.size(); ++i)
+          m_thread_hash_rates[i] = m_thread_hashes[i] * 1000 / dt;
+      }
       CRITICAL_REGION_LOCAL(m_last_hash_rates_lock);
       m_last_hash_rates.push_back(m_current_hash_rate);
       if(m_last_hash_rates.size() > 19)
@@ -221,6 +232,8 @@ namespace cryptonote
     }
     m_last_hr_merge_time = misc_utils::get_tick_count();
     m_hashes = 0;
+    CRITICAL_REGION_LOCAL(m_thread_hashes_lock);
+    std::fill(m_thread_hashes.begin(), m_thread_hashes.end(), 0);
   }
   //-----------------------------------------------------------------------------------------------------
   void miner::update_autodetection()
@@ -428,6 +441,14 @@ namespace cryptonote
     }
   }
   //-----------------------------------------------------------------------------------------------------
+  std::vector<uint64_t> miner::get_threads_speed() const
+  {
+    if(!is_mining())
+      return {};
+    CRITICAL_REGION_LOCAL(m_thread_hashes_lock);
+    return m_thread_hash_rates;
+  }
+  //-----------------------------------------------------------------------------------------------------
   void miner::send_stop_signal()
   {
     boost::interprocess::ipcdetail::atomic_write32(&m_stop, 1);
@@ -465,6 +486,11 @@ namespace cryptonote
     MINFO("Mining has been stopped, " << m_threads.size() << " finished" );
     m_threads.clear();
     m_threads_autodetect.clear();
+    {
+      CRITICAL_REGION_LOCAL(m_thread_hashes_lock);
+      m_thread_hashes.clear();
+      m_thread_hash_rates.clear();
+    }
     rx_stop_mining();
     return true;
   }
@@ -527,6 +553,16 @@ namespace cryptonote
     difficulty_type local_diff = 0;
     uint32_t local_template_ver = 0;
     block b;
+    // the hashing blob is built once per template, each lane then only patches in its nonce
+    std::vector<blobdata> blobs(MINER_HASH_WAYS);
+    std::vector<uint8_t> major_versions(MINER_HASH_WAYS);
+    std::vector<crypto::hash> h(MINER_HASH_WAYS);
+    size_t nonce_offset = 0;
+    {
+      CRITICAL_REGION_LOCAL(m_thread_hashes_lock);
+      if (m_thread_hashes.size() <= th_local_index)
+        m_thread_hashes.resize(th_local_index + 1, 0);
+    }
     ++m_threads_active;
     while(!m_stop)
     {
@@ -558,6 +594,12 @@ namespace cryptonote
         CRITICAL_REGION_END();
         local_template_ver = m_template_no;
         nonce = m_starter_nonce + th_local_index;
+
+        blobs[0] = get_block_hashing_blob(b);
+        nonce_offset = get_nonce_offset(b);
+        for (size_t i = 1; i < MINER_HASH_WAYS; ++i)
+          blobs[i] = blobs[0];
+        major_versions.assign(MINER_HASH_WAYS, b.major_version);
       }
 
       if(!local_template_ver)//no any set_block_template call
@@ -567,12 +609,32 @@ namespace cryptonote
         continue;
       }
 
-      b.nonce = nonce;
-      crypto::hash h;
-      m_gbh(b, height, tools::get_max_concurrency(), h);
+      // lane i takes the nonce this thread would have reached i rounds later
+      uint32_t nonces[MINER_HASH_WAYS];
+      for (size_t i = 0; i < MINER_HASH_WAYS; ++i)
+      {
+        nonces[i] = nonce + i * m_threads_total;
+        set_blob_nonce(blobs[i], nonce_offset, nonces[i]);
+      }
+      get_block_longhashes(NULL, major_versions, blobs, h);
 
-      if(check_hash(h, local_diff))
+      for (size_t i = 0; i < MINER_HASH_WAYS; ++i)
       {
+        if(!check_hash(h[i], local_diff))
+          continue;
+
+        // the patched blob should always match, but a block is only submitted once
+        // the full serialization path agrees
+        b.nonce = nonces[i];
+        b.invalidate_hashes();
+        crypto::hash check;
+        m_gbh(b, height, tools::get_max_concurrency(), check);
+        if (check != h[i])
+        {
+          MERROR("PoW of the patched hashing blob does not match the block's, nonce " << nonces[i]);
+          continue;
+        }
+
         //we lucky!
         ++m_config.current_extra_message_index;
         MGINFO_GREEN("Found block " << get_block_hash(b) << " at height " << height << " for difficulty: " << local_diff);
@@ -586,10 +648,16 @@ namespace cryptonote
           if (!m_config_folder_path.empty())
             epee::serialization::store_t_to_json_file(m_config, m_config_folder_path + "/" + MINER_CONFIG_FILE_NAME);
         }
+        // the template is stale now
+        break;
+      }
+      nonce += MINER_HASH_WAYS * m_threads_total;
+      m_hashes += MINER_HASH_WAYS;
+      m_total_hashes += MINER_HASH_WAYS;
+      {
+        CRITICAL_REGION_LOCAL(m_thread_hashes_lock);
+        m_thread_hashes[th_local_index] += MINER_HASH_WAYS;
       }
-      nonce+=m_threads_total;
-      ++m_hashes;
-      ++m_total_hashes;
     }
     MGINFO("Miner thread stopped ["<< th_local_index << "]");
     --m_threads_active;
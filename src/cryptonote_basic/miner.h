@@ -68,6 +68,7 @@ namespace cryptonote
     bool on_block_chain_update();
     bool start(const account_public_address& adr, size_t threads_count, bool do_background = false, bool ignore_battery = false);
     uint64_t get_speed() const;
+    std::vector<uint64_t> get_threads_speed() const;
     uint32_t get_threads_count() const;
     void send_stop_signal();
     bool stop();
@@ -149,6 +150,9 @@ namespace cryptonote
     std::atomic<uint64_t> m_current_hash_rate;
     epee::critical_section m_last_hash_rates_lock;
     std::list<uint64_t> m_last_hash_rates;
+    mutable epee::critical_section m_thread_hashes_lock;
+    std::vector<uint64_t> m_thread_hashes;
+    std::vector<uint64_t> m_thread_hash_rates;
     bool m_do_print_hashrate;
     bool m_do_mining;
     std::vector<std::pair<uint64_t, uint64_t>> m_threads_autodetect;
@@ -95,6 +95,9 @@ DISABLE_VS_WARNINGS(4267)
 // used to overestimate the block reward when estimating a per kB to use
 #define BLOCK_REWARD_OVERESTIMATE (10 * 1000000000000)
 
+#define PREVERIFIED_BLOCKS_MAX_COUNT 20000
+#define PREVERIFIED_RANGE_PROOFS_MAX_COUNT 100000
+
 //------------------------------------------------------------------
 Blockchain::Blockchain(tx_memory_pool& tx_pool) :
   m_db(), m_tx_pool(tx_pool), m_hardfork(NULL), m_timestamps_and_difficulties_height(0), m_reset_timestamps_and_difficulties_height(true), m_current_block_cumul_weight_limit(0), m_current_block_cumul_weight_median(0),
@@ -5205,7 +5208,13 @@ leave: {
   // validate the pricing record
   if (hf_version >= HF_VERSION_OFFSHORE_PRICING) {
     TIME_MEASURE_START(pricing_record);
-    if (!bl.pricing_record.valid(m_nettype, hf_version, bl.timestamp, m_db->get_top_block_timestamp())) {
+    bool pr_signature_checked = false;
+    {
+      boost::unique_lock<boost::mutex> lock(m_preverified_blocks_lock);
+      const auto it = m_preverified_blocks.find(id);
+      pr_signature_checked = it != m_preverified_blocks.end() && it->second.second;
+    }
+    if (!bl.pricing_record.valid(m_nettype, hf_version, bl.timestamp, m_db->get_top_block_timestamp(), !pr_signature_checked)) {
       MERROR_VER("Block with id: " << id << std::endl << "has invalid pricing record!");
       bvc.m_verifivation_failed = true;
       goto leave;
@@ -5271,7 +5280,21 @@ leave: {
       proof_of_work = it->second;
     }
     else
+    {
+      boost::unique_lock<boost::mutex> lock(m_preverified_blocks_lock);
+      const auto pit = m_preverified_blocks.find(id);
+      if (pit != m_preverified_blocks.end())
+      {
+        precomputed = true;
+        proof_of_work = pit->second.first;
+      }
+    }
+    if (!precomputed)
       proof_of_work = get_block_longhash(this, bl, blockchain_height, 0);
+    {
+      boost::unique_lock<boost::mutex> lock(m_preverified_blocks_lock);
+      m_preverified_blocks.erase(id);
+    }
 
     // validate proof_of_work versus difficulty target
     if(!check_hash(proof_of_work, current_diffic))
@@ -5934,16 +5957,167 @@ void Blockchain::block_longhash_worker(uint64_t height, const epee::span<const b
 {
   TIME_MEASURE_START(t);
 
-  for (const auto & block : blocks)
+  // blocks still needing PoW are hashed BLOCK_LONGHASH_MAX_WAYS at a time, so the
+  // interleaved kernel keeps this core busy while each lane waits on memory
+  size_t hashed = 0;
+  std::vector<const block*> pending;
+  std::vector<crypto::hash> pending_ids, pows;
+  pending.reserve(BLOCK_LONGHASH_MAX_WAYS);
+  pending_ids.reserve(BLOCK_LONGHASH_MAX_WAYS);
+  for (size_t i = 0; i <= blocks.size(); ++i)
   {
     if (m_cancel)
        break;
-    crypto::hash id = get_block_hash(block);
-    crypto::hash pow = get_block_longhash(this, block, height++, 0);
-    map.emplace(id, pow);
+    if (i < blocks.size())
+    {
+      const block &b = blocks[i];
+      crypto::hash id = get_block_hash(b);
+      crypto::hash pow = crypto::null_hash;
+      {
+        boost::unique_lock<boost::mutex> lock(m_preverified_blocks_lock);
+        const auto it = m_preverified_blocks.find(id);
+        if (it != m_preverified_blocks.end())
+          pow = it->second.first;
+      }
+      if (pow != crypto::null_hash)
+      {
+        map.emplace(id, pow);
+        continue;
+      }
+      pending.push_back(&b);
+      pending_ids.push_back(id);
+      if (pending.size() < BLOCK_LONGHASH_MAX_WAYS)
+        continue;
+    }
+    if (pending.empty())
+      continue;
+
+    get_block_longhashes(this, pending, pows);
+    for (size_t j = 0; j < pending.size(); ++j)
+      map.emplace(pending_ids[j], pows[j]);
+    hashed += pending.size();
+    pending.clear();
+    pending_ids.clear();
   }
 
   TIME_MEASURE_FINISH(t);
+  if (hashed > 0)
+    MDEBUG("PoW worker hashed " << hashed << "/" << blocks.size() << " blocks in " << t << " ms ("
+        << (t ? hashed * 1000 / t : hashed * 1000) << " H/s)");
+}
+
+//------------------------------------------------------------------
+bool Blockchain::preverify_blocks(const std::vector<block_complete_entry> &blocks_entry)
+{
+  MTRACE("Blockchain::" << __func__);
+  TIME_MEASURE_START(t);
+
+  static const unsigned char null_signature[sizeof(offshore::pricing_record::signature)] = {0};
+  size_t preverified = 0, preverified_txes = 0;
+  for (const auto &entry : blocks_entry)
+  {
+    if (m_cancel)
+      return true;
+
+    block bl;
+    crypto::hash id;
+    if (!parse_and_validate_block_from_blob(entry.block, bl, id))
+    {
+      MDEBUG("Failed to parse block while preverifying");
+      return false;
+    }
+
+    {
+      boost::unique_lock<boost::mutex> lock(m_preverified_blocks_lock);
+      if (m_preverified_blocks.find(id) != m_preverified_blocks.end())
+        continue;
+      // entries for spans which were dropped are never consumed, start afresh
+      if (m_preverified_blocks.size() >= PREVERIFIED_BLOCKS_MAX_COUNT)
+      {
+        MDEBUG("Preverified blocks cache full, clearing");
+        m_preverified_blocks.clear();
+      }
+    }
+
+    // the pow hash only depends on the block itself, not on its height
+    const crypto::hash pow = get_block_longhash(this, bl, 0, 0);
+
+    bool pr_signature_ok = false;
+    if (memcmp(bl.pricing_record.signature, null_signature, sizeof(null_signature)))
+    {
+      try
+      {
+        pr_signature_ok = bl.pricing_record.verifySignature(get_config(m_nettype).ORACLE_PUBLIC_KEY);
+      }
+      catch (const std::exception &e)
+      {
+        MDEBUG("Failed to check pricing record signature of block " << id << ": " << e.what());
+      }
+      // whether this is fatal depends on the fork version, leave it to the full check
+      if (!pr_signature_ok)
+        MDEBUG("Block " << id << " has a bad pricing record signature");
+    }
+
+    {
+      boost::unique_lock<boost::mutex> lock(m_preverified_blocks_lock);
+      m_preverified_blocks.emplace(id, std::make_pair(pow, pr_signature_ok));
+    }
+    ++preverified;
+
+    // range proofs don't depend on the pricing record or on the chain, unlike the
+    // amount checks of the rct semantics, so they can be verified this early too
+    if (entry.pruned)
+      continue;
+    for (const auto &tx_entry : entry.txs)
+    {
+      if (m_cancel)
+        return true;
+      transaction tx;
+      crypto::hash txid;
+      if (!parse_and_validate_tx_from_blob(tx_entry.blob, tx, txid))
+      {
+        MDEBUG("Failed to parse tx of block " << id << " while preverifying");
+        continue;
+      }
+      if (tx.version < 2 || !rct::is_rct_bulletproof(tx.rct_signatures.type) || tx.rct_signatures.p.bulletproofs.empty())
+        continue;
+      {
+        boost::unique_lock<boost::mutex> lock(m_preverified_blocks_lock);
+        if (m_preverified_range_proofs.find(txid) != m_preverified_range_proofs.end())
+          continue;
+      }
+
+      std::vector<const rct::Bulletproof*> proofs;
+      for (const auto &proof : tx.rct_signatures.p.bulletproofs)
+        proofs.push_back(&proof);
+      // a failure is left for the full check to report
+      if (!rct::verBulletproof(proofs))
+      {
+        MDEBUG("Range proofs of tx " << txid << " failed to verify");
+        continue;
+      }
+
+      boost::unique_lock<boost::mutex> lock(m_preverified_blocks_lock);
+      if (m_preverified_range_proofs.size() >= PREVERIFIED_RANGE_PROOFS_MAX_COUNT)
+      {
+        MDEBUG("Preverified range proofs cache full, clearing");
+        m_preverified_range_proofs.clear();
+      }
+      m_preverified_range_proofs.insert(txid);
+      ++preverified_txes;
+    }
+  }
+
+  TIME_MEASURE_FINISH(t);
+  MDEBUG("Preverified " << preverified << "/" << blocks_entry.size() << " blocks and " << preverified_txes << " txes in " << t << " ms");
+  return true;
+}
+
+//------------------------------------------------------------------
+bool Blockchain::take_preverified_range_proofs(const crypto::hash &txid)
+{
+  boost::unique_lock<boost::mutex> lock(m_preverified_blocks_lock);
+  return m_preverified_range_proofs.erase(txid) > 0;
 }
 
 //------------------------------------------------------------------
@@ -6357,8 +6531,41 @@ bool Blockchain::prepare_handle_incoming_blocks(const std::vector<block_complete
             return false; \
         } while(0); \
 
-  // generate sorted tables for all amounts and absolute offsets
+  // parse all txes first, so their prefix hashes can be computed as one batch
   size_t tx_index = 0, block_index = 0;
+  {
+    std::vector<epee::span<const char>> prefix_spans(total_txs);
+    for (const auto &entry : blocks_entry)
+    {
+      if (m_cancel)
+        return false;
+
+      for (const auto &tx_blob : entry.txs)
+      {
+        if (tx_index >= txes.size())
+          SCAN_TABLE_QUIT("tx_index is out of sync");
+        transaction &tx = txes[tx_index].first;
+
+        if (!parse_and_validate_tx_base_from_blob(tx_blob.blob, tx))
+          SCAN_TABLE_QUIT("Could not parse tx from incoming blocks.");
+        // the prefix is the start of the blob, no need to serialize it again
+        if (tx.prefix_size == 0 || tx.prefix_size > tx_blob.blob.size())
+          SCAN_TABLE_QUIT("Could not find tx prefix in incoming blocks.");
+        prefix_spans[tx_index] = epee::span<const char>(tx_blob.blob.data(), tx.prefix_size);
+        ++tx_index;
+      }
+    }
+    if (tx_index != txes.size())
+      SCAN_TABLE_QUIT("tx_index is out of sync");
+
+    std::vector<crypto::hash> prefix_hashes(prefix_spans.size());
+    get_blob_hashes(epee::to_span(prefix_spans), epee::to_mut_span(prefix_hashes));
+    for (size_t i = 0; i < txes.size(); ++i)
+      txes[i].second = prefix_hashes[i];
+  }
+
+  // generate sorted tables for all amounts and absolute offsets
+  tx_index = 0;
   for (const auto &entry : blocks_entry)
   {
     if (m_cancel)
@@ -6372,10 +6579,6 @@ bool Blockchain::prepare_handle_incoming_blocks(const std::vector<block_complete
       crypto::hash &tx_prefix_hash = txes[tx_index].second;
       ++tx_index;
 
-      if (!parse_and_validate_tx_base_from_blob(tx_blob.blob, tx))
-        SCAN_TABLE_QUIT("Could not parse tx from incoming blocks.");
-      cryptonote::get_transaction_prefix_hash(tx, tx_prefix_hash);
-
       auto its = m_scan_table.find(tx_prefix_hash);
       if (its != m_scan_table.end())
         SCAN_TABLE_QUIT("Duplicate tx found from incoming blocks.");
@@ -250,6 +250,29 @@ namespace cryptonote
      */
     bool cleanup_handle_incoming_blocks(bool force_sync = false);
 
+    /**
+     * @brief runs the context free checks on a span of blocks ahead of the chain
+     *
+     * Computes the proof of work hash and checks the pricing record signature
+     * of each block, and verifies the range proofs of their transactions,
+     * caching the results so that only contextual checks are left once the
+     * blocks are handled. The blockchain lock is not taken.
+     *
+     * @param blocks_entry a list of incoming blocks
+     *
+     * @return false if a block could not be parsed, else true
+     */
+    bool preverify_blocks(const std::vector<block_complete_entry> &blocks_entry);
+
+    /**
+     * @brief consumes the range proof result preverify_blocks cached for a transaction
+     *
+     * @param txid the transaction hash, which commits to its range proofs
+     *
+     * @return true if its range proofs were already verified, false if they still need to be
+     */
+    bool take_preverified_range_proofs(const crypto::hash &txid);
+
     /**
      * @brief search the blockchain for a transaction by hash
      *
@@ -1070,6 +1093,11 @@ namespace cryptonote
     // metadata containers
     std::unordered_map<crypto::hash, std::unordered_map<crypto::key_image, std::vector<output_data_t>>> m_scan_table;
     std::unordered_map<crypto::hash, crypto::hash> m_blocks_longhash_table;
+    // results of preverify_blocks, by block hash: pow hash, and whether the pricing record signature checked out
+    std::unordered_map<crypto::hash, std::pair<crypto::hash, bool>> m_preverified_blocks;
+    // txes of those blocks whose range proofs verified, by tx hash
+    std::unordered_set<crypto::hash> m_preverified_range_proofs;
+    mutable boost::mutex m_preverified_blocks_lock;
     // Keccak hashes for each block and for fast pow checking
     std::vector<std::pair<crypto::hash, crypto::hash>> m_blocks_hash_of_hashes;
     std::vector<std::pair<crypto::hash, uint64_t>> m_blocks_hash_check;
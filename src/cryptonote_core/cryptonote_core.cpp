@@ -160,7 +160,7 @@ namespace cryptonote
   , "Show time-stats when processing blocks/txs and disk synchronization."
   , 0
   };
-  static const command_line::arg_descriptor<size_t> arg_block_sync_size  = {
+  const command_line::arg_descriptor<size_t> arg_block_sync_size  = {
     "block-sync-size"
   , "How many blocks to sync at once during chain synchronization (0 = adaptive)."
   , 0
@@ -872,6 +872,15 @@ namespace cryptonote
     const uint8_t hf_version = m_blockchain_storage.get_current_hard_fork_version();
     using tt = cryptonote::transaction_type;
     std::vector<const rct::rctSig*> rvv;
+
+    // key images of the whole batch (a block's txes, or a relayed set) are
+    // checked for torsion in one go rather than tx by tx
+    std::vector<const transaction*> txs(tx_info.size());
+    for (size_t n = 0; n < tx_info.size(); ++n)
+      txs[n] = tx_info[n].tx;
+    std::vector<bool> keyimages_domain_valid;
+    check_tx_inputs_keyimages_domain(txs, keyimages_domain_valid);
+
     for (size_t n = 0; n < tx_info.size(); ++n)
     {
       // Get the TX asset types
@@ -967,6 +976,15 @@ namespace cryptonote
         continue;
       }
 
+      if (!keyimages_domain_valid[n])
+      {
+        MERROR_VER("tx uses key image not in the valid domain");
+        set_semantics_failed(tx_info[n].tx_hash);
+        tx_info[n].tvc.m_verifivation_failed = true;
+        tx_info[n].result = false;
+        continue;
+      }
+
       if (tx_info[n].tx->version < 2)
         continue;
       const rct::rctSig &rv = tx_info[n].tx->rct_signatures;
@@ -1033,8 +1051,10 @@ namespace cryptonote
           continue;
         if (tx_info[n].tx->rct_signatures.type != rct::RCTTypeBulletproof && tx_info[n].tx->rct_signatures.type != rct::RCTTypeBulletproof2 && tx_info[n].tx->rct_signatures.type != rct::RCTTypeCLSAG && tx_info[n].tx->rct_signatures.type != rct::RCTTypeCLSAGN && tx_info[n].tx->rct_signatures.type != rct::RCTTypeHaven2 && tx_info[n].tx->rct_signatures.type != rct::RCTTypeHaven3)
           continue;
+        // txes of blocks preverified while queued had their range proofs checked already
+        const bool range_proofs_verified = m_blockchain_storage.take_preverified_range_proofs(tx_info[n].tx_hash);
         if (tx_info[n].tx->rct_signatures.type == rct::RCTTypeHaven2 || tx_info[n].tx->rct_signatures.type == rct::RCTTypeHaven3) {
-            if (!rct::verRctSemanticsSimple2(tx_info[n].tx->rct_signatures, tx_info[n].tvc.pr, tx_info[n].tvc.m_type, tx_info[n].tvc.m_source_asset, tx_info[n].tvc.m_dest_asset, tx_info[n].tx->amount_burnt, tx_info[n].tx->vout, tx_info[n].tx->vin, hf_version, tx_info[n].tx->collateral_indices, tx_info[n].tvc.m_collateral))
+            if (!rct::verRctSemanticsSimple2(tx_info[n].tx->rct_signatures, tx_info[n].tvc.pr, tx_info[n].tvc.m_type, tx_info[n].tvc.m_source_asset, tx_info[n].tvc.m_dest_asset, tx_info[n].tx->amount_burnt, tx_info[n].tx->vout, tx_info[n].tx->vin, hf_version, tx_info[n].tx->collateral_indices, tx_info[n].tvc.m_collateral, range_proofs_verified))
             {
               // 2 tx that used reorged pricing reocord for callateral calculation.
               if (epee::string_tools::pod_to_hex(tx_info[n].tx_hash) != "e9c0753df108cb9de343d78c3bbdec0cebd56ee5c26c09ecf46dbf8af7838956"
@@ -1049,7 +1069,7 @@ namespace cryptonote
               }
             }
         } else {
-          if (!rct::verRctSemanticsSimple(tx_info[n].tx->rct_signatures, tx_info[n].tvc.pr, tx_info[n].tvc.m_type, tx_info[n].tvc.m_source_asset, tx_info[n].tvc.m_dest_asset))
+          if (!rct::verRctSemanticsSimple(tx_info[n].tx->rct_signatures, tx_info[n].tvc.pr, tx_info[n].tvc.m_type, tx_info[n].tvc.m_source_asset, tx_info[n].tvc.m_dest_asset, range_proofs_verified))
           {
             set_semantics_failed(tx_info[n].tx_hash);
             tx_info[n].tvc.m_verifivation_failed = true;
@@ -1224,12 +1244,6 @@ namespace cryptonote
       return false;
     }
 
-    if (!check_tx_inputs_keyimages_domain(tx))
-    {
-      MERROR_VER("tx uses key image not in the valid domain");
-      return false;
-    }
-
     return true;
   }
   //-----------------------------------------------------------------------------------------------
@@ -1356,31 +1370,43 @@ namespace cryptonote
   //-----------------------------------------------------------------------------------------------
   bool core::check_tx_inputs_keyimages_domain(const transaction& tx) const
   {
-
-    for(const auto& in: tx.vin) {
-      if (in.type() == typeid(txin_to_key)) {
-        CHECKED_GET_SPECIFIC_VARIANT(in, const txin_to_key, tokey_in, false);
-        if (!(rct::scalarmultKey(rct::ki2rct(tokey_in.k_image), rct::curveOrder()) == rct::identity()))
-          return false;
-      } else if (in.type() == typeid(txin_offshore)) {
-        CHECKED_GET_SPECIFIC_VARIANT(in, const txin_offshore, tokey_in, false);
-        if (!(rct::scalarmultKey(rct::ki2rct(tokey_in.k_image), rct::curveOrder()) == rct::identity()))
-          return false;
-      } else if (in.type() == typeid(txin_onshore)) {
-        CHECKED_GET_SPECIFIC_VARIANT(in, const txin_onshore, tokey_in, false);
-        if (!(rct::scalarmultKey(rct::ki2rct(tokey_in.k_image), rct::curveOrder()) == rct::identity()))
-          return false;
-      } else if (in.type() == typeid(txin_xasset)) {
-        CHECKED_GET_SPECIFIC_VARIANT(in, const txin_xasset, tokey_in, false);
-        if (!(rct::scalarmultKey(rct::ki2rct(tokey_in.k_image), rct::curveOrder()) == rct::identity()))
-          return false;
-      } else {
-        MERROR_VER("wrong input type");
-        return false;
+    std::vector<bool> valid;
+    return check_tx_inputs_keyimages_domain(std::vector<const transaction*>(1, &tx), valid);
+  }
+  //-----------------------------------------------------------------------------------------------
+  bool core::check_tx_inputs_keyimages_domain(const std::vector<const transaction*>& txs, std::vector<bool>& valid) const
+  {
+    // gather the key images of all txes so they go through a single subgroup check
+    rct::keyV key_images;
+    std::vector<size_t> owners;
+    valid.assign(txs.size(), true);
+    for (size_t n = 0; n < txs.size(); ++n) {
+      for(const auto& in: txs[n]->vin) {
+        if (in.type() == typeid(txin_to_key)) {
+          key_images.push_back(rct::ki2rct(boost::get<txin_to_key>(in).k_image));
+        } else if (in.type() == typeid(txin_offshore)) {
+          key_images.push_back(rct::ki2rct(boost::get<txin_offshore>(in).k_image));
+        } else if (in.type() == typeid(txin_onshore)) {
+          key_images.push_back(rct::ki2rct(boost::get<txin_onshore>(in).k_image));
+        } else if (in.type() == typeid(txin_xasset)) {
+          key_images.push_back(rct::ki2rct(boost::get<txin_xasset>(in).k_image));
+        } else {
+          MERROR_VER("wrong input type");
+          valid[n] = false;
+          continue;
+        }
+        owners.push_back(n);
       }
     }
 
-    return true;
+    std::vector<bool> key_images_valid;
+    if (rct::isInMainSubgroup(key_images, key_images_valid))
+      return std::find(valid.begin(), valid.end(), false) == valid.end();
+
+    for (size_t i = 0; i < key_images.size(); ++i)
+      if (!key_images_valid[i])
+        valid[owners[i]] = false;
+    return false;
   }
   //-----------------------------------------------------------------------------------------------
   bool core::add_new_tx(transaction& tx, tx_verification_context& tvc, relay_method tx_relay, bool relayed)
@@ -1633,6 +1659,12 @@ namespace cryptonote
     return success;
   }
 
+  //-----------------------------------------------------------------------------------------------
+  bool core::preverify_blocks(const std::vector<block_complete_entry> &blocks_entry)
+  {
+    return m_blockchain_storage.preverify_blocks(blocks_entry);
+  }
+
   //-----------------------------------------------------------------------------------------------
   bool core::handle_incoming_block(const blobdata& block_blob, const block *b, block_verification_context& bvc, bool update_miner_blocktemplate)
   {
@@ -1742,6 +1774,11 @@ namespace cryptonote
     return m_mempool.get_transaction(id, tx, tx_category);
   }  
   //-----------------------------------------------------------------------------------------------
+  bool core::get_pool_transaction_hashes_by_short_ids(const short_tx_id_key &key, const std::vector<uint64_t> &short_ids, std::vector<crypto::hash> &hashes) const
+  {
+    return m_mempool.get_transaction_hashes_by_short_ids(key, short_ids, hashes);
+  }
+  //-----------------------------------------------------------------------------------------------
   bool core::pool_has_tx(const crypto::hash &id) const
   {
     return m_mempool.have_tx(id, relay_category::legacy);
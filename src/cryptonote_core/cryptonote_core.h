@@ -66,6 +66,7 @@ namespace cryptonote
   extern const command_line::arg_descriptor<difficulty_type> arg_fixed_difficulty;
   extern const command_line::arg_descriptor<bool> arg_offline;
   extern const command_line::arg_descriptor<size_t> arg_block_download_max_size;
+  extern const command_line::arg_descriptor<size_t> arg_block_sync_size;
   extern const command_line::arg_descriptor<bool> arg_sync_pruned_blocks;
 
   /************************************************************************/
@@ -190,6 +191,13 @@ namespace cryptonote
       * @note see Blockchain::cleanup_handle_incoming_blocks
       */
      bool cleanup_handle_incoming_blocks(bool force_sync = false);
+
+     /**
+      * @copydoc Blockchain::preverify_blocks
+      *
+      * @note see Blockchain::preverify_blocks
+      */
+     bool preverify_blocks(const std::vector<block_complete_entry> &blocks_entry);
      	     	
      /**
       * @brief check the size of a block against the current maximum
@@ -498,6 +506,13 @@ namespace cryptonote
       */
      bool get_pool_transaction(const crypto::hash& id, cryptonote::blobdata& tx, relay_category tx_category) const;
 
+     /**
+      * @copydoc tx_memory_pool::get_transaction_hashes_by_short_ids
+      *
+      * @note see tx_memory_pool::get_transaction_hashes_by_short_ids
+      */
+     bool get_pool_transaction_hashes_by_short_ids(const short_tx_id_key &key, const std::vector<uint64_t> &short_ids, std::vector<crypto::hash> &hashes) const;
+
      /**
       * @copydoc tx_memory_pool::get_pool_transactions_and_spent_keys_info
       * @param include_sensitive_txes include private transactions
@@ -1000,6 +1015,17 @@ namespace cryptonote
       */
      bool check_tx_inputs_keyimages_domain(const transaction& tx) const;
 
+     /**
+      * @brief verify that the input key images of a set of transactions
+      * are in the valid domain, checking all key images as one batch
+      *
+      * @param txs the transactions to check
+      * @param valid return-by-reference whether each transaction passed
+      *
+      * @return false if any key image is not in the valid domain, otherwise true
+      */
+     bool check_tx_inputs_keyimages_domain(const std::vector<const transaction*>& txs, std::vector<bool>& valid) const;
+
      /**
       * @brief attempts to relay any transactions in the mempool which need it
       *
@@ -1704,24 +1704,69 @@ namespace cryptonote
     rx_slow_hash(main_height, seed_height, seed_hash.data, bd.data(), bd.size(), res.data, 0, 1);
   }
 
-  bool get_block_longhash(const Blockchain *pbc, const block& b, crypto::hash& res, const uint64_t height, const int miners)
+  // one context per thread and lane, so the scratchpad is allocated and faulted in once
+  // rather than for every block hashed by the sync workers, the miner or RPC. Lanes past
+  // the first are only allocated by threads that hash several blocks at once
+  static cn_pow_hash_v3& get_pow_context(size_t lane)
   {
-    block b_local = b; //workaround to avoid const errors with do_serialize
-    blobdata bd = get_block_hashing_blob(b);
-    cn_pow_hash_v3 ctx;
-    if(b_local.major_version >= CRYPTONOTE_V3_POW_BLOCK_VERSION)
-    {
-      ctx.hash(bd.data(), bd.size(), res.data);
-    }
-    else if(b_local.major_version == CRYPTONOTE_V2_POW_BLOCK_VERSION)
+    static thread_local std::unique_ptr<cn_pow_hash_v3> ctx[BLOCK_LONGHASH_MAX_WAYS];
+    if (!ctx[lane])
+      ctx[lane].reset(new cn_pow_hash_v3());
+    return *ctx[lane];
+  }
+
+  // the CN-Heavy variant of a block's PoW, the only place it is derived from the major version
+  static int get_pow_variant(uint8_t major_version)
+  {
+    if (major_version >= CRYPTONOTE_V3_POW_BLOCK_VERSION)
+      return 3;
+    if (major_version == CRYPTONOTE_V2_POW_BLOCK_VERSION)
+      return 2;
+    return 1;
+  }
+
+  template<class T>
+  static void hash_pow_lanes(T* const* ctx, const blobdata* bd, crypto::hash* res, size_t count)
+  {
+    const void* in[BLOCK_LONGHASH_MAX_WAYS];
+    size_t len[BLOCK_LONGHASH_MAX_WAYS];
+    void* out[BLOCK_LONGHASH_MAX_WAYS];
+    for (size_t i = 0; i < count; ++i)
     {
-      cn_pow_hash_v2 ctx_v2 = cn_pow_hash_v2::make_borrowed_v2(ctx);
-      ctx_v2.hash(bd.data(), bd.size(), res.data);
+      in[i] = bd[i].data();
+      len[i] = bd[i].size();
+      out[i] = res[i].data;
     }
-    else
+
+    if (count == 4)
+      T::template hash_multi<4>(ctx, in, len, out);
+    else if (count >= 2)
+      T::template hash_multi<2>(ctx, in, len, out);
+    if (count == 3 || count == 1)
+      ctx[0]->hash(in[count - 1], len[count - 1], out[count - 1]);
+  }
+
+  bool get_block_longhash(const Blockchain *pbc, const block& b, crypto::hash& res, const uint64_t height, const int miners)
+  {
+    cn_pow_hash_v3& ctx = get_pow_context(0);
+    blobdata bd = get_block_hashing_blob(b);
+    switch (get_pow_variant(b.major_version))
     {
-      cn_pow_hash_v1 ctx_v1 = cn_pow_hash_v1::make_borrowed_v1(ctx);
-      ctx_v1.hash(bd.data(), bd.size(), res.data);
+      case 3:
+        ctx.hash(bd.data(), bd.size(), res.data);
+        break;
+      case 2:
+      {
+        cn_pow_hash_v2 ctx_v2 = cn_pow_hash_v2::make_borrowed_v2(ctx);
+        ctx_v2.hash(bd.data(), bd.size(), res.data);
+        break;
+      }
+      default:
+      {
+        cn_pow_hash_v1 ctx_v1 = cn_pow_hash_v1::make_borrowed_v1(ctx);
+        ctx_v1.hash(bd.data(), bd.size(), res.data);
+        break;
+      }
     }
     return true;
   }
@@ -1733,6 +1778,64 @@ namespace cryptonote
     return p;
   }
 
+  void get_block_longhashes(const Blockchain *pbc, const std::vector<const block*>& blocks, std::vector<crypto::hash>& res)
+  {
+    std::vector<uint8_t> major_versions(blocks.size());
+    std::vector<blobdata> bd(blocks.size());
+    for (size_t i = 0; i < blocks.size(); ++i)
+    {
+      major_versions[i] = blocks[i]->major_version;
+      bd[i] = get_block_hashing_blob(*blocks[i]);
+    }
+    get_block_longhashes(pbc, major_versions, bd, res);
+  }
+
+  void get_block_longhashes(const Blockchain *pbc, const std::vector<uint8_t>& major_versions, const std::vector<blobdata>& bd, std::vector<crypto::hash>& res)
+  {
+    CHECK_AND_ASSERT_THROW_MES(major_versions.size() == bd.size(), "Mismatched major versions and hashing blobs");
+    res.resize(bd.size());
+
+    cn_pow_hash_v3* ctx[BLOCK_LONGHASH_MAX_WAYS];
+    for (size_t i = 0; i < BLOCK_LONGHASH_MAX_WAYS && i < bd.size(); ++i)
+      ctx[i] = &get_pow_context(i);
+
+    // lanes of one interleaved run must share the PoW variant, which only changes at the
+    // hard fork heights, so runs are cut short there
+    for (size_t i = 0; i < bd.size(); )
+    {
+      const int variant = get_pow_variant(major_versions[i]);
+      size_t count = 1;
+      while (count < BLOCK_LONGHASH_MAX_WAYS && i + count < bd.size() && get_pow_variant(major_versions[i + count]) == variant)
+        ++count;
+
+      if (variant == 3)
+      {
+        hash_pow_lanes(ctx, &bd[i], &res[i], count);
+      }
+      else if (variant == 2)
+      {
+        cn_pow_hash_v2 borrowed[BLOCK_LONGHASH_MAX_WAYS] = {
+          cn_pow_hash_v2::make_borrowed_v2(*ctx[0]),
+          cn_pow_hash_v2::make_borrowed_v2(*ctx[count > 1 ? 1 : 0]),
+          cn_pow_hash_v2::make_borrowed_v2(*ctx[count > 2 ? 2 : 0]),
+          cn_pow_hash_v2::make_borrowed_v2(*ctx[count > 3 ? 3 : 0])};
+        cn_pow_hash_v2* lanes[BLOCK_LONGHASH_MAX_WAYS] = {&borrowed[0], &borrowed[1], &borrowed[2], &borrowed[3]};
+        hash_pow_lanes(lanes, &bd[i], &res[i], count);
+      }
+      else
+      {
+        cn_pow_hash_v1 borrowed[BLOCK_LONGHASH_MAX_WAYS] = {
+          cn_pow_hash_v1::make_borrowed_v1(*ctx[0]),
+          cn_pow_hash_v1::make_borrowed_v1(*ctx[count > 1 ? 1 : 0]),
+          cn_pow_hash_v1::make_borrowed_v1(*ctx[count > 2 ? 2 : 0]),
+          cn_pow_hash_v1::make_borrowed_v1(*ctx[count > 3 ? 3 : 0])};
+        cn_pow_hash_v1* lanes[BLOCK_LONGHASH_MAX_WAYS] = {&borrowed[0], &borrowed[1], &borrowed[2], &borrowed[3]};
+        hash_pow_lanes(lanes, &bd[i], &res[i], count);
+      }
+      i += count;
+    }
+  }
+
   void get_block_longhash_reorg(const uint64_t split_height)
   {
     rx_reorg(split_height);
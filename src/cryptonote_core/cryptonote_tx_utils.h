@@ -236,6 +236,13 @@ namespace cryptonote
   void get_altblock_longhash(const block& b, crypto::hash& res, const uint64_t main_height, const uint64_t height,
     const uint64_t seed_height, const crypto::hash& seed_hash);
   crypto::hash get_block_longhash(const Blockchain *pb, const block& b, const uint64_t height, const int miners);
+#define BLOCK_LONGHASH_MAX_WAYS 4
+  // Hashes several blocks on the calling thread, up to BLOCK_LONGHASH_MAX_WAYS at a time
+  // with the interleaved CN-Heavy kernel; res[i] is the PoW of blocks[i]
+  void get_block_longhashes(const Blockchain *pb, const std::vector<const block*>& blocks, std::vector<crypto::hash>& res);
+  // Same over hashing blobs already built, e.g. one template with different nonces patched
+  // in; major_versions[i] is that of the block blobs[i] was built from
+  void get_block_longhashes(const Blockchain *pb, const std::vector<uint8_t>& major_versions, const std::vector<blobdata>& blobs, std::vector<crypto::hash>& res);
   void get_block_longhash_reorg(const uint64_t split_height);
 
   uint64_t get_offshore_fee(const std::vector<cryptonote::tx_destination_entry>& dsts, const uint32_t unlock_time, const uint32_t hf_version);
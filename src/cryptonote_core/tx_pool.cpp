@@ -1802,6 +1802,45 @@ namespace cryptonote
     }, false, category);
   }
   //------------------------------------------------------------------
+  bool tx_memory_pool::get_transaction_hashes_by_short_ids(const short_tx_id_key &key, const std::vector<uint64_t> &short_ids, std::vector<crypto::hash> &hashes) const
+  {
+    hashes.clear();
+    if (short_ids.empty())
+      return true;
+
+    // only the txids are copied under the locks, the salted short ids are computed after
+    std::vector<crypto::hash> txids;
+    {
+      CRITICAL_REGION_LOCAL(m_transactions_lock);
+      CRITICAL_REGION_LOCAL1(m_blockchain);
+      txids.reserve(m_blockchain.get_txpool_tx_count(false));
+      m_blockchain.for_all_txpool_txes([&txids](const crypto::hash &txid, const txpool_tx_meta_t &meta, const cryptonote::blobdata *bd){
+        txids.push_back(txid);
+        return true;
+      }, false, relay_category::broadcasted);
+    }
+
+    std::unordered_map<uint64_t, crypto::hash> index;
+    index.reserve(txids.size());
+    for (const crypto::hash &txid: txids)
+    {
+      const auto res = index.emplace(get_short_tx_id(key, txid), txid);
+      if (!res.second)
+        res.first->second = crypto::null_hash; // ambiguous
+    }
+
+    size_t resolved = 0;
+    hashes.reserve(short_ids.size());
+    for (const uint64_t short_id: short_ids)
+    {
+      const auto i = index.find(short_id);
+      hashes.push_back(i == index.end() ? crypto::null_hash : i->second);
+      if (hashes.back() != crypto::null_hash)
+        ++resolved;
+    }
+    return resolved == short_ids.size();
+  }
+  //------------------------------------------------------------------
   void tx_memory_pool::get_transaction_backlog(std::vector<tx_backlog_entry>& backlog, bool include_sensitive) const
   {
     CRITICAL_REGION_LOCAL(m_transactions_lock);
@@ -44,6 +44,7 @@
 #include "syncobj.h"
 #include "math_helper.h"
 #include "cryptonote_basic/cryptonote_basic_impl.h"
+#include "cryptonote_basic/cryptonote_format_utils.h"
 #include "cryptonote_basic/verification_context.h"
 #include "cryptonote_protocol/enums.h"
 #include "blockchain_db/blockchain_db.h"
@@ -458,6 +459,20 @@ namespace cryptonote
      */
     bool get_complement(const std::vector<crypto::hash> &hashes, std::vector<cryptonote::blobdata> &txes) const;
 
+    /**
+     * @brief resolve short tx ids, as used by compact blocks, to pool transaction hashes
+     *
+     * The broadcasted pool transactions are indexed by their short id under the
+     * given key. Ids matching no transaction, or several, resolve to null_hash.
+     *
+     * @param key the key the short ids were computed with
+     * @param short_ids the short ids to resolve
+     * @param hashes return-by-reference the transaction hashes, in the same order
+     *
+     * @return true if all short ids were resolved, false otherwise
+     */
+    bool get_transaction_hashes_by_short_ids(const short_tx_id_key &key, const std::vector<uint64_t> &short_ids, std::vector<crypto::hash> &hashes) const;
+
   private:
 
     /**
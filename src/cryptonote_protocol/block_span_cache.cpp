@@ -0,0 +1,149 @@
+// Copyright (c) 2020, The Monero Project
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are
+// permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of
+//    conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list
+//    of conditions and the following disclaimer in the documentation and/or other
+//    materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be
+//    used to endorse or promote products derived from this software without specific
+//    prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL
+// THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "block_span_cache.h"
+
+#include <boost/thread/locks.hpp>
+#include <cstring>
+
+namespace cryptonote
+{
+  block_span_cache::block_span_cache(const std::size_t max_bytes)
+    : lock_(), max_bytes_(max_bytes), bytes_(0), hits_(0), misses_(0), lru_(), map_()
+  {}
+
+  std::size_t block_span_cache::key_hash::operator()(const key& k) const noexcept
+  {
+    std::size_t h;
+    static_assert(sizeof(h) <= sizeof(k.first), "hash too small");
+    std::memcpy(std::addressof(h), k.first.data, sizeof(h));
+    return h ^ (std::size_t(k.count) << 1) ^ std::size_t(k.pruned);
+  }
+
+  block_span_cache::key block_span_cache::make_key(const epee::span<const crypto::hash> ids, const bool pruned) noexcept
+  {
+    return {ids.empty() ? crypto::null_hash : ids[0], std::uint32_t(ids.size()), pruned};
+  }
+
+  crypto::hash block_span_cache::get_ids_hash(const epee::span<const crypto::hash> ids) noexcept
+  {
+    return crypto::cn_fast_hash(ids.data(), ids.size() * sizeof(crypto::hash));
+  }
+
+  void block_span_cache::erase(const std::list<entry>::iterator it)
+  {
+    bytes_ -= it->message.size();
+    map_.erase(it->k);
+    lru_.erase(it);
+  }
+
+  bool block_span_cache::get(const epee::span<const crypto::hash> ids, const bool pruned, epee::byte_slice& message, std::uint64_t& last_height)
+  {
+    if (ids.empty())
+      return false;
+
+    const crypto::hash ids_hash = get_ids_hash(ids);
+    boost::lock_guard<boost::mutex> lock{lock_};
+    const auto it = map_.find(make_key(ids, pruned));
+    if (it == map_.end() || it->second->ids_hash != ids_hash)
+    {
+      ++misses_;
+      return false;
+    }
+
+    ++hits_;
+    lru_.splice(lru_.begin(), lru_, it->second);
+    message = it->second->message.clone();
+    last_height = it->second->last_height;
+    return true;
+  }
+
+  void block_span_cache::put(const epee::span<const crypto::hash> ids, const bool pruned, epee::byte_slice message, const std::uint64_t last_height)
+  {
+    if (ids.empty() || message.size() > max_bytes_)
+      return;
+
+    const key k = make_key(ids, pruned);
+    const crypto::hash ids_hash = get_ids_hash(ids);
+    boost::lock_guard<boost::mutex> lock{lock_};
+    const auto it = map_.find(k);
+    if (it != map_.end())
+      erase(it->second);
+
+    while (!lru_.empty() && max_bytes_ - bytes_ < message.size())
+      erase(std::prev(lru_.end()));
+
+    bytes_ += message.size();
+    lru_.push_front(entry{k, ids_hash, last_height, std::move(message)});
+    map_.emplace(k, lru_.begin());
+  }
+
+  void block_span_cache::remove_from(const std::uint64_t height)
+  {
+    boost::lock_guard<boost::mutex> lock{lock_};
+    for (auto it = lru_.begin(); it != lru_.end(); )
+    {
+      const auto next = std::next(it);
+      if (it->last_height >= height)
+        erase(it);
+      it = next;
+    }
+  }
+
+  void block_span_cache::clear()
+  {
+    boost::lock_guard<boost::mutex> lock{lock_};
+    map_.clear();
+    lru_.clear();
+    bytes_ = 0;
+  }
+
+  std::size_t block_span_cache::size() const
+  {
+    boost::lock_guard<boost::mutex> lock{lock_};
+    return lru_.size();
+  }
+
+  std::size_t block_span_cache::bytes() const
+  {
+    boost::lock_guard<boost::mutex> lock{lock_};
+    return bytes_;
+  }
+
+  std::uint64_t block_span_cache::hits() const
+  {
+    boost::lock_guard<boost::mutex> lock{lock_};
+    return hits_;
+  }
+
+  std::uint64_t block_span_cache::misses() const
+  {
+    boost::lock_guard<boost::mutex> lock{lock_};
+    return misses_;
+  }
+}
@@ -0,0 +1,114 @@
+// Copyright (c) 2020, The Monero Project
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are
+// permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of
+//    conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list
+//    of conditions and the following disclaimer in the documentation and/or other
+//    materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be
+//    used to endorse or promote products derived from this software without specific
+//    prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL
+// THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <boost/thread/mutex.hpp>
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+
+#include "byte_slice.h"
+#include "crypto/hash.h"
+#include "span.h"
+
+namespace cryptonote
+{
+  /*! Bounded LRU of serialized and framed NOTIFY_RESPONSE_GET_OBJECTS
+    messages, so that peers syncing the same span are all sent the same
+    shared buffer instead of each causing a read of every block and tx
+    from the database.
+
+    Spans are keyed by their first block hash, block count and pruning,
+    and the full list of requested hashes is checked on lookup. Only
+    complete responses should be cached. The caller checks that the last
+    block of a span is still in the main chain, and drops the spans at and
+    above a reorg with `remove_from`. */
+  class block_span_cache
+  {
+  public:
+    explicit block_span_cache(std::size_t max_bytes);
+
+    /*! \param[out] message shares the cached buffer
+      \param[out] last_height height of the last block of the span
+      \return False if `ids` is not cached */
+    bool get(epee::span<const crypto::hash> ids, bool pruned, epee::byte_slice& message, std::uint64_t& last_height);
+
+    //! Caches `message`, evicting the least recently used spans as needed
+    void put(epee::span<const crypto::hash> ids, bool pruned, epee::byte_slice message, std::uint64_t last_height);
+
+    //! Removes every span ending at `height` or above
+    void remove_from(std::uint64_t height);
+
+    void clear();
+
+    std::size_t size() const;
+    std::size_t bytes() const;
+    std::uint64_t hits() const;
+    std::uint64_t misses() const;
+
+  private:
+    struct key
+    {
+      crypto::hash first;
+      std::uint32_t count;
+      bool pruned;
+
+      bool operator==(const key& other) const noexcept
+      {
+        return first == other.first && count == other.count && pruned == other.pruned;
+      }
+    };
+
+    struct key_hash
+    {
+      std::size_t operator()(const key& k) const noexcept;
+    };
+
+    struct entry
+    {
+      key k;
+      crypto::hash ids_hash;
+      std::uint64_t last_height;
+      epee::byte_slice message;
+    };
+
+    static key make_key(epee::span<const crypto::hash> ids, bool pruned) noexcept;
+    static crypto::hash get_ids_hash(epee::span<const crypto::hash> ids) noexcept;
+
+    void erase(std::list<entry>::iterator it);
+
+    mutable boost::mutex lock_;
+    const std::size_t max_bytes_;
+    std::size_t bytes_;
+    std::uint64_t hits_;
+    std::uint64_t misses_;
+    std::list<entry> lru_; //!< most recently used first
+    std::unordered_map<key, std::list<entry>::iterator, key_hash> map_;
+  };
+}
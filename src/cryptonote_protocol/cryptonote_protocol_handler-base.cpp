@@ -100,45 +100,36 @@ cryptonote_protocol_handler_base::~cryptonote_protocol_handler_base() {
 void cryptonote_protocol_handler_base::handler_request_blocks_history(std::list<crypto::hash>& ids) {
 }
 
-void cryptonote_protocol_handler_base::handler_response_blocks_now(size_t packet_size) {
+bool cryptonote_protocol_handler_base::handler_response_blocks_start(const boost::uuids::uuid& peer) {
+	boost::lock_guard<boost::mutex> lock(m_sync_serving_lock);
+	return m_sync_serving.insert(peer).second;
+}
+
+std::chrono::nanoseconds cryptonote_protocol_handler_base::handler_response_blocks_now(size_t packet_size, uint64_t& peer_tat) {
 	using namespace epee::net_utils;
-	double delay=0; // will be calculated
 	MDEBUG("Packet size: " << packet_size);
-	do
-	{ // rate limiting
-		//XXX 
-		/*if (::cryptonote::core::get_is_stopping()) { 
-			MDEBUG("We are stopping - so abort sleep");
-			return;
-		}*/
-		/*if (m_was_shutdown) { 
-			MDEBUG("m_was_shutdown - so abort sleep");
-			return;
-		}*/
-
-		{ 
-	  	CRITICAL_REGION_LOCAL(	network_throttle_manager::m_lock_get_global_throttle_out );
-			delay = network_throttle_manager::get_global_throttle_out().get_sleep_time_after_tick( packet_size );
-		}
-
-		
-		delay *= 0.50;
-		//delay = 0; // XXX
-		if (delay > 0) {
-			//delay += rand2*0.1;
-            		long int ms = (long int)(delay * 1000);
-			MDEBUG("Sleeping for " << ms << " ms before packet_size="<<packet_size); // XXX debug sleep
-			boost::this_thread::sleep(boost::posix_time::milliseconds( ms ) ); // TODO randomize sleeps
-		}
-	} while(delay > 0);
-
-// XXX LATER XXX
+
+	// Serving sync is bulk traffic: it has its own budget, split evenly between the peers
+	// asking at the same time, so block propagation and relay still find room in the global limit
+	token_bucket &bucket = network_throttle_manager::get_class_bucket(traffic_class::block_sync);
+	size_t serving;
 	{
-	  CRITICAL_REGION_LOCAL(	network_throttle_manager::m_lock_get_global_throttle_out );
-		network_throttle_manager::get_global_throttle_out().handle_trafic_tcp( packet_size ); // increase counter - global
-		//epee::critical_region_t<decltype(m_throttle_global_lock)> guard(m_throttle_global_lock); // *** critical *** 
-		//m_throttle_global.m_out.handle_trafic_tcp( packet_size ); // increase counter - global
+		boost::lock_guard<boost::mutex> lock(m_sync_serving_lock);
+		serving = std::max<size_t>(m_sync_serving.size(), 1);
 	}
+	std::chrono::nanoseconds delay = bucket.consume(packet_size);
+	const uint64_t rate = bucket.get_rate();
+	if (rate)
+		delay = std::max(delay, token_bucket::consume(peer_tat, std::max<uint64_t>(rate / serving, 1), packet_size, std::chrono::seconds(1)));
+
+	if (delay.count() > 0)
+		MDEBUG("Deferring packet_size=" << packet_size << " by " << std::chrono::duration_cast<std::chrono::milliseconds>(delay).count() << " ms");
+	return delay;
+}
+
+void cryptonote_protocol_handler_base::handler_response_blocks_sent(const boost::uuids::uuid& peer) {
+	boost::lock_guard<boost::mutex> lock(m_sync_serving_lock);
+	m_sync_serving.erase(peer);
 }
 
 } // namespace
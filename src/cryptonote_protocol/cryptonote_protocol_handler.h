@@ -35,6 +35,9 @@
 #pragma once
 
 #include <boost/program_options/variables_map.hpp>
+#include <atomic>
+#include <chrono>
+#include <set>
 #include <string>
 
 #include "math_helper.h"
@@ -43,7 +46,10 @@
 #include "cryptonote_protocol_defs.h"
 #include "cryptonote_protocol_handler_common.h"
 #include "block_queue.h"
+#include "block_span_cache.h"
+#include "txpool_sketch.h"
 #include "common/perf_timer.h"
+#include "common/threadpool.h"
 #include "cryptonote_basic/connection_context.h"
 #include <boost/circular_buffer.hpp>
 
@@ -53,6 +59,7 @@ DISABLE_VS_WARNINGS(4355)
 #define LOCALHOST_INT 2130706433
 #define CURRENCY_PROTOCOL_MAX_OBJECT_REQUEST_COUNT 100
 static_assert(CURRENCY_PROTOCOL_MAX_OBJECT_REQUEST_COUNT >= BLOCKS_SYNCHRONIZING_DEFAULT_COUNT_PRE_V4, "Invalid CURRENCY_PROTOCOL_MAX_OBJECT_REQUEST_COUNT");
+#define CURRENCY_PROTOCOL_SPAN_CACHE_MAX_BYTES (64 * 1024 * 1024)
 
 namespace cryptonote
 {
@@ -61,12 +68,16 @@ namespace cryptonote
 	class cryptonote_protocol_handler_base {
 		private:
 			std::unique_ptr<cryptonote_protocol_handler_base_pimpl> mI;
+			boost::mutex m_sync_serving_lock;
+			std::set<boost::uuids::uuid> m_sync_serving; // peers being served blocks right now, one response each
 
 		public:
 			cryptonote_protocol_handler_base();
 			virtual ~cryptonote_protocol_handler_base();
 			void handler_request_blocks_history(std::list<crypto::hash>& ids); // before asking for list of objects, we can change the list still
-			void handler_response_blocks_now(size_t packet_size);
+			bool handler_response_blocks_start(const boost::uuids::uuid& peer); // false if that peer still has a response waiting
+			std::chrono::nanoseconds handler_response_blocks_now(size_t packet_size, uint64_t& peer_tat); // how long blocks served for sync must wait, with a fair share per peer
+			void handler_response_blocks_sent(const boost::uuids::uuid& peer); // once the response paced by handler_response_blocks_now is out, or given up
 			
 			virtual double get_avg_block_size() = 0;
 			virtual double estimate_one_block_size() noexcept; // for estimating size of blocks to download
@@ -92,6 +103,8 @@ namespace cryptonote
       HANDLE_NOTIFY_T2(NOTIFY_NEW_FLUFFY_BLOCK, &cryptonote_protocol_handler::handle_notify_new_fluffy_block)			
       HANDLE_NOTIFY_T2(NOTIFY_REQUEST_FLUFFY_MISSING_TX, &cryptonote_protocol_handler::handle_request_fluffy_missing_tx)						
       HANDLE_NOTIFY_T2(NOTIFY_GET_TXPOOL_COMPLEMENT, &cryptonote_protocol_handler::handle_notify_get_txpool_complement)
+      HANDLE_NOTIFY_T2(NOTIFY_NEW_COMPACT_BLOCK, &cryptonote_protocol_handler::handle_notify_new_compact_block)
+      HANDLE_NOTIFY_T2(NOTIFY_GET_TXPOOL_SKETCH_COMPLEMENT, &cryptonote_protocol_handler::handle_notify_get_txpool_sketch_complement)
     END_INVOKE_MAP2()
 
     bool on_idle();
@@ -127,6 +140,8 @@ namespace cryptonote
     int handle_notify_new_fluffy_block(int command, NOTIFY_NEW_FLUFFY_BLOCK::request& arg, cryptonote_connection_context& context);
     int handle_request_fluffy_missing_tx(int command, NOTIFY_REQUEST_FLUFFY_MISSING_TX::request& arg, cryptonote_connection_context& context);
     int handle_notify_get_txpool_complement(int command, NOTIFY_GET_TXPOOL_COMPLEMENT::request& arg, cryptonote_connection_context& context);
+    int handle_notify_new_compact_block(int command, NOTIFY_NEW_COMPACT_BLOCK::request& arg, cryptonote_connection_context& context);
+    int handle_notify_get_txpool_sketch_complement(int command, NOTIFY_GET_TXPOOL_SKETCH_COMPLEMENT::request& arg, cryptonote_connection_context& context);
 		
     //----------------- i_bc_protocol_layout ---------------------------------------
     virtual bool relay_block(NOTIFY_NEW_BLOCK::request& arg, cryptonote_connection_context& exclude_context);
@@ -139,6 +154,7 @@ namespace cryptonote
     bool on_connection_synchronized();
     bool should_download_next_span(cryptonote_connection_context& context, bool standby);
     bool should_ask_for_pruned_data(cryptonote_connection_context& context, uint64_t first_block_height, uint64_t nblocks, bool check_block_weights) const;
+    size_t get_sync_span_size(const cryptonote_connection_context& context) const;
     void drop_connection(cryptonote_connection_context &context, bool add_fail, bool flush_all_spans);
     void drop_connection_with_score(cryptonote_connection_context &context, unsigned int score, bool flush_all_spans);
     bool kick_idle_peers();
@@ -147,7 +163,7 @@ namespace cryptonote
     int try_add_next_blocks(cryptonote_connection_context &context);
     void notify_new_stripe(cryptonote_connection_context &context, uint32_t stripe);
     void skip_unneeded_hashes(cryptonote_connection_context& context, bool check_block_queue) const;
-    bool request_txpool_complement(cryptonote_connection_context &context);
+    bool request_txpool_complement(cryptonote_connection_context &context, bool use_sketch = false);
 
     t_core& m_core;
 
@@ -160,6 +176,7 @@ namespace cryptonote
     std::atomic<bool> m_ask_for_txpool_complement;
     boost::mutex m_sync_lock;
     block_queue m_block_queue;
+    block_span_cache m_block_span_cache; // GET_OBJECTS responses recently sent, ready to send again
     epee::math_helper::once_a_time_seconds<30> m_idle_peer_kicker;
     epee::math_helper::once_a_time_milliseconds<100> m_standby_checker;
     epee::math_helper::once_a_time_seconds<101> m_sync_search_checker;
@@ -169,6 +186,10 @@ namespace cryptonote
     uint64_t m_sync_spans_downloaded, m_sync_old_spans_downloaded, m_sync_bad_spans_downloaded;
     uint64_t m_sync_download_chain_size, m_sync_download_objects_size;
     size_t m_block_download_max_size;
+    bool m_block_sync_size_fixed;
+    std::atomic<float> m_sync_verify_rate; // blocks/sec added to the chain, 0 if unknown
+    tools::threadpool::waiter m_preverify_waiter;
+    std::atomic<unsigned int> m_preverify_pending; // spans queued for preverification
     bool m_sync_pruned_blocks;
 
     // Values for sync time estimates
@@ -42,6 +42,7 @@
 #include "cryptonote_basic/cryptonote_format_utils.h"
 #include "profile_tools.h"
 #include "net/network_throttle-detail.hpp"
+#include "net/levin_base.h"
 #include "common/pruning.h"
 #include "common/util.h"
 
@@ -72,6 +73,10 @@
 #define PASSIVE_PEER_KICK_TIME (60 * 1000000) // microseconds
 #define DROP_ON_SYNC_WEDGE_THRESHOLD (30 * 1000000000ull) // nanoseconds
 #define LAST_ACTIVITY_STALL_THRESHOLD (2.0f) // seconds
+#define SYNC_SPAN_TARGET_SECONDS 2.0f // download time a span should take, so request latency is amortized
+#define SYNC_SPAN_TARGET_RTTS 8.0f // and at least that many round trips worth of transfer
+#define SYNC_SPAN_VERIFY_SECONDS 10.0f // no more blocks per span than we can add in that time
+#define SYNC_RATE_SMOOTHING 0.3f // weight of the latest measurement in moving averages
 
 namespace cryptonote
 {
@@ -86,7 +91,11 @@ namespace cryptonote
                                                                                                               m_synchronized(offline),
                                                                                                               m_ask_for_txpool_complement(true),
                                                                                                               m_stopping(false),
-                                                                                                              m_no_sync(false)
+                                                                                                              m_no_sync(false),
+                                                                                                              m_block_span_cache(CURRENCY_PROTOCOL_SPAN_CACHE_MAX_BYTES),
+                                                                                                              m_block_sync_size_fixed(false),
+                                                                                                              m_sync_verify_rate(0.0f),
+                                                                                                              m_preverify_pending(0)
 
   {
     if(!m_p2p)
@@ -108,6 +117,7 @@ namespace cryptonote
     m_sync_download_objects_size = 0;
 
     m_block_download_max_size = command_line::get_arg(vm, cryptonote::arg_block_download_max_size);
+    m_block_sync_size_fixed = command_line::get_arg(vm, cryptonote::arg_block_sync_size) > 0;
     m_sync_pruned_blocks = command_line::get_arg(vm, cryptonote::arg_sync_pruned_blocks);
 
     return true;
@@ -116,6 +126,7 @@ namespace cryptonote
   template<class t_core>
   bool t_cryptonote_protocol_handler<t_core>::deinit()
   {
+    m_preverify_waiter.wait(NULL);
     return true;
   }
   //------------------------------------------------------------------------------------------------------------------------
@@ -887,6 +898,70 @@ namespace cryptonote
   }
   //------------------------------------------------------------------------------------------------------------------------
   template<class t_core>
+  int t_cryptonote_protocol_handler<t_core>::handle_notify_new_compact_block(int command, NOTIFY_NEW_COMPACT_BLOCK::request& arg, cryptonote_connection_context& context)
+  {
+    MLOG_P2P_MESSAGE("Received NOTIFY_NEW_COMPACT_BLOCK " << arg.block_hash << " (height " << arg.current_blockchain_height << ", " << arg.short_tx_ids.size() / COMPACT_BLOCK_SHORT_TX_ID_SIZE << " txes)");
+    if(context.m_state != cryptonote_connection_context::state_normal)
+      return 1;
+    if(!is_synchronized() || m_no_sync) // can happen if a peer connection goes to normal but another thread still hasn't finished adding queued blocks
+    {
+      LOG_DEBUG_CC(context, "Received new block while syncing, ignored");
+      return 1;
+    }
+    // several peers announce each block, only the first one is worth rebuilding
+    if(m_core.have_block(arg.block_hash))
+    {
+      MDEBUG("Already have compact block " << arg.block_hash << ", ignored");
+      return 1;
+    }
+
+    block new_block;
+    if(!parse_and_validate_block_from_blob(arg.block, new_block) || !new_block.tx_hashes.empty() || arg.short_tx_ids.size() % COMPACT_BLOCK_SHORT_TX_ID_SIZE)
+    {
+      LOG_ERROR_CCONTEXT("sent wrong compact block " << arg.block_hash << ", dropping connection");
+      drop_connection(context, false, false);
+      return 1;
+    }
+
+    std::vector<uint64_t> short_ids(arg.short_tx_ids.size() / COMPACT_BLOCK_SHORT_TX_ID_SIZE, 0);
+    for (size_t i = 0; i < short_ids.size(); ++i)
+    {
+      const uint8_t *p = reinterpret_cast<const uint8_t*>(arg.short_tx_ids.data()) + i * COMPACT_BLOCK_SHORT_TX_ID_SIZE;
+      for (size_t j = 0; j < COMPACT_BLOCK_SHORT_TX_ID_SIZE; ++j)
+        short_ids[i] |= ((uint64_t)p[j]) << (8 * j);
+    }
+
+    // rebuild the tx hashes from our pool, and only trust them if the block hash checks out
+    const short_tx_id_key key = get_short_tx_id_key(arg.block_hash, arg.salt);
+    const bool all_found = m_core.get_pool_transaction_hashes_by_short_ids(key, short_ids, new_block.tx_hashes);
+    new_block.invalidate_hashes();
+    if (all_found && get_block_hash(new_block) == arg.block_hash)
+    {
+      MDEBUG("Rebuilt compact block " << arg.block_hash << " from the pool");
+      NOTIFY_NEW_FLUFFY_BLOCK::request fluffy_arg = AUTO_VAL_INIT(fluffy_arg);
+      fluffy_arg.b.block = block_to_blob(new_block);
+      fluffy_arg.current_blockchain_height = arg.current_blockchain_height;
+      return handle_notify_new_fluffy_block(NOTIFY_NEW_FLUFFY_BLOCK::ID, fluffy_arg, context);
+    }
+
+    // fall back to a fluffy block with the txes we could not find, or just the full block
+    // if some short id matched the wrong tx, since we can't tell which one it was
+    NOTIFY_REQUEST_FLUFFY_MISSING_TX::request missing_tx_req;
+    missing_tx_req.block_hash = arg.block_hash;
+    missing_tx_req.current_blockchain_height = arg.current_blockchain_height;
+    if (!all_found)
+    {
+      for (size_t i = 0; i < new_block.tx_hashes.size(); ++i)
+        if (new_block.tx_hashes[i] == crypto::null_hash)
+          missing_tx_req.missing_tx_indices.push_back(i);
+    }
+    MDEBUG("Could not rebuild compact block " << arg.block_hash << ", requesting " << missing_tx_req.missing_tx_indices.size() << " txes");
+    MLOG_P2P_MESSAGE("-->>NOTIFY_REQUEST_FLUFFY_MISSING_TX: missing_tx_indices.size()=" << missing_tx_req.missing_tx_indices.size() );
+    post_notify<NOTIFY_REQUEST_FLUFFY_MISSING_TX>(missing_tx_req, context);
+    return 1;
+  }
+  //------------------------------------------------------------------------------------------------------------------------
+  template<class t_core>
   int t_cryptonote_protocol_handler<t_core>::handle_notify_get_txpool_complement(int command, NOTIFY_GET_TXPOOL_COMPLEMENT::request& arg, cryptonote_connection_context& context)
   {
     MLOG_P2P_MESSAGE("Received NOTIFY_GET_TXPOOL_COMPLEMENT (" << arg.hashes.size() << " txes)");
@@ -917,6 +992,86 @@ namespace cryptonote
   }
   //------------------------------------------------------------------------------------------------------------------------
   template<class t_core>
+  int t_cryptonote_protocol_handler<t_core>::handle_notify_get_txpool_sketch_complement(int command, NOTIFY_GET_TXPOOL_SKETCH_COMPLEMENT::request& arg, cryptonote_connection_context& context)
+  {
+    MLOG_P2P_MESSAGE("Received NOTIFY_GET_TXPOOL_SKETCH_COMPLEMENT (" << arg.sketch.size() / txpool_sketch::cell_size << " cells)");
+    if(context.m_state != cryptonote_connection_context::state_normal)
+      return 1;
+
+    // the peer could not decode the sketch we sent, fall back to the full hash list
+    if (arg.sketch.empty())
+    {
+      if (!context.m_txpool_sketch_sent)
+      {
+        LOG_ERROR_CCONTEXT("Peer sent an unrequested empty txpool sketch, dropping connection");
+        drop_connection(context, false, false);
+        return 1;
+      }
+      context.m_txpool_sketch_sent = false;
+      MDEBUG(context << "txpool sketch could not be decoded, requesting full complement");
+      if (!request_txpool_complement(context))
+        MERROR(context << "Failed to request txpool complement");
+      return 1;
+    }
+
+    txpool_sketch theirs(arg.salt, 0);
+    if (!theirs.load(arg.sketch))
+    {
+      LOG_ERROR_CCONTEXT("Peer sent an invalid txpool sketch, dropping connection");
+      drop_connection(context, false, false);
+      return 1;
+    }
+
+    std::vector<crypto::hash> hashes;
+    if (!m_core.get_pool_transaction_hashes(hashes, false))
+    {
+      LOG_ERROR_CCONTEXT("failed to get txpool hashes");
+      return 1;
+    }
+    txpool_sketch ours(arg.salt, theirs.cells());
+    std::unordered_map<uint64_t, crypto::hash> keys;
+    keys.reserve(hashes.size());
+    for (const crypto::hash &txid: hashes)
+    {
+      const uint64_t key = ours.get_key(txid);
+      keys.emplace(key, txid);
+      ours.insert(key);
+    }
+
+    std::vector<uint64_t> only_ours, only_theirs;
+    if (!ours.subtract(theirs) || !ours.decode(only_ours, only_theirs))
+    {
+      MDEBUG(context << "failed to decode txpool sketch, asking for the full complement");
+      NOTIFY_GET_TXPOOL_SKETCH_COMPLEMENT::request r = {};
+      r.salt = arg.salt;
+      MLOG_P2P_MESSAGE("-->>NOTIFY_GET_TXPOOL_SKETCH_COMPLEMENT: empty");
+      post_notify<NOTIFY_GET_TXPOOL_SKETCH_COMPLEMENT>(r, context);
+      return 1;
+    }
+    MDEBUG(context << "txpool sketch decoded, " << only_ours.size() << " txes only here, " << only_theirs.size() << " only there");
+
+    NOTIFY_NEW_TRANSACTIONS::request new_txes;
+    for (const uint64_t key: only_ours)
+    {
+      const auto i = keys.find(key);
+      cryptonote::blobdata txblob;
+      if (i != keys.end() && m_core.get_pool_transaction(i->second, txblob, relay_category::broadcasted))
+        new_txes.txs.push_back(std::move(txblob));
+    }
+    if (new_txes.txs.empty())
+      return 1;
+
+    MLOG_P2P_MESSAGE
+    (
+        "-->>NOTIFY_NEW_TRANSACTIONS: "
+        << ", txs.size()=" << new_txes.txs.size()
+    );
+
+    post_notify<NOTIFY_NEW_TRANSACTIONS>(new_txes, context);
+    return 1;
+  }
+  //------------------------------------------------------------------------------------------------------------------------
+  template<class t_core>
   int t_cryptonote_protocol_handler<t_core>::handle_notify_new_transactions(int command, NOTIFY_NEW_TRANSACTIONS::request& arg, cryptonote_connection_context& context)
   {
     MLOG_P2P_MESSAGE("Received NOTIFY_NEW_TRANSACTIONS (" << arg.txs.size() << " txes)");
@@ -1011,20 +1166,73 @@ namespace cryptonote
         drop_connection(context, false, false);
         return 1;
       }
-
-    NOTIFY_RESPONSE_GET_OBJECTS::request rsp;
-    if(!m_core.handle_get_objects(arg, rsp, context))
+    // a syncing peer asks for one span at a time, so a second request while the first
+    // response still waits on the sync budget would only pile up buffered spans here
+    if (!handler_response_blocks_start(context.m_connection_id))
     {
-      LOG_ERROR_CCONTEXT("failed to handle request NOTIFY_REQUEST_GET_OBJECTS, dropping connection");
+      LOG_ERROR_CCONTEXT("Requested objects while the previous response is still pending, dropping connection");
       drop_connection(context, false, false);
       return 1;
     }
-    MLOG_P2P_MESSAGE("-->>NOTIFY_RESPONSE_GET_OBJECTS: blocks.size()="
-                     << rsp.blocks.size() << ", rsp.m_current_blockchain_height=" << rsp.current_blockchain_height
-                     << ", missed_ids.size()=" << rsp.missed_ids.size());
-    post_notify<NOTIFY_RESPONSE_GET_OBJECTS>(rsp, context);
-    //handler_response_blocks_now(sizeof(rsp)); // XXX
-    //handler_response_blocks_now(200);
+
+    // Peers catching up tend to ask for the same spans: those are sent from the cache,
+    // as long as their last block is still in the main chain
+    epee::byte_slice message;
+    uint64_t last_height = 0;
+    if (m_block_span_cache.get(epee::to_span(arg.blocks), arg.prune, message, last_height))
+    {
+      if (m_core.get_block_id_by_height(last_height) == arg.blocks.back())
+      {
+        MLOG_P2P_MESSAGE("-->>NOTIFY_RESPONSE_GET_OBJECTS: " << arg.blocks.size() << " blocks from cache");
+      }
+      else
+      {
+        MDEBUG("Span ending at " << last_height << " was reorganized, dropping cached spans from there");
+        m_block_span_cache.remove_from(last_height);
+        message = nullptr;
+      }
+    }
+
+    if (message.empty())
+    {
+      NOTIFY_RESPONSE_GET_OBJECTS::request rsp;
+      if(!m_core.handle_get_objects(arg, rsp, context))
+      {
+        LOG_ERROR_CCONTEXT("failed to handle request NOTIFY_REQUEST_GET_OBJECTS, dropping connection");
+        handler_response_blocks_sent(context.m_connection_id);
+        drop_connection(context, false, false);
+        return 1;
+      }
+      MLOG_P2P_MESSAGE("-->>NOTIFY_RESPONSE_GET_OBJECTS: blocks.size()="
+                       << rsp.blocks.size() << ", rsp.m_current_blockchain_height=" << rsp.current_blockchain_height
+                       << ", missed_ids.size()=" << rsp.missed_ids.size());
+      std::string blob;
+      epee::serialization::store_t_to_binary(rsp, blob);
+      message = epee::levin::make_notify(NOTIFY_RESPONSE_GET_OBJECTS::ID, epee::strspan<uint8_t>(blob));
+
+      // the height sent along is only ever used to raise the peer's idea of our height, so it can go stale
+      block b;
+      if (rsp.missed_ids.empty() && rsp.blocks.size() == arg.blocks.size() && parse_and_validate_block_from_blob(rsp.blocks.back().block, b))
+        m_block_span_cache.put(epee::to_span(arg.blocks), arg.prune, message.clone(), get_block_height(b));
+    }
+
+    const std::chrono::nanoseconds delay = handler_response_blocks_now(message.size(), context.m_sync_serve_tat);
+    if (delay.count() > 0)
+    {
+      // paced responses wait on a timer, not on this p2p worker, so relay is never starved of threads
+      const epee::net_utils::connection_context_base peer = context;
+      auto pending = std::make_shared<epee::byte_slice>(std::move(message));
+      m_p2p->post_after(delay, context, [this, peer, pending](bool elapsed) {
+        if (elapsed)
+          m_p2p->send_notify_to_peer(NOTIFY_RESPONSE_GET_OBJECTS::ID, std::move(*pending), peer);
+        handler_response_blocks_sent(peer.m_connection_id);
+      });
+    }
+    else
+    {
+      m_p2p->send_notify_to_peer(NOTIFY_RESPONSE_GET_OBJECTS::ID, std::move(message), context);
+      handler_response_blocks_sent(context.m_connection_id);
+    }
     return 1;
   }
   //------------------------------------------------------------------------------------------------------------------------
@@ -1212,9 +1420,26 @@ namespace cryptonote
       // add that new span to the block queue
       const boost::posix_time::time_duration dt = now - request_time;
       const float rate = size * 1e6 / (dt.total_microseconds() + 1);
+      context.m_sync_download_rate = context.m_sync_download_rate > 0.0f ? context.m_sync_download_rate * (1.0f - SYNC_RATE_SMOOTHING) + rate * SYNC_RATE_SMOOTHING : rate;
       MDEBUG(context << " adding span: " << arg.blocks.size() << " at height " << start_height << ", " << dt.total_microseconds()/1e6 << " seconds, " << (rate/1024) << " kB/s, size now " << (m_block_queue.get_data_size() + blocks_size) / 1048576.f << " MB");
       m_block_queue.add_blocks(start_height, arg.blocks, context.m_connection_id, rate, blocks_size);
 
+      // spans ahead of the chain would sit idle until the gap is filled, do the
+      // context free checks meanwhile so only contextual ones are left later; not on
+      // the global pool, whose queue the sync thread drains while it waits there
+      tools::threadpool &tpool = tools::threadpool::getInstanceForBackground();
+      if (start_height > m_core.get_current_blockchain_height() && m_preverify_pending < tpool.get_max_concurrency())
+      {
+        ++m_preverify_pending;
+        auto blocks = std::make_shared<std::vector<block_complete_entry>>(arg.blocks);
+        const boost::uuids::uuid connection_id = context.m_connection_id;
+        tpool.submit(&m_preverify_waiter, [this, blocks, start_height, connection_id]() {
+          if (!m_stopping && !m_core.preverify_blocks(*blocks))
+            MDEBUG("Failed to preverify span at height " << start_height << " from " << connection_id);
+          --m_preverify_pending;
+        });
+      }
+
       const crypto::hash last_block_hash = cryptonote::get_block_hash(b);
       context.m_last_known_hash = last_block_hash;
 
@@ -1550,6 +1775,9 @@ namespace cryptonote
           {
             const uint64_t target_blockchain_height = m_core.get_target_blockchain_height();
             const boost::posix_time::time_duration dt = boost::posix_time::microsec_clock::universal_time() - start;
+            const float verify_rate = (current_blockchain_height - previous_height) * 1e6f / (dt.total_microseconds() + 1);
+            const float previous_verify_rate = m_sync_verify_rate;
+            m_sync_verify_rate = previous_verify_rate > 0.0f ? previous_verify_rate * (1.0f - SYNC_RATE_SMOOTHING) + verify_rate * SYNC_RATE_SMOOTHING : verify_rate;
             std::string progress_message = "";
             if (current_blockchain_height < target_blockchain_height)
             {
@@ -1941,6 +2169,53 @@ skip:
   }
   //------------------------------------------------------------------------------------------------------------------------
   template<class t_core>
+  size_t t_cryptonote_protocol_handler<t_core>::get_sync_span_size(const cryptonote_connection_context& context) const
+  {
+    const size_t default_count = m_core.get_block_sync_size(m_core.get_current_blockchain_height());
+    if (m_block_sync_size_fixed)
+      return default_count;
+
+    // average weight of the blocks we'd ask this peer for next, from the chain entry
+    uint64_t weight = 0, nweights = 0;
+    for (size_t n = 0; n < context.m_needed_objects.size() && n < BLOCKS_SYNCHRONIZING_MAX_COUNT; ++n)
+    {
+      if (context.m_needed_objects[n].second)
+      {
+        weight += context.m_needed_objects[n].second;
+        ++nweights;
+      }
+    }
+    // without weights neither the bandwidth nor the memory bound below means anything
+    if (nweights == 0)
+      return default_count;
+    const float block_weight = std::max(weight / (float)nweights, 1.0f);
+
+    // start with the default until we know how fast this peer is
+    size_t count = default_count;
+    const float verify_rate = m_sync_verify_rate;
+    if (context.m_sync_download_rate > 0.0f)
+    {
+      // large enough for the transfer to dominate the round trip
+      const float seconds = std::max(SYNC_SPAN_TARGET_SECONDS, SYNC_SPAN_TARGET_RTTS * context.m_sync_rtt);
+      count = std::min<float>(BLOCKS_SYNCHRONIZING_MAX_COUNT, context.m_sync_download_rate * seconds / block_weight);
+
+      // no larger than what we can add in a reasonable time, so spans from slow peers do not stall the queue
+      if (verify_rate > 0.0f)
+        count = std::min<float>(count, verify_rate * SYNC_SPAN_VERIFY_SECONDS);
+    }
+
+    // and so that a full queue of spans fits in the memory budget
+    const size_t block_queue_size_threshold = m_block_download_max_size ? m_block_download_max_size : BLOCK_QUEUE_SIZE_THRESHOLD;
+    count = std::min<float>(count, block_queue_size_threshold / BLOCK_QUEUE_NSPANS_THRESHOLD / block_weight);
+    count = std::max<size_t>(count, std::max<size_t>(default_count / 4, 1));
+    // peers drop anyone asking for more than this in one request
+    count = std::min<size_t>(count, CURRENCY_PROTOCOL_MAX_OBJECT_REQUEST_COUNT);
+    MDEBUG(context << " span size " << count << " (block weight " << block_weight << ", rate " << context.m_sync_download_rate / 1024 << " kB/s, rtt "
+        << context.m_sync_rtt << " s, verify rate " << verify_rate << " blocks/s)");
+    return count;
+  }
+  //------------------------------------------------------------------------------------------------------------------------
+  template<class t_core>
   bool t_cryptonote_protocol_handler<t_core>::request_missing_objects(cryptonote_connection_context& context, bool check_having_blocks, bool force_next_span)
   {
     // flush stale spans
@@ -2071,7 +2346,7 @@ skip:
       NOTIFY_REQUEST_GET_OBJECTS::request req;
       bool is_next = false;
       size_t count = 0;
-      const size_t count_limit = m_core.get_block_sync_size(m_core.get_current_blockchain_height());
+      const size_t count_limit = get_sync_span_size(context);
       std::pair<uint64_t, uint64_t> span = std::make_pair(0, 0);
       if (force_next_span)
       {
@@ -2370,7 +2645,7 @@ skip:
           MDEBUG(context << "not ready, ignoring");
           return true;
         }
-        if (!request_txpool_complement(context))
+        if (!request_txpool_complement(context, support_flags & P2P_SUPPORT_FLAG_TXPOOL_SKETCH))
         {
           MERROR(context << "Failed to request txpool complement");
           return true;
@@ -2401,6 +2676,12 @@ skip:
       << ", m_start_height=" << arg.start_height << ", m_total_height=" << arg.total_height);
     MLOG_PEER_STATE("received chain");
 
+    if (context.m_last_request_time != boost::date_time::not_a_date_time)
+    {
+      // chain entries are small, so their response time is mostly latency
+      const float rtt = (boost::posix_time::microsec_clock::universal_time() - context.m_last_request_time).total_microseconds() / 1e6f;
+      context.m_sync_rtt = context.m_sync_rtt > 0.0f ? context.m_sync_rtt * (1.0f - SYNC_RATE_SMOOTHING) + rtt * SYNC_RATE_SMOOTHING : rtt;
+    }
     context.m_last_request_time = boost::date_time::not_a_date_time;
 
     m_sync_download_chain_size += arg.m_block_ids.size() * sizeof(crypto::hash);
@@ -2483,13 +2764,22 @@ skip:
     fluffy_arg.b = arg.b;
     fluffy_arg.b.txs = fluffy_txs;
 
-    // sort peers between fluffy ones and others
-    std::vector<std::pair<epee::net_utils::zone, boost::uuids::uuid>> fullConnections, fluffyConnections;
-    m_p2p->for_each_connection([this, &exclude_context, &fullConnections, &fluffyConnections](connection_context& context, nodetool::peerid_type peer_id, uint32_t support_flags)
+    // compact blocks only pay off if there are tx hashes to shorten
+    block b;
+    const bool compact = m_core.fluffy_blocks_enabled() && parse_and_validate_block_from_blob(arg.b.block, b) && !b.tx_hashes.empty();
+
+    // sort peers between compact, fluffy ones and others
+    std::vector<std::pair<epee::net_utils::zone, boost::uuids::uuid>> fullConnections, fluffyConnections, compactConnections;
+    m_p2p->for_each_connection([this, compact, &exclude_context, &fullConnections, &fluffyConnections, &compactConnections](connection_context& context, nodetool::peerid_type peer_id, uint32_t support_flags)
     {
       if (peer_id && exclude_context.m_connection_id != context.m_connection_id && context.m_remote_address.get_zone() == epee::net_utils::zone::public_)
       {
-        if(m_core.fluffy_blocks_enabled() && (support_flags & P2P_SUPPORT_FLAG_FLUFFY_BLOCKS))
+        if(compact && (support_flags & P2P_SUPPORT_FLAG_COMPACT_BLOCKS))
+        {
+          LOG_DEBUG_CC(context, "PEER SUPPORTS COMPACT BLOCKS - RELAYING SHORT TX IDS");
+          compactConnections.push_back({context.m_remote_address.get_zone(), context.m_connection_id});
+        }
+        else if(m_core.fluffy_blocks_enabled() && (support_flags & P2P_SUPPORT_FLAG_FLUFFY_BLOCKS))
         {
           LOG_DEBUG_CC(context, "PEER SUPPORTS FLUFFY BLOCKS - RELAYING THIN/COMPACT WHATEVER BLOCK");
           fluffyConnections.push_back({context.m_remote_address.get_zone(), context.m_connection_id});
@@ -2503,7 +2793,30 @@ skip:
       return true;
     });
 
-    // send fluffy ones first, we want to encourage people to run that
+    // send compact ones first, they're the cheapest to relay
+    if (!compactConnections.empty())
+    {
+      NOTIFY_NEW_COMPACT_BLOCK::request compact_arg = AUTO_VAL_INIT(compact_arg);
+      compact_arg.block_hash = get_block_hash(b);
+      compact_arg.salt = crypto::rand<uint64_t>();
+      compact_arg.current_blockchain_height = arg.current_blockchain_height;
+      const short_tx_id_key key = get_short_tx_id_key(compact_arg.block_hash, compact_arg.salt);
+      compact_arg.short_tx_ids.reserve(b.tx_hashes.size() * COMPACT_BLOCK_SHORT_TX_ID_SIZE);
+      for (const crypto::hash &tx_hash: b.tx_hashes)
+      {
+        const uint64_t short_id = get_short_tx_id(key, tx_hash);
+        for (size_t j = 0; j < COMPACT_BLOCK_SHORT_TX_ID_SIZE; ++j)
+          compact_arg.short_tx_ids.push_back((char)(short_id >> (8 * j)));
+      }
+      b.tx_hashes.clear();
+      b.invalidate_hashes();
+      compact_arg.block = block_to_blob(b);
+
+      std::string compactBlob;
+      epee::serialization::store_t_to_binary(compact_arg, compactBlob);
+      m_p2p->relay_notify_to_list(NOTIFY_NEW_COMPACT_BLOCK::ID, epee::strspan<uint8_t>(compactBlob), std::move(compactConnections));
+    }
+    // then fluffy ones, we want to encourage people to run that
     if (!fluffyConnections.empty())
     {
       std::string fluffyBlob;
@@ -2532,7 +2845,7 @@ skip:
   }
   //------------------------------------------------------------------------------------------------------------------------
   template<class t_core>
-  bool t_cryptonote_protocol_handler<t_core>::request_txpool_complement(cryptonote_connection_context &context)
+  bool t_cryptonote_protocol_handler<t_core>::request_txpool_complement(cryptonote_connection_context &context, bool use_sketch)
   {
     NOTIFY_GET_TXPOOL_COMPLEMENT::request r = {};
     if (!m_core.get_pool_transaction_hashes(r.hashes, false))
@@ -2540,6 +2853,21 @@ skip:
       MERROR("Failed to get txpool hashes");
       return false;
     }
+    if (use_sketch)
+    {
+      // send a sketch sized after the expected difference instead of all the hashes
+      NOTIFY_GET_TXPOOL_SKETCH_COMPLEMENT::request sr = {};
+      sr.salt = crypto::rand<uint64_t>();
+      txpool_sketch sketch(sr.salt, txpool_sketch::get_cells(r.hashes.size()));
+      for (const crypto::hash &txid: r.hashes)
+        sketch.insert(sketch.get_key(txid));
+      sr.sketch = sketch.serialize();
+      context.m_txpool_sketch_sent = true;
+      MLOG_P2P_MESSAGE("-->>NOTIFY_GET_TXPOOL_SKETCH_COMPLEMENT: cells=" << sketch.cells() << ", txpool size " << r.hashes.size());
+      post_notify<NOTIFY_GET_TXPOOL_SKETCH_COMPLEMENT>(sr, context);
+      MLOG_PEER_STATE("requesting txpool complement");
+      return true;
+    }
     MLOG_P2P_MESSAGE("-->>NOTIFY_GET_TXPOOL_COMPLEMENT: hashes.size()=" << r.hashes.size() );
     post_notify<NOTIFY_GET_TXPOOL_COMPLEMENT>(r, context);
     MLOG_PEER_STATE("requesting txpool complement");
@@ -28,11 +28,13 @@
 
 #include "levin_notify.h"
 
+#include <algorithm>
 #include <boost/asio/steady_timer.hpp>
 #include <boost/system/system_error.hpp>
 #include <boost/uuid/uuid_io.hpp>
 #include <chrono>
 #include <deque>
+#include <memory>
 #include <stdexcept>
 #include <utility>
 
@@ -45,6 +47,7 @@
 #include "cryptonote_core/i_core_events.h"
 #include "cryptonote_protocol/cryptonote_protocol_defs.h"
 #include "net/dandelionpp.h"
+#include "net/network_throttle.hpp"
 #include "p2p/net_node.h"
 
 #undef MONERO_DEFAULT_LOG_CATEGORY
@@ -165,14 +168,37 @@ namespace levin
       return fullBlob;
     }
 
-    bool make_payload_send_txs(connections& p2p, std::vector<blobdata>&& txs, const boost::uuids::uuid& destination, const bool pad, const bool fluff)
+    //! Serializes and frames `txs` once, and sends the same buffer to every connection in `destinations`. \return Bytes queued.
+    std::size_t make_payload_send_txs(connections& p2p, std::vector<blobdata>&& txs, const epee::span<const boost::uuids::uuid> destinations, const bool pad, const bool fluff)
     {
       const cryptonote::blobdata blob = make_tx_payload(std::move(txs), pad, fluff);
-      p2p.for_connection(destination, [&blob](detail::p2p_context& context) {
-        on_levin_traffic(context, true, true, false, blob.size(), get_command_from_message(blob));
-        return true;
-      });
-      return p2p.notify(NOTIFY_NEW_TRANSACTIONS::ID, epee::strspan<std::uint8_t>(blob), destination);
+      const epee::byte_slice message = epee::levin::make_notify(NOTIFY_NEW_TRANSACTIONS::ID, epee::strspan<std::uint8_t>(blob));
+      std::size_t sent = 0;
+      for (const boost::uuids::uuid& destination : destinations)
+      {
+        p2p.for_connection(destination, [&blob](detail::p2p_context& context) {
+          on_levin_traffic(context, true, true, false, blob.size(), get_command_from_message(blob));
+          return true;
+        });
+        if (0 < p2p.send(message.clone(), destination))
+          sent += message.size();
+      }
+      return sent;
+    }
+
+    //! Counts `bytes` against the tx relay budget, \return How long relay should pause to stay within it.
+    std::chrono::nanoseconds charge_tx_relay(const std::size_t bytes)
+    {
+      if (!bytes)
+        return std::chrono::nanoseconds{0};
+      return epee::net_utils::network_throttle_manager::get_class_bucket(epee::net_utils::traffic_class::tx_relay).consume(bytes);
+    }
+
+    bool make_payload_send_txs(connections& p2p, std::vector<blobdata>&& txs, const boost::uuids::uuid& destination, const bool pad, const bool fluff)
+    {
+      const std::size_t sent = make_payload_send_txs(p2p, std::move(txs), {std::addressof(destination), 1}, pad, fluff);
+      charge_tx_relay(sent); // stem timing is part of Dandelion++, so only fluffs wait for the budget
+      return sent != 0;
     }
 
     /* The current design uses `asio::strand`s. The documentation isn't as clear
@@ -242,6 +268,7 @@ namespace levin
           map(),
           channels(),
           flush_time(std::chrono::steady_clock::time_point::max()),
+          relay_resume(),
           connection_count(0),
           is_public(is_public),
           pad_txs(pad_txs),
@@ -259,6 +286,7 @@ namespace levin
       net::dandelionpp::connection_map map;//!< Tracks outgoing uuid's for noise channels or Dandelion++ stems
       std::deque<noise_channel> channels;  //!< Never touch after init; only update elements on `noise_channel.strand`
       std::chrono::steady_clock::time_point flush_time; //!< Next expected Dandelion++ fluff flush
+      std::chrono::steady_clock::time_point relay_resume; //!< Fluff flushes wait until then, when over the tx relay budget
       std::atomic<std::size_t> connection_count; //!< Only update in strand, can be read at any time
       const bool is_public;                      //!< Zone is public ipv4/ipv6 connections
       const bool pad_txs;                        //!< Pad txs to the next boundary for privacy
@@ -337,6 +365,13 @@ namespace levin
         }
 
         const auto now = std::chrono::steady_clock::now();
+        if (!timer_error && now < zone_->relay_resume)
+        {
+          const auto resume = zone_->relay_resume;
+          fluff_flush::queue(std::move(zone_), resume);
+          return;
+        }
+
         auto next_flush = std::chrono::steady_clock::time_point::max();
         std::vector<std::pair<std::vector<blobdata>, boost::uuids::uuid>> connections{};
         zone_->p2p->foreach_connection([timer_error, now, &next_flush, &connections] (detail::p2p_context& context)
@@ -357,11 +392,32 @@ namespace levin
           return true;
         });
 
-        // Always send txs in stem mode over i2p/tor, see comments in `send_txs` below.
+        // Connections flushed together usually have the same txs queued, so
+        // group them and serialize each distinct set of txs only once.
         for (auto& connection : connections)
-        {
           std::sort(connection.first.begin(), connection.first.end()); // don't leak receive order
-          make_payload_send_txs(*zone_->p2p, std::move(connection.first), connection.second, zone_->pad_txs, zone_->is_public);
+        std::sort(connections.begin(), connections.end());
+
+        // Always send txs in stem mode over i2p/tor, see comments in `send_txs` below.
+        std::vector<boost::uuids::uuid> destinations;
+        std::size_t sent = 0;
+        for (auto connection = connections.begin(); connection != connections.end(); )
+        {
+          destinations.clear();
+          auto next = connection;
+          for (; next != connections.end() && next->first == connection->first; ++next)
+            destinations.push_back(next->second);
+          sent += make_payload_send_txs(*zone_->p2p, std::move(connection->first), epee::to_span(destinations), zone_->pad_txs, zone_->is_public);
+          connection = next;
+        }
+
+        // Over budget, the queued fluffs keep accumulating and go out in fewer, larger batches
+        const std::chrono::nanoseconds delay = charge_tx_relay(sent);
+        if (delay.count() > 0)
+        {
+          zone_->relay_resume = now + std::chrono::duration_cast<std::chrono::steady_clock::duration>(delay);
+          if (next_flush != std::chrono::steady_clock::time_point::max())
+            next_flush = std::max(next_flush, zone_->relay_resume);
         }
 
         if (next_flush != std::chrono::steady_clock::time_point::max())
@@ -0,0 +1,203 @@
+// Copyright (c) 2020, The Monero Project
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are
+// permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of
+//    conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list
+//    of conditions and the following disclaimer in the documentation and/or other
+//    materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be
+//    used to endorse or promote products derived from this software without specific
+//    prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL
+// THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "txpool_sketch.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "int-util.h"
+#include "crypto/siphash.h"
+
+// number of cells each key is added to, one per subtable
+#define TXPOOL_SKETCH_HASHES 3
+#define TXPOOL_SKETCH_MIN_CELLS 96
+#define TXPOOL_SKETCH_MAX_CELLS 8190
+
+namespace cryptonote
+{
+  namespace
+  {
+    std::uint64_t mix64(std::uint64_t x) noexcept
+    {
+      // splitmix64 finalizer
+      x ^= x >> 30;
+      x *= 0xbf58476d1ce4e5b9ull;
+      x ^= x >> 27;
+      x *= 0x94d049bb133111ebull;
+      x ^= x >> 31;
+      return x;
+    }
+
+    std::uint32_t get_check(std::uint64_t key) noexcept
+    {
+      return std::uint32_t(mix64(key ^ 0x5851f42d4c957f2dull));
+    }
+  }
+
+  std::size_t txpool_sketch::get_cells(const std::size_t txpool_size) noexcept
+  {
+    // a quarter of the pool decodes differences up to about a sixth of it,
+    // at an eighth of the bytes of the full hash list
+    std::size_t cells = std::max(std::size_t(TXPOOL_SKETCH_MIN_CELLS), std::min(std::size_t(TXPOOL_SKETCH_MAX_CELLS), txpool_size / 4));
+    return cells - cells % TXPOOL_SKETCH_HASHES;
+  }
+
+  txpool_sketch::txpool_sketch(const std::uint64_t salt, const std::size_t cells)
+    : salt_(salt),
+      counts_(cells - cells % TXPOOL_SKETCH_HASHES, 0),
+      keys_(counts_.size(), 0),
+      checks_(counts_.size(), 0)
+  {
+    const std::uint64_t salt_le = SWAP64LE(salt);
+    crypto::cn_fast_hash(&salt_le, sizeof(salt_le), hash_key_);
+  }
+
+  std::uint64_t txpool_sketch::get_key(const crypto::hash& txid) const noexcept
+  {
+    static_assert(sizeof(hash_key_) >= SIPHASH_KEYLEN, "Unexpected siphash key size");
+    return siphash24(reinterpret_cast<const std::uint8_t*>(hash_key_.data), reinterpret_cast<const std::uint8_t*>(txid.data), sizeof(txid.data));
+  }
+
+  std::size_t txpool_sketch::get_cell(const std::uint64_t key, const unsigned i) const noexcept
+  {
+    // one cell per subtable, so a key never lands twice in the same cell
+    const std::size_t subtable = counts_.size() / TXPOOL_SKETCH_HASHES;
+    return i * subtable + mix64(key + i) % subtable;
+  }
+
+  void txpool_sketch::add(const std::uint64_t key, const std::int32_t count) noexcept
+  {
+    const std::uint32_t check = get_check(key);
+    for (unsigned i = 0; i < TXPOOL_SKETCH_HASHES; ++i)
+    {
+      const std::size_t cell = get_cell(key, i);
+      counts_[cell] += count;
+      keys_[cell] ^= key;
+      checks_[cell] ^= check;
+    }
+  }
+
+  void txpool_sketch::insert(const std::uint64_t key) noexcept
+  {
+    if (!counts_.empty())
+      add(key, 1);
+  }
+
+  bool txpool_sketch::subtract(const txpool_sketch& other) noexcept
+  {
+    if (other.salt_ != salt_ || other.cells() != cells())
+      return false;
+    for (std::size_t i = 0; i < counts_.size(); ++i)
+    {
+      counts_[i] -= other.counts_[i];
+      keys_[i] ^= other.keys_[i];
+      checks_[i] ^= other.checks_[i];
+    }
+    return true;
+  }
+
+  bool txpool_sketch::decode(std::vector<std::uint64_t>& ours, std::vector<std::uint64_t>& theirs) const
+  {
+    ours.clear();
+    theirs.clear();
+
+    txpool_sketch work{*this};
+    std::vector<std::size_t> pure;
+    for (std::size_t i = 0; i < work.counts_.size(); ++i)
+      pure.push_back(i);
+
+    // peel cells holding a single key until none is left
+    while (!pure.empty())
+    {
+      const std::size_t cell = pure.back();
+      pure.pop_back();
+
+      const std::int32_t count = work.counts_[cell];
+      const std::uint64_t key = work.keys_[cell];
+      if ((count != 1 && count != -1) || work.checks_[cell] != get_check(key))
+        continue;
+
+      // no valid sketch holds more keys than cells, don't let a crafted one spin
+      if (ours.size() + theirs.size() >= work.counts_.size())
+        return false;
+      (count == 1 ? ours : theirs).push_back(key);
+      work.add(key, -count);
+      for (unsigned i = 0; i < TXPOOL_SKETCH_HASHES; ++i)
+        pure.push_back(work.get_cell(key, i));
+    }
+
+    for (std::size_t i = 0; i < work.counts_.size(); ++i)
+    {
+      if (work.counts_[i] || work.keys_[i] || work.checks_[i])
+        return false;
+    }
+    return true;
+  }
+
+  std::string txpool_sketch::serialize() const
+  {
+    std::string blob;
+    blob.resize(counts_.size() * cell_size);
+    char *p = &blob[0];
+    for (std::size_t i = 0; i < counts_.size(); ++i, p += cell_size)
+    {
+      const std::uint32_t count = SWAP32LE(std::uint32_t(counts_[i]));
+      const std::uint64_t key = SWAP64LE(keys_[i]);
+      const std::uint32_t check = SWAP32LE(checks_[i]);
+      std::memcpy(p, &count, 4);
+      std::memcpy(p + 4, &key, 8);
+      std::memcpy(p + 12, &check, 4);
+    }
+    return blob;
+  }
+
+  bool txpool_sketch::load(const std::string& blob)
+  {
+    const std::size_t cells = blob.size() / cell_size;
+    if (blob.size() % cell_size || cells % TXPOOL_SKETCH_HASHES || cells < TXPOOL_SKETCH_MIN_CELLS - TXPOOL_SKETCH_MIN_CELLS % TXPOOL_SKETCH_HASHES || cells > TXPOOL_SKETCH_MAX_CELLS)
+      return false;
+
+    counts_.resize(cells);
+    keys_.resize(cells);
+    checks_.resize(cells);
+    const char *p = blob.data();
+    for (std::size_t i = 0; i < cells; ++i, p += cell_size)
+    {
+      std::uint32_t count, check;
+      std::uint64_t key;
+      std::memcpy(&count, p, 4);
+      std::memcpy(&key, p + 4, 8);
+      std::memcpy(&check, p + 12, 4);
+      counts_[i] = std::int32_t(SWAP32LE(count));
+      keys_[i] = SWAP64LE(key);
+      checks_[i] = SWAP32LE(check);
+    }
+    return true;
+  }
+}
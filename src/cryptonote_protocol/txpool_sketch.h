@@ -0,0 +1,92 @@
+// Copyright (c) 2020, The Monero Project
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are
+// permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of
+//    conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list
+//    of conditions and the following disclaimer in the documentation and/or other
+//    materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be
+//    used to endorse or promote products derived from this software without specific
+//    prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL
+// THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "crypto/hash.h"
+
+namespace cryptonote
+{
+  /*! Invertible Bloom lookup table over txpool tx hashes
+
+    Two peers each build a sketch of their txpool with the same salt and
+    number of cells. Subtracting one from the other cancels the txes they
+    share, so that the difference can be decoded from a sketch sized after
+    the expected difference rather than after the whole pool.
+
+    Tx hashes are reduced to salted 64 bit keys, the caller maps them back
+    to its own tx hashes. */
+  class txpool_sketch
+  {
+  public:
+    //! Size of a serialized cell
+    static constexpr const std::size_t cell_size = 16;
+
+    //! \return Number of cells for a pool of `txpool_size` txes, a multiple of 3
+    static std::size_t get_cells(std::size_t txpool_size) noexcept;
+
+    txpool_sketch(std::uint64_t salt, std::size_t cells);
+
+    std::uint64_t salt() const noexcept { return salt_; }
+    std::size_t cells() const noexcept { return counts_.size(); }
+
+    //! \return Salted key for `txid`, as used by `insert`
+    std::uint64_t get_key(const crypto::hash& txid) const noexcept;
+
+    void insert(std::uint64_t key) noexcept;
+
+    //! Subtract `other`, which must have the same salt and size. \return False if it does not
+    bool subtract(const txpool_sketch& other) noexcept;
+
+    /*! Decode a sketch on which `subtract` was called.
+
+      \param[out] ours keys only in this sketch
+      \param[out] theirs keys only in the subtracted sketch
+      \return False if the difference was too large to decode */
+    bool decode(std::vector<std::uint64_t>& ours, std::vector<std::uint64_t>& theirs) const;
+
+    std::string serialize() const;
+
+    //! \return False if `blob` is not a valid serialized sketch
+    bool load(const std::string& blob);
+
+  private:
+    std::size_t get_cell(std::uint64_t key, unsigned i) const noexcept;
+    void add(std::uint64_t key, std::int32_t count) noexcept;
+
+    std::uint64_t salt_;
+    crypto::hash hash_key_;
+    std::vector<std::int32_t> counts_;
+    std::vector<std::uint64_t> keys_;
+    std::vector<std::uint32_t> checks_;
+  };
+}
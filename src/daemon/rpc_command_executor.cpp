@@ -587,6 +587,8 @@ bool t_rpc_command_executor::mining_status() {
   else
   {
     tools::msg_writer() << "Mining at " << get_mining_speed(mres.speed) << " with " << mres.threads_count << " threads";
+    for (size_t i = 0; i < mres.threads_speed.size(); ++i)
+      tools::msg_writer() << "  thread " << i << ": " << get_mining_speed(mres.threads_speed[i]);
   }
 
   tools::msg_writer() << "PoW algorithm: " << mres.pow_algorithm;
@@ -740,6 +742,13 @@ bool t_rpc_command_executor::print_net_stats()
     % percent
     % tools::get_human_readable_bytes(limit);
 
+  tools::success_msg_writer() << boost::format("Throttled for %u ms in, %u ms out; sent %s for block sync, %s for tx relay, %s for RPC")
+    % net_stats_res.total_delay_in_ms
+    % net_stats_res.total_delay_out_ms
+    % tools::get_human_readable_bytes(net_stats_res.block_sync_bytes_out)
+    % tools::get_human_readable_bytes(net_stats_res.tx_relay_bytes_out)
+    % tools::get_human_readable_bytes(net_stats_res.rpc_bytes_out);
+
   return true;
 }
 
@@ -395,7 +395,7 @@ namespace offshore
   }
 
   // overload for pr validation for block
-  bool pricing_record::valid(cryptonote::network_type nettype, uint32_t hf_version, uint64_t bl_timestamp, uint64_t last_bl_timestamp) const 
+  bool pricing_record::valid(cryptonote::network_type nettype, uint32_t hf_version, uint64_t bl_timestamp, uint64_t last_bl_timestamp, bool check_signature) const 
   {
     // check for empty pr 
     if (hf_version >= HF_VERSION_XASSET_FEES_V2) {
@@ -409,8 +409,8 @@ namespace offshore
       }
     }
 
-    // verify the signature
-    if (hf_version >= HF_VERSION_OFFSHORE_FULL) {
+    // verify the signature, unless the caller already did
+    if (check_signature && hf_version >= HF_VERSION_OFFSHORE_FULL) {
       if (!verifySignature(get_config(nettype).ORACLE_PUBLIC_KEY)) {
         LOG_ERROR("Invalid pricing record signature.");
         return false;
@@ -117,7 +117,7 @@ namespace offshore
       bool equal(const pricing_record& other) const noexcept;
       bool empty() const noexcept;
       bool verifySignature(const std::string& public_key) const;
-      bool valid(cryptonote::network_type nettype, uint32_t hf_version, uint64_t bl_timestamp, uint64_t last_bl_timestamp) const;
+      bool valid(cryptonote::network_type nettype, uint32_t hf_version, uint64_t bl_timestamp, uint64_t last_bl_timestamp, bool check_signature = true) const;
 
       pricing_record& operator=(const pricing_record& orig) noexcept;
       uint64_t operator[](const std::string& asset_type) const;
@@ -160,6 +160,9 @@ namespace nodetool
     const command_line::arg_descriptor<int64_t> arg_limit_rate_up = {"limit-rate-up", "set limit-rate-up [kB/s]", P2P_DEFAULT_LIMIT_RATE_UP};
     const command_line::arg_descriptor<int64_t> arg_limit_rate_down = {"limit-rate-down", "set limit-rate-down [kB/s]", P2P_DEFAULT_LIMIT_RATE_DOWN};
     const command_line::arg_descriptor<int64_t> arg_limit_rate = {"limit-rate", "set limit-rate [kB/s]", -1};
+    const command_line::arg_descriptor<int64_t> arg_limit_rate_sync = {"limit-rate-sync", "set limit-rate for blocks served to syncing peers [kB/s], 0 for the global limit only", 0};
+    const command_line::arg_descriptor<int64_t> arg_limit_rate_tx_relay = {"limit-rate-tx-relay", "set limit-rate for tx relay [kB/s], 0 for the global limit only", 0};
+    const command_line::arg_descriptor<int64_t> arg_limit_rate_rpc = {"limit-rate-rpc", "set limit-rate for RPC responses [kB/s], 0 for unlimited", 0};
 
     const command_line::arg_descriptor<bool> arg_pad_transactions = {
       "pad-transactions", "Pad relayed transactions to help defend against traffic volume analysis", false
@@ -337,6 +337,8 @@ namespace nodetool
     virtual epee::net_utils::zone send_txs(std::vector<cryptonote::blobdata> txs, const epee::net_utils::zone origin, const boost::uuids::uuid& source, cryptonote::i_core_events& core, cryptonote::relay_method tx_relay);
     virtual bool invoke_command_to_peer(int command, const epee::span<const uint8_t> req_buff, std::string& resp_buff, const epee::net_utils::connection_context_base& context);
     virtual bool invoke_notify_to_peer(int command, const epee::span<const uint8_t> req_buff, const epee::net_utils::connection_context_base& context);
+    virtual bool send_notify_to_peer(int command, epee::byte_slice message, const epee::net_utils::connection_context_base& context);
+    virtual void post_after(std::chrono::nanoseconds delay, const epee::net_utils::connection_context_base& context, std::function<void(bool)> f);
     virtual bool drop_connection(const epee::net_utils::connection_context_base& context);
     virtual void request_callback(const epee::net_utils::connection_context_base& context);
     virtual void for_each_connection(std::function<bool(typename t_payload_net_handler::connection_context&, peerid_type, uint32_t)> f);
@@ -400,6 +402,7 @@ namespace nodetool
     bool set_rate_up_limit(const boost::program_options::variables_map& vm, int64_t limit);
     bool set_rate_down_limit(const boost::program_options::variables_map& vm, int64_t limit);
     bool set_rate_limit(const boost::program_options::variables_map& vm, int64_t limit);
+    bool set_class_rate_limit(epee::net_utils::traffic_class cls, int64_t limit);
 
     bool has_too_many_connections(const epee::net_utils::network_address &address);
     size_t get_incoming_connections_count();
@@ -536,6 +539,9 @@ namespace nodetool
     extern const command_line::arg_descriptor<int64_t> arg_limit_rate_up;
     extern const command_line::arg_descriptor<int64_t> arg_limit_rate_down;
     extern const command_line::arg_descriptor<int64_t> arg_limit_rate;
+    extern const command_line::arg_descriptor<int64_t> arg_limit_rate_sync;
+    extern const command_line::arg_descriptor<int64_t> arg_limit_rate_tx_relay;
+    extern const command_line::arg_descriptor<int64_t> arg_limit_rate_rpc;
     extern const command_line::arg_descriptor<bool> arg_pad_transactions;
 }
 
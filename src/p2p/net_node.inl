@@ -31,6 +31,7 @@
 // IP blocking adapted from Boolberry
 
 #include <algorithm>
+#include <boost/asio/steady_timer.hpp>
 #include <boost/bind.hpp>
 #include <boost/date_time/posix_time/posix_time.hpp>
 #include <boost/filesystem/operations.hpp>
@@ -116,6 +117,9 @@ namespace nodetool
     command_line::add_arg(desc, arg_limit_rate_up);
     command_line::add_arg(desc, arg_limit_rate_down);
     command_line::add_arg(desc, arg_limit_rate);
+    command_line::add_arg(desc, arg_limit_rate_sync);
+    command_line::add_arg(desc, arg_limit_rate_tx_relay);
+    command_line::add_arg(desc, arg_limit_rate_rpc);
     command_line::add_arg(desc, arg_pad_transactions);
   }
   //-----------------------------------------------------------------------------------
@@ -468,6 +472,15 @@ namespace nodetool
     if ( !set_rate_limit(vm, command_line::get_arg(vm, arg_limit_rate) ) )
       return false;
 
+    if ( !set_class_rate_limit(epee::net_utils::traffic_class::block_sync, command_line::get_arg(vm, arg_limit_rate_sync) ) )
+      return false;
+
+    if ( !set_class_rate_limit(epee::net_utils::traffic_class::tx_relay, command_line::get_arg(vm, arg_limit_rate_tx_relay) ) )
+      return false;
+
+    if ( !set_class_rate_limit(epee::net_utils::traffic_class::rpc, command_line::get_arg(vm, arg_limit_rate_rpc) ) )
+      return false;
+
 
     epee::byte_slice noise = nullptr;
     auto proxies = get_proxies(vm);
@@ -1968,6 +1981,8 @@ namespace nodetool
   bool node_server<t_payload_net_handler>::relay_notify_to_list(int command, const epee::span<const uint8_t> data_buff, std::vector<std::pair<epee::net_utils::zone, boost::uuids::uuid>> connections)
   {
     std::sort(connections.begin(), connections.end());
+    // frame the message once, every connection gets a reference to the same buffer
+    const epee::byte_slice message = epee::levin::make_notify(command, data_buff);
     auto zone = m_network_zones.begin();
     for(const auto& c_id: connections)
     {
@@ -1984,7 +1999,7 @@ namespace nodetool
         ++zone;
       }
       if (zone->first == c_id.first)
-        zone->second.m_net_server.get_config_object().notify(command, data_buff, c_id.second);
+        zone->second.m_net_server.get_config_object().send(message.clone(), c_id.second);
     }
     return true;
   }
@@ -2062,6 +2077,28 @@ namespace nodetool
   }
   //-----------------------------------------------------------------------------------
   template<class t_payload_net_handler>
+  bool node_server<t_payload_net_handler>::send_notify_to_peer(int command, epee::byte_slice message, const epee::net_utils::connection_context_base& context)
+  {
+    if(is_filtered_command(context.m_remote_address, command))
+      return false;
+
+    network_zone& zone = m_network_zones.at(context.m_remote_address.get_zone());
+    int res = zone.m_net_server.get_config_object().send(std::move(message), context.m_connection_id);
+    return res > 0;
+  }
+  //-----------------------------------------------------------------------------------
+  template<class t_payload_net_handler>
+  void node_server<t_payload_net_handler>::post_after(std::chrono::nanoseconds delay, const epee::net_utils::connection_context_base& context, std::function<void(bool)> f)
+  {
+    network_zone& zone = m_network_zones.at(context.m_remote_address.get_zone());
+    auto timer = std::make_shared<boost::asio::steady_timer>(zone.m_net_server.get_io_service());
+    timer->expires_from_now(delay);
+    timer->async_wait([timer, f](const boost::system::error_code& ec) {
+      f(!ec);
+    });
+  }
+  //-----------------------------------------------------------------------------------
+  template<class t_payload_net_handler>
   bool node_server<t_payload_net_handler>::invoke_command_to_peer(int command, const epee::span<const uint8_t> req_buff, std::string& resp_buff, const epee::net_utils::connection_context_base& context)
   {
     if(is_filtered_command(context.m_remote_address, command))
@@ -2611,6 +2648,20 @@ namespace nodetool
     return true;
   }
 
+  template<class t_payload_net_handler>
+  bool node_server<t_payload_net_handler>::set_class_rate_limit(epee::net_utils::traffic_class cls, int64_t limit)
+  {
+    if (limit < 0)
+    {
+      MERROR("Invalid per-class rate limit: " << limit);
+      return false;
+    }
+    epee::net_utils::network_throttle_manager::get_class_bucket(cls).set_rate(limit * 1024);
+    if (limit)
+      MINFO("Set limit for traffic class " << static_cast<unsigned>(cls) << " to " << limit << " kB/s");
+    return true;
+  }
+
   template<class t_payload_net_handler>
   bool node_server<t_payload_net_handler>::has_too_many_connections(const epee::net_utils::network_address &address)
   {
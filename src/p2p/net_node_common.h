@@ -31,8 +31,11 @@
 #pragma once
 
 #include <boost/uuid/uuid.hpp>
+#include <chrono>
+#include <functional>
 #include <utility>
 #include <vector>
+#include "byte_slice.h"
 #include "cryptonote_basic/blobdatatype.h"
 #include "cryptonote_protocol/enums.h"
 #include "cryptonote_protocol/fwd.h"
@@ -53,6 +56,8 @@ namespace nodetool
     virtual epee::net_utils::zone send_txs(std::vector<cryptonote::blobdata> txs, const epee::net_utils::zone origin, const boost::uuids::uuid& source, cryptonote::i_core_events& core, cryptonote::relay_method tx_relay)=0;
     virtual bool invoke_command_to_peer(int command, const epee::span<const uint8_t> req_buff, std::string& resp_buff, const epee::net_utils::connection_context_base& context)=0;
     virtual bool invoke_notify_to_peer(int command, const epee::span<const uint8_t> req_buff, const epee::net_utils::connection_context_base& context)=0;
+    virtual bool send_notify_to_peer(int command, epee::byte_slice message, const epee::net_utils::connection_context_base& context)=0;
+    virtual void post_after(std::chrono::nanoseconds delay, const epee::net_utils::connection_context_base& context, std::function<void(bool)> f)=0; // runs f on the peer's zone io_service once delay has passed (true) or the wait was aborted (false)
     virtual bool drop_connection(const epee::net_utils::connection_context_base& context)=0;
     virtual void request_callback(const epee::net_utils::connection_context_base& context)=0;
     virtual uint64_t get_public_connections_count()=0;
@@ -87,6 +92,14 @@ namespace nodetool
     {
       return true;
     }
+    virtual bool send_notify_to_peer(int command, epee::byte_slice message, const epee::net_utils::connection_context_base& context)
+    {
+      return true;
+    }
+    virtual void post_after(std::chrono::nanoseconds delay, const epee::net_utils::connection_context_base& context, std::function<void(bool)> f)
+    {
+      f(true);
+    }
     virtual bool drop_connection(const epee::net_utils::connection_context_base& context)
     {
       return false;
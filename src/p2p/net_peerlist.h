@@ -39,8 +39,11 @@
 #include <boost/multi_index/ordered_index.hpp>
 #include <boost/multi_index/identity.hpp>
 #include <boost/multi_index/member.hpp>
+#include <boost/multi_index/random_access_index.hpp>
 #include <boost/optional/optional.hpp>
 #include <boost/range/adaptor/reversed.hpp>
+#include <boost/thread/locks.hpp>
+#include <boost/thread/shared_mutex.hpp>
 
 
 #include "crypto/crypto.h"
@@ -100,8 +103,8 @@ namespace nodetool
   {
   public: 
     bool init(peerlist_types&& peers, bool allow_local_ip);
-    size_t get_white_peers_count(){CRITICAL_REGION_LOCAL(m_peerlist_lock); return m_peers_white.size();}
-    size_t get_gray_peers_count(){CRITICAL_REGION_LOCAL(m_peerlist_lock); return m_peers_gray.size();}
+    size_t get_white_peers_count(){boost::shared_lock<boost::shared_mutex> lock(m_peerlist_lock); return m_peers_white.size();}
+    size_t get_gray_peers_count(){boost::shared_lock<boost::shared_mutex> lock(m_peerlist_lock); return m_peers_gray.size();}
     bool merge_peerlist(const std::vector<peerlist_entry>& outer_bs, const std::function<bool(const peerlist_entry&)> &f = NULL);
     bool get_peerlist_head(std::vector<peerlist_entry>& bs_head, bool anonymize, uint32_t depth = P2P_DEFAULT_PEERS_IN_HANDSHAKE);
     void get_peerlist(std::vector<peerlist_entry>& pl_gray, std::vector<peerlist_entry>& pl_white);
@@ -124,6 +127,7 @@ namespace nodetool
     struct by_time{};
     struct by_id{};
     struct by_addr{};
+    struct by_random{};
 
     struct modify_all_but_id
     {
@@ -165,7 +169,9 @@ namespace nodetool
       // access by peerlist_entry::net_adress
       boost::multi_index::ordered_unique<boost::multi_index::tag<by_addr>, boost::multi_index::member<peerlist_entry,epee::net_utils::network_address,&peerlist_entry::adr> >,
       // sort by peerlist_entry::last_seen<
-      boost::multi_index::ordered_non_unique<boost::multi_index::tag<by_time>, boost::multi_index::member<peerlist_entry,int64_t,&peerlist_entry::last_seen> >
+      boost::multi_index::ordered_non_unique<boost::multi_index::tag<by_time>, boost::multi_index::member<peerlist_entry,int64_t,&peerlist_entry::last_seen> >,
+      // constant time access by position, for uniform sampling
+      boost::multi_index::random_access<boost::multi_index::tag<by_random> >
       > 
     > peers_indexed;
 
@@ -182,9 +188,11 @@ namespace nodetool
   private: 
     void trim_white_peerlist();
     void trim_gray_peerlist();
+    void add_peer_gray(const peerlist_entry& pr);
 
     friend class boost::serialization::access;
-    epee::critical_section m_peerlist_lock;
+    // readers (handshakes, peer selection) share it, only updates are exclusive
+    boost::shared_mutex m_peerlist_lock;
     std::string m_config_folder;
     bool m_allow_local_ip;
 
@@ -215,11 +223,11 @@ namespace nodetool
   inline 
   bool peerlist_manager::merge_peerlist(const std::vector<peerlist_entry>& outer_bs, const std::function<bool(const peerlist_entry&)> &f)
   {
-    CRITICAL_REGION_LOCAL(m_peerlist_lock);
+    boost::unique_lock<boost::shared_mutex> lock(m_peerlist_lock);
     for(const peerlist_entry& be:  outer_bs)
     {
-      if (!f || f(be))
-        append_with_peer_gray(be);
+      if ((!f || f(be)) && is_host_allowed(be.adr))
+        add_peer_gray(be);
     }
     // delete extra elements
     trim_gray_peerlist();    
@@ -229,7 +237,7 @@ namespace nodetool
   inline
   bool peerlist_manager::get_white_peer_by_index(peerlist_entry& p, size_t i)
   {
-    CRITICAL_REGION_LOCAL(m_peerlist_lock);
+    boost::shared_lock<boost::shared_mutex> lock(m_peerlist_lock);
     if(i >= m_peers_white.size())
       return false;
 
@@ -241,7 +249,7 @@ namespace nodetool
   inline
     bool peerlist_manager::get_gray_peer_by_index(peerlist_entry& p, size_t i)
   {
-    CRITICAL_REGION_LOCAL(m_peerlist_lock);
+    boost::shared_lock<boost::shared_mutex> lock(m_peerlist_lock);
     if(i >= m_peers_gray.size())
       return false;
 
@@ -266,7 +274,7 @@ namespace nodetool
   inline 
   bool peerlist_manager::get_peerlist_head(std::vector<peerlist_entry>& bs_head, bool anonymize, uint32_t depth)
   {
-    CRITICAL_REGION_LOCAL(m_peerlist_lock);
+    boost::shared_lock<boost::shared_mutex> lock(m_peerlist_lock);
     peers_indexed::index<by_time>::type& by_time_index=m_peers_white.get<by_time>();
     uint32_t cnt = 0;
 
@@ -282,32 +290,45 @@ namespace nodetool
     //
     // See Cao, Tong et al. "Exploring the Monero Peer-to-Peer Network". https://eprint.iacr.org/2019/411
     //
-    const uint32_t pick_depth = anonymize ? m_peers_white.size() : depth;
-    bs_head.reserve(pick_depth);
+    if (anonymize)
+    {
+      // sample depth distinct peers uniformly (Floyd), without copying the whole list
+      const peers_indexed::index<by_random>::type& by_random_index = m_peers_white.get<by_random>();
+      const size_t n = by_random_index.size();
+      const size_t k = std::min<size_t>(depth, n);
+      std::vector<size_t> picked;
+      picked.reserve(k);
+      for (size_t j = n - k; j < n; ++j)
+      {
+        const size_t t = crypto::rand_idx(j + 1);
+        picked.push_back(std::find(picked.begin(), picked.end(), t) == picked.end() ? t : j);
+      }
+      std::shuffle(picked.begin(), picked.end(), crypto::random_device{});
+      bs_head.reserve(k);
+      for (size_t idx: picked)
+      {
+        bs_head.push_back(by_random_index[idx]);
+        bs_head.back().last_seen = 0;
+      }
+      return true;
+    }
+
+    bs_head.reserve(depth);
     for(const peers_indexed::value_type& vl: boost::adaptors::reverse(by_time_index))
     {
-      if(cnt++ >= pick_depth)
+      if(cnt++ >= depth)
         break;
 
       bs_head.push_back(vl);
     }
 
-    if (anonymize)
-    {
-      std::shuffle(bs_head.begin(), bs_head.end(), crypto::random_device{});
-      if (bs_head.size() > depth)
-        bs_head.resize(depth);
-      for (auto &e: bs_head)
-        e.last_seen = 0;
-    }
-
     return true;
   }
   //--------------------------------------------------------------------------------------------------
   template<typename F> inline
   bool peerlist_manager::foreach(bool white, const F &f)
   {
-    CRITICAL_REGION_LOCAL(m_peerlist_lock);
+    boost::shared_lock<boost::shared_mutex> lock(m_peerlist_lock);
     peers_indexed::index<by_time>::type& by_time_index = white ? m_peers_white.get<by_time>() : m_peers_gray.get<by_time>();
     for(const peers_indexed::value_type& vl: boost::adaptors::reverse(by_time_index))
       if (!f(vl))
@@ -319,8 +340,6 @@ namespace nodetool
   bool peerlist_manager::set_peer_just_seen(peerid_type peer, const epee::net_utils::network_address& addr, uint32_t pruning_seed, uint16_t rpc_port, uint32_t rpc_credits_per_hash)
   {
     TRY_ENTRY();
-    CRITICAL_REGION_LOCAL(m_peerlist_lock);
-    //find in white list
     peerlist_entry ple;
     ple.adr = addr;
     ple.id = peer;
@@ -339,9 +358,26 @@ namespace nodetool
     if(!is_host_allowed(ple.adr))
       return true;
 
-     CRITICAL_REGION_LOCAL(m_peerlist_lock);
+    // most calls come from handshakes with peers we already know, and change
+    // nothing, so only take the lock exclusively once there is something to do
+    boost::upgrade_lock<boost::shared_mutex> lock(m_peerlist_lock);
     //find in white list
     auto by_addr_it_wt = m_peers_white.get<by_addr>().find(ple.adr);
+    auto by_addr_it_gr = m_peers_gray.get<by_addr>().find(ple.adr);
+    peerlist_entry new_ple = ple;
+    if(by_addr_it_wt != m_peers_white.get<by_addr>().end())
+    {
+      if (by_addr_it_wt->pruning_seed && ple.pruning_seed == 0) // guard against older nodes not passing pruning info around
+        new_ple.pruning_seed = by_addr_it_wt->pruning_seed;
+      if (by_addr_it_wt->rpc_port && ple.rpc_port == 0) // guard against older nodes not passing RPC port around
+        new_ple.rpc_port = by_addr_it_wt->rpc_port;
+      new_ple.last_seen = by_addr_it_wt->last_seen; // do not overwrite the last seen timestamp, incoming peer list are untrusted
+      if (by_addr_it_gr == m_peers_gray.get<by_addr>().end() && new_ple.id == by_addr_it_wt->id && new_ple.pruning_seed == by_addr_it_wt->pruning_seed &&
+          new_ple.rpc_port == by_addr_it_wt->rpc_port && new_ple.rpc_credits_per_hash == by_addr_it_wt->rpc_credits_per_hash)
+        return true;
+    }
+
+    boost::upgrade_to_unique_lock<boost::shared_mutex> write_lock(lock);
     if(by_addr_it_wt == m_peers_white.get<by_addr>().end())
     {
       //put new record into white list
@@ -350,16 +386,9 @@ namespace nodetool
     }else
     {
       //update record in white list
-      peerlist_entry new_ple = ple;
-      if (by_addr_it_wt->pruning_seed && ple.pruning_seed == 0) // guard against older nodes not passing pruning info around
-        new_ple.pruning_seed = by_addr_it_wt->pruning_seed;
-      if (by_addr_it_wt->rpc_port && ple.rpc_port == 0) // guard against older nodes not passing RPC port around
-        new_ple.rpc_port = by_addr_it_wt->rpc_port;
-      new_ple.last_seen = by_addr_it_wt->last_seen; // do not overwrite the last seen timestamp, incoming peer list are untrusted
       m_peers_white.replace(by_addr_it_wt, new_ple);
     }
     //remove from gray list, if need
-    auto by_addr_it_gr = m_peers_gray.get<by_addr>().find(ple.adr);
     if(by_addr_it_gr != m_peers_gray.get<by_addr>().end())
     {
       m_peers_gray.erase(by_addr_it_gr);
@@ -375,11 +404,20 @@ namespace nodetool
     if(!is_host_allowed(ple.adr))
       return true;
 
-    CRITICAL_REGION_LOCAL(m_peerlist_lock);
+    boost::unique_lock<boost::shared_mutex> lock(m_peerlist_lock);
+    add_peer_gray(ple);
+    return true;
+    CATCH_ENTRY_L0("peerlist_manager::append_with_peer_gray()", false);
+  }
+  //--------------------------------------------------------------------------------------------------
+  inline
+  void peerlist_manager::add_peer_gray(const peerlist_entry& ple)
+  {
+    // m_peerlist_lock must be held exclusively
     //find in white list
     auto by_addr_it_wt = m_peers_white.get<by_addr>().find(ple.adr);
     if(by_addr_it_wt != m_peers_white.get<by_addr>().end())
-      return true;
+      return;
 
     //update gray list
     auto by_addr_it_gr = m_peers_gray.get<by_addr>().find(ple.adr);
@@ -399,8 +437,6 @@ namespace nodetool
       new_ple.last_seen = by_addr_it_gr->last_seen; // do not overwrite the last seen timestamp, incoming peer list are untrusted
       m_peers_gray.replace(by_addr_it_gr, new_ple);
     }
-    return true;
-    CATCH_ENTRY_L0("peerlist_manager::append_with_peer_gray()", false);
   }
   //--------------------------------------------------------------------------------------------------
   inline
@@ -408,7 +444,7 @@ namespace nodetool
   {
     TRY_ENTRY();
 
-    CRITICAL_REGION_LOCAL(m_peerlist_lock);
+    boost::unique_lock<boost::shared_mutex> lock(m_peerlist_lock);
 
     auto by_addr_it_anchor = m_peers_anchor.get<by_addr>().find(ple.adr);
 
@@ -426,7 +462,7 @@ namespace nodetool
   {
     TRY_ENTRY();
 
-    CRITICAL_REGION_LOCAL(m_peerlist_lock);
+    boost::shared_lock<boost::shared_mutex> lock(m_peerlist_lock);
 
     if (m_peers_gray.empty()) {
       return false;
@@ -434,8 +470,7 @@ namespace nodetool
 
     size_t random_index = crypto::rand_idx(m_peers_gray.size());
 
-    peers_indexed::index<by_time>::type& by_time_index = m_peers_gray.get<by_time>();
-    pe = *epee::misc_utils::move_it_backward(--by_time_index.end(), random_index);
+    pe = m_peers_gray.get<by_random>()[random_index];
 
     return true;
 
@@ -447,7 +482,7 @@ namespace nodetool
   {
     TRY_ENTRY();
 
-    CRITICAL_REGION_LOCAL(m_peerlist_lock);
+    boost::unique_lock<boost::shared_mutex> lock(m_peerlist_lock);
 
     peers_indexed::index_iterator<by_addr>::type iterator = m_peers_white.get<by_addr>().find(pe.adr);
 
@@ -465,7 +500,7 @@ namespace nodetool
   {
     TRY_ENTRY();
 
-    CRITICAL_REGION_LOCAL(m_peerlist_lock);
+    boost::unique_lock<boost::shared_mutex> lock(m_peerlist_lock);
 
     peers_indexed::index_iterator<by_addr>::type iterator = m_peers_gray.get<by_addr>().find(pe.adr);
 
@@ -483,7 +518,7 @@ namespace nodetool
   {
     TRY_ENTRY();
 
-    CRITICAL_REGION_LOCAL(m_peerlist_lock);
+    boost::unique_lock<boost::shared_mutex> lock(m_peerlist_lock);
 
     auto begin = m_peers_anchor.get<by_time>().begin();
     auto end = m_peers_anchor.get<by_time>().end();
@@ -504,7 +539,7 @@ namespace nodetool
   {
     TRY_ENTRY();
 
-    CRITICAL_REGION_LOCAL(m_peerlist_lock);
+    boost::unique_lock<boost::shared_mutex> lock(m_peerlist_lock);
 
     anchor_peers_indexed::index_iterator<by_addr>::type iterator = m_peers_anchor.get<by_addr>().find(addr);
 
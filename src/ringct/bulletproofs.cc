@@ -35,6 +35,7 @@
 #include "misc_log_ex.h"
 #include "span.h"
 #include "common/perf_timer.h"
+#include "common/threadpool.h"
 #include "cryptonote_config.h"
 extern "C"
 {
@@ -60,6 +61,9 @@ extern "C"
 #define STRAUS_SIZE_LIMIT 232
 #define PIPPENGER_SIZE_LIMIT 0
 
+// below this many points per multiexp, running two of them side by side costs more than it saves
+#define PROVE_PARALLEL_MIN_SIZE 32
+
 namespace rct
 {
 
@@ -188,6 +192,35 @@ static rct::key cross_vector_exponent8(size_t size, const std::vector<ge_p3> &A,
   return multiexp(multiexp_data, 0);
 }
 
+/* Run two independent prover steps, one of them on the threadpool */
+static void run_pair(size_t size, const std::function<void()> &f0, const std::function<void()> &f1)
+{
+  tools::threadpool &tpool = tools::threadpool::getInstance();
+  if (size < PROVE_PARALLEL_MIN_SIZE || tpool.get_max_concurrency() < 2)
+  {
+    f0();
+    f1();
+    return;
+  }
+
+  // not a leaf: the multiexp may itself go to the threadpool
+  std::exception_ptr error;
+  tools::threadpool::waiter waiter;
+  tpool.submit(&waiter, [&f1, &error] {
+    try { f1(); }
+    catch (...) { error = std::current_exception(); }
+  });
+  try { f0(); }
+  catch (...)
+  {
+    waiter.wait(&tpool);
+    throw;
+  }
+  waiter.wait(&tpool);
+  if (error)
+    std::rethrow_exception(error);
+}
+
 /* Given a scalar, construct a vector of powers */
 static rct::keyV vector_powers(const rct::key &x, size_t n)
 {
@@ -568,19 +601,21 @@ try_again:
   rct::key hash_cache = rct::hash_to_scalar(V);
 
   PERF_TIMER_START_BP(PROVE_step1);
-  // PAPER LINES 43-44
+  // PAPER LINES 43-47: A and S are independent multiexps, computed together
   rct::key alpha = rct::skGen();
-  rct::key ve = vector_exponent(aL8, aR8);
+  rct::keyV sL = rct::skvGen(MN), sR = rct::skvGen(MN);
+  rct::key rho = rct::skGen();
+  rct::key ve, veS;
+  run_pair(2 * MN,
+    [&] { ve = vector_exponent(aL8, aR8); },
+    [&] { veS = vector_exponent(sL, sR); });
   rct::key A;
   sc_mul(tmp.bytes, alpha.bytes, INV_EIGHT.bytes);
   rct::addKeys(A, ve, rct::scalarmultBase(tmp));
 
   // PAPER LINES 45-47
-  rct::keyV sL = rct::skvGen(MN), sR = rct::skvGen(MN);
-  rct::key rho = rct::skGen();
-  ve = vector_exponent(sL, sR);
   rct::key S;
-  rct::addKeys(S, ve, rct::scalarmultBase(rho));
+  rct::addKeys(S, veS, rct::scalarmultBase(rho));
   S = rct::scalarmultKey(S, INV_EIGHT);
 
   // PAPER LINES 48-50
@@ -737,10 +772,12 @@ try_again:
 
     // PAPER LINES 23-24
     PERF_TIMER_START_BP(PROVE_LR);
-    sc_mul(tmp.bytes, cL.bytes, x_ip.bytes);
-    L[round] = cross_vector_exponent8(nprime, Gprime, nprime, Hprime, 0, aprime, 0, bprime, nprime, scale, &ge_p3_H, &tmp);
-    sc_mul(tmp.bytes, cR.bytes, x_ip.bytes);
-    R[round] = cross_vector_exponent8(nprime, Gprime, 0, Hprime, nprime, aprime, nprime, bprime, 0, scale, &ge_p3_H, &tmp);
+    rct::key tmpL, tmpR;
+    sc_mul(tmpL.bytes, cL.bytes, x_ip.bytes);
+    sc_mul(tmpR.bytes, cR.bytes, x_ip.bytes);
+    run_pair(2 * nprime,
+      [&] { L[round] = cross_vector_exponent8(nprime, Gprime, nprime, Hprime, 0, aprime, 0, bprime, nprime, scale, &ge_p3_H, &tmpL); },
+      [&] { R[round] = cross_vector_exponent8(nprime, Gprime, 0, Hprime, nprime, aprime, nprime, bprime, 0, scale, &ge_p3_H, &tmpR); });
     PERF_TIMER_STOP_BP(PROVE_LR);
 
     // PAPER LINES 25-27
@@ -30,6 +30,7 @@
 
 #include "misc_log_ex.h"
 #include "common/perf_timer.h"
+#include "common/threadpool.h"
 extern "C"
 {
 #include "crypto/crypto-ops.h"
@@ -142,9 +143,7 @@ static inline int test(const rct::key &k, size_t n)
 
 static inline void add(ge_p3 &p3, const ge_cached &other)
 {
-  ge_p1p1 p1;
-  ge_add(&p1, &p3, &other);
-  ge_p1p1_to_p3(&p3, &p1);
+  ge_p3_add_cached(&p3, &p3, &other);
 }
 
 static inline void add(ge_p3 &p3, const ge_p3 &other)
@@ -187,9 +186,7 @@ rct::key bos_coster_heap_conv(std::vector<MultiexpData> data)
     MULTIEXP_PERF(PERF_TIMER_RESUME(add));
     ge_cached cached;
     ge_p3_to_cached(&cached, &data[index1].point);
-    ge_p1p1 p1;
-    ge_add(&p1, &data[index2].point, &cached);
-    ge_p1p1_to_p3(&data[index2].point, &p1);
+    add(data[index2].point, cached);
     MULTIEXP_PERF(PERF_TIMER_PAUSE(add));
 
     MULTIEXP_PERF(PERF_TIMER_RESUME(sub));
@@ -276,8 +273,6 @@ rct::key bos_coster_heap_conv_robust(std::vector<MultiexpData> data)
     MULTIEXP_PERF(PERF_TIMER_PAUSE(pop));
 
     ge_cached cached;
-    ge_p1p1 p1;
-    ge_p2 p2;
 
     MULTIEXP_PERF(PERF_TIMER_RESUME(div));
     while (1)
@@ -294,16 +289,13 @@ rct::key bos_coster_heap_conv_robust(std::vector<MultiexpData> data)
         std::push_heap(heap.begin(), heap.end(), Comp);
       }
       data[index1].scalar = div2(data[index1].scalar);
-      ge_p3_to_p2(&p2, &data[index1].point);
-      ge_p2_dbl(&p1, &p2);
-      ge_p1p1_to_p3(&data[index1].point, &p1);
+      ge_p3_dbl_n(&data[index1].point, &data[index1].point, 1);
     }
     MULTIEXP_PERF(PERF_TIMER_PAUSE(div));
 
     MULTIEXP_PERF(PERF_TIMER_RESUME(add));
     ge_p3_to_cached(&cached, &data[index1].point);
-    ge_add(&p1, &data[index2].point, &cached);
-    ge_p1p1_to_p3(&data[index2].point, &p1);
+    add(data[index2].point, cached);
     MULTIEXP_PERF(PERF_TIMER_PAUSE(add));
 
     MULTIEXP_PERF(PERF_TIMER_RESUME(sub));
@@ -372,8 +364,6 @@ std::shared_ptr<straus_cached_data> straus_init_cache(const std::vector<Multiexp
   if (N == 0)
     N = data.size();
   CHECK_AND_ASSERT_THROW_MES(N <= data.size(), "Bad cache base data");
-  ge_cached cached;
-  ge_p1p1 p1;
   ge_p3 p3;
   std::shared_ptr<straus_cached_data> cache(new straus_cached_data());
 
@@ -387,8 +377,7 @@ std::shared_ptr<straus_cached_data> straus_init_cache(const std::vector<Multiexp
     ge_p3_to_cached(&CACHE_OFFSET(cache, j, 1), &data[j].point);
     for (size_t i=2;i<1<<STRAUS_C;++i)
     {
-      ge_add(&p1, &data[j].point, &CACHE_OFFSET(cache, j, i-1));
-      ge_p1p1_to_p3(&p3, &p1);
+      ge_p3_add_cached(&p3, &data[j].point, &CACHE_OFFSET(cache, j, i-1));
       ge_p3_to_cached(&CACHE_OFFSET(cache, j, i), &p3);
     }
   }
@@ -402,8 +391,7 @@ std::shared_ptr<straus_cached_data> straus_init_cache(const std::vector<Multiexp
     ge_p3_to_cached(&cache->multiples[i][0], &data[i].point);
     for (size_t j=2;j<1<<STRAUS_C;++j)
     {
-      ge_add(&p1, &data[i].point, &cache->multiples[i][j-2]);
-      ge_p1p1_to_p3(&p3, &p1);
+      ge_p3_add_cached(&p3, &data[i].point, &cache->multiples[i][j-2]);
       ge_p3_to_cached(&cache->multiples[i][j-1], &p3);
     }
   }
@@ -419,8 +407,7 @@ std::shared_ptr<straus_cached_data> straus_init_cache(const std::vector<Multiexp
   {
     for (size_t i=2;i<1<<STRAUS_C;++i)
     {
-      ge_add(&p1, &data[j].point, &cache->multiples[i-1][j]);
-      ge_p1p1_to_p3(&p3, &p1);
+      ge_p3_add_cached(&p3, &data[j].point, &cache->multiples[i-1][j]);
       ge_p3_to_cached(&cache->multiples[i][j], &p3);
     }
   }
@@ -452,8 +439,6 @@ rct::key straus(const std::vector<MultiexpData> &data, const std::shared_ptr<str
   MULTIEXP_PERF(PERF_TIMER_START_UNIT(setup, 1000000));
   static constexpr unsigned int mask = (1<<STRAUS_C)-1;
   std::shared_ptr<straus_cached_data> local_cache = cache == NULL ? straus_init_cache(data) : cache;
-  ge_cached cached;
-  ge_p1p1 p1;
   ge_p3 p3;
 
 #ifdef TRACK_STRAUS_ZERO_IDENTITY
@@ -519,16 +504,7 @@ rct::key straus(const std::vector<MultiexpData> &data, const std::shared_ptr<str
       goto skipfirst;
     while (!(i < STRAUS_C))
     {
-      ge_p2 p2;
-      ge_p3_to_p2(&p2, &band_p3);
-      for (size_t j = 0; j < STRAUS_C; ++j)
-      {
-        ge_p2_dbl(&p1, &p2);
-        if (j == STRAUS_C - 1)
-          ge_p1p1_to_p3(&band_p3, &p1);
-        else
-          ge_p1p1_to_p2(&p2, &p1);
-      }
+      ge_p3_dbl_n(&band_p3, &band_p3, STRAUS_C);
 skipfirst:
       i -= STRAUS_C;
       for (size_t j = start_offset; j < start_offset + num_points; ++j)
@@ -543,16 +519,11 @@ skipfirst:
         const uint8_t digit = digits[j*256+i];
 #endif
         if (digit)
-        {
-          ge_add(&p1, &band_p3, &CACHE_OFFSET(local_cache, j, digit));
-          ge_p1p1_to_p3(&band_p3, &p1);
-        }
+          add(band_p3, CACHE_OFFSET(local_cache, j, digit));
       }
     }
 
-    ge_p3_to_cached(&cached, &band_p3);
-    ge_add(&p1, &res_p3, &cached);
-    ge_p1p1_to_p3(&res_p3, &p1);
+    add(res_p3, band_p3);
   }
 
   rct::key res;
@@ -605,7 +576,71 @@ size_t pippenger_get_cache_size(const std::shared_ptr<pippenger_cached_data> &ca
   return cache->size * sizeof(*cache->cached);
 }
 
-rct::key pippenger(const std::vector<MultiexpData> &data, const std::shared_ptr<pippenger_cached_data> &cache, size_t cache_size, size_t c)
+static void pippenger_double(ge_p3 &result, size_t c)
+{
+  ge_p3_dbl_n(&result, &result, c);
+}
+
+// adds the sum of the terms' k-th c bit windows to result
+static void pippenger_window(ge_p3 &result, bool &result_init, ge_p3 *buckets, const std::vector<MultiexpData> &data,
+    const pippenger_cached_data &cache, size_t cache_size, const pippenger_cached_data *cache_2, size_t k, size_t c)
+{
+  bool buckets_init[1<<9];
+  memset(buckets_init, 0, 1u<<c);
+
+  // partition scalars into buckets
+  for (size_t i = 0; i < data.size(); ++i)
+  {
+    unsigned int bucket = 0;
+    for (size_t j = 0; j < c; ++j)
+      if (test(data[i].scalar, k*c+j))
+        bucket |= 1<<j;
+    if (bucket == 0)
+      continue;
+    CHECK_AND_ASSERT_THROW_MES(bucket < (1u<<c), "bucket overflow");
+    if (buckets_init[bucket])
+    {
+      if (i < cache_size)
+        add(buckets[bucket], cache.cached[i]);
+      else
+        add(buckets[bucket], cache_2->cached[i - cache_size]);
+    }
+    else
+    {
+      buckets[bucket] = data[i].point;
+      buckets_init[bucket] = true;
+    }
+  }
+
+  // sum the buckets
+  ge_p3 pail;
+  bool pail_init = false;
+  for (size_t i = (1<<c)-1; i > 0; --i)
+  {
+    if (buckets_init[i])
+    {
+      if (pail_init)
+        add(pail, buckets[i]);
+      else
+      {
+        pail = buckets[i];
+        pail_init = true;
+      }
+    }
+    if (pail_init)
+    {
+      if (result_init)
+        add(result, pail);
+      else
+      {
+        result = pail;
+        result_init = true;
+      }
+    }
+  }
+}
+
+rct::key pippenger(const std::vector<MultiexpData> &data, const std::shared_ptr<pippenger_cached_data> &cache, size_t cache_size, size_t c, size_t threads)
 {
   if (cache != NULL && cache_size == 0)
     cache_size = cache->size;
@@ -616,8 +651,6 @@ rct::key pippenger(const std::vector<MultiexpData> &data, const std::shared_ptr<
 
   ge_p3 result = ge_p3_identity;
   bool result_init = false;
-  std::unique_ptr<ge_p3[]> buckets{new ge_p3[1<<c]};
-  bool buckets_init[1<<9];
   std::shared_ptr<pippenger_cached_data> local_cache = cache == NULL ? pippenger_init_cache(data) : cache;
   std::shared_ptr<pippenger_cached_data> local_cache_2 = data.size() > cache_size ? pippenger_init_cache(data, cache_size) : NULL;
 
@@ -632,72 +665,49 @@ rct::key pippenger(const std::vector<MultiexpData> &data, const std::shared_ptr<
     ++groups;
   groups = (groups + c - 1) / c;
 
-  for (size_t k = groups; k-- > 0; )
+  tools::threadpool &tpool = tools::threadpool::getInstance();
+  if (threads == 0)
+    threads = data.size() >= PIPPENGER_MT_MIN_SIZE ? tpool.get_max_concurrency() : 1;
+  threads = std::min(threads, groups);
+
+  if (threads <= 1)
   {
-    if (result_init)
+    std::unique_ptr<ge_p3[]> buckets{new ge_p3[1<<c]};
+    for (size_t k = groups; k-- > 0; )
     {
-      ge_p2 p2;
-      ge_p3_to_p2(&p2, &result);
-      for (size_t i = 0; i < c; ++i)
-      {
-        ge_p1p1 p1;
-        ge_p2_dbl(&p1, &p2);
-        if (i == c - 1)
-          ge_p1p1_to_p3(&result, &p1);
-        else
-          ge_p1p1_to_p2(&p2, &p1);
-      }
+      if (result_init)
+        pippenger_double(result, c);
+      pippenger_window(result, result_init, buckets.get(), data, *local_cache, cache_size, local_cache_2.get(), k, c);
     }
-    memset(buckets_init, 0, 1u<<c);
-
-    // partition scalars into buckets
-    for (size_t i = 0; i < data.size(); ++i)
+  }
+  else
+  {
+    // windows are independent until the final doublings, so each thread sums every threads-th one
+    std::unique_ptr<ge_p3[]> windows{new ge_p3[groups]};
+    std::unique_ptr<bool[]> windows_init{new bool[groups]()};
+    tools::threadpool::waiter waiter;
+    for (size_t t = 0; t < threads; ++t)
     {
-      unsigned int bucket = 0;
-      for (size_t j = 0; j < c; ++j)
-        if (test(data[i].scalar, k*c+j))
-          bucket |= 1<<j;
-      if (bucket == 0)
-        continue;
-      CHECK_AND_ASSERT_THROW_MES(bucket < (1u<<c), "bucket overflow");
-      if (buckets_init[bucket])
-      {
-        if (i < cache_size)
-          add(buckets[bucket], local_cache->cached[i]);
-        else
-          add(buckets[bucket], local_cache_2->cached[i - cache_size]);
-      }
-      else
-      {
-        buckets[bucket] = data[i].point;
-        buckets_init[bucket] = true;
-      }
+      tpool.submit(&waiter, [&, t](){
+        std::unique_ptr<ge_p3[]> buckets{new ge_p3[1<<c]};
+        for (size_t k = t; k < groups; k += threads)
+          pippenger_window(windows[k], windows_init[k], buckets.get(), data, *local_cache, cache_size, local_cache_2.get(), k, c);
+      }, true);
     }
+    waiter.wait(&tpool);
 
-    // sum the buckets
-    ge_p3 pail;
-    bool pail_init = false;
-    for (size_t i = (1<<c)-1; i > 0; --i)
+    for (size_t k = groups; k-- > 0; )
     {
-      if (buckets_init[i])
-      {
-        if (pail_init)
-          add(pail, buckets[i]);
-        else
-        {
-          pail = buckets[i];
-          pail_init = true;
-        }
-      }
-      if (pail_init)
+      if (result_init)
+        pippenger_double(result, c);
+      if (!windows_init[k])
+        continue;
+      if (result_init)
+        add(result, windows[k]);
+      else
       {
-        if (result_init)
-          add(result, pail);
-        else
-        {
-          result = pail;
-          result_init = true;
-        }
+        result = windows[k];
+        result_init = true;
       }
     }
   }
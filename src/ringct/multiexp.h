@@ -38,6 +38,8 @@
 #include "rctTypes.h"
 #include "misc_log_ex.h"
 
+#define PIPPENGER_MT_MIN_SIZE 512
+
 namespace rct
 {
 
@@ -64,7 +66,9 @@ rct::key straus(const std::vector<MultiexpData> &data, const std::shared_ptr<str
 std::shared_ptr<pippenger_cached_data> pippenger_init_cache(const std::vector<MultiexpData> &data, size_t start_offset = 0, size_t N =0);
 size_t pippenger_get_cache_size(const std::shared_ptr<pippenger_cached_data> &cache);
 size_t get_pippenger_c(size_t N);
-rct::key pippenger(const std::vector<MultiexpData> &data, const std::shared_ptr<pippenger_cached_data> &cache = NULL, size_t cache_size = 0, size_t c = 0);
+// threads: windows are split over that many threadpool jobs; 0 picks the pool's
+// concurrency from PIPPENGER_MT_MIN_SIZE points up, and a single thread below that
+rct::key pippenger(const std::vector<MultiexpData> &data, const std::shared_ptr<pippenger_cached_data> &cache = NULL, size_t cache_size = 0, size_t c = 0, size_t threads = 0);
 
 }
 
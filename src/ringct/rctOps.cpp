@@ -30,6 +30,7 @@
 
 #include <boost/lexical_cast.hpp>
 #include "misc_log_ex.h"
+#include "common/threadpool.h"
 #include "cryptonote_basic/cryptonote_format_utils.h"
 #include "rctOps.h"
 using namespace crypto;
@@ -242,11 +243,7 @@ namespace rct {
     {
         if (ge_frombytes_vartime(P, data))
             return false;
-        ge_p2 R;
-        ge_scalarmult(&R, curveOrder().bytes, P);
-        key tmp;
-        ge_tobytes(tmp.bytes, &R);
-        return tmp == identity();
+        return ge_p3_is_torsion_free_vartime(P);
     }
 
     //generates a random scalar which can be used as a secret key or mask
@@ -295,7 +292,7 @@ namespace rct {
 
     //generates C =aG + bH from b, a is given..
     void genC(key & C, const key & a, xmr_amount amount) {
-        addKeys2(C, a, d2h(amount), rct::H);
+        addKeysGH(C, a, d2h(amount));
     }
 
     //generates a <secret , public> / Pedersen commitment to the amount
@@ -387,10 +384,11 @@ namespace rct {
 
     //Computes aH where H= toPoint(cn_fast_hash(G)), G the basepoint
     key scalarmultH(const key & a) {
-        ge_p2 R;
-        ge_scalarmult(&R, a.bytes, &ge_p3_H);
+        ge_p3 R;
         key aP;
-        ge_tobytes(aP.bytes, &R);
+        sc_reduce32copy(aP.bytes, a.bytes); //H is in the main subgroup, so aH is unchanged
+        ge_scalarmult_H(&R, aP.bytes);
+        ge_p3_tobytes(aP.bytes, &R);
         return aP;
     }
 
@@ -426,6 +424,34 @@ namespace rct {
         return toPointCheckOrder(&p3, A.bytes);
     }
 
+    //Checks a set of points, eg all key images of a block, spread over the threadpool
+    bool isInMainSubgroup(const keyV & points, std::vector<bool> & valid) {
+        std::vector<uint8_t> ok(points.size(), 0);
+        const auto check = [&points, &ok](size_t begin, size_t end) {
+            ge_p3 p3;
+            for (size_t i = begin; i < end; ++i)
+                ok[i] = toPointCheckOrder(&p3, points[i].bytes);
+        };
+
+        tools::threadpool &tpool = tools::threadpool::getInstance();
+        const size_t threads = points.size() < SUBGROUP_CHECK_MT_MIN_SIZE ? 1 : std::min<size_t>(tpool.get_max_concurrency(), points.size());
+        if (threads > 1)
+        {
+            tools::threadpool::waiter waiter;
+            const size_t chunk = (points.size() + threads - 1) / threads;
+            for (size_t begin = 0; begin < points.size(); begin += chunk)
+                tpool.submit(&waiter, [&check, begin, chunk, &points]() { check(begin, std::min(begin + chunk, points.size())); }, true);
+            waiter.wait(&tpool);
+        }
+        else
+        {
+            check(0, points.size());
+        }
+
+        valid.assign(ok.begin(), ok.end());
+        return std::find(ok.begin(), ok.end(), 0) == ok.end();
+    }
+
     //Curve addition / subtractions
 
     //for curve points: AB = A + B
@@ -483,6 +509,23 @@ namespace rct {
         ge_tobytes(aGbB.bytes, &rv);
     }
 
+    //aGbH = aG + bH where a, b are scalars, G is the basepoint and H = toPoint(cn_fast_hash(G))
+    void addKeysGH(key &aGbH, const key &a, const key &b) {
+        ge_p3 A, B;
+        ge_cached B2;
+        ge_p1p1 R;
+        ge_p2 P;
+        key s;
+        sc_reduce32copy(s.bytes, a.bytes);
+        ge_scalarmult_base(&A, s.bytes);
+        sc_reduce32copy(s.bytes, b.bytes);
+        ge_scalarmult_H(&B, s.bytes);
+        ge_p3_to_cached(&B2, &B);
+        ge_add(&R, &A, &B2);
+        ge_p1p1_to_p2(&P, &R);
+        ge_tobytes(aGbH.bytes, &P);
+    }
+
     //Does some precomputation to make addKeys3 more efficient
     // input B a curve point and output a ge_dsmp which has precomputation applied
     void precomp(ge_dsmp rv, const key & B) {
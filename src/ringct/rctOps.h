@@ -55,6 +55,9 @@ extern "C" {
 #define DP(x)
 #endif
 
+// point sets at least this large are checked for torsion on the threadpool
+#define SUBGROUP_CHECK_MT_MIN_SIZE 16
+
 namespace rct {
 
     //Various key initialization functions
@@ -127,6 +130,8 @@ namespace rct {
     void scalarmult8(ge_p3 &res, const key & P);
     // checks a is in the main subgroup (ie, not a small one)
     bool isInMainSubgroup(const key & a);
+    // same for each point, valid[i] is set per point; returns true if all are
+    bool isInMainSubgroup(const keyV & points, std::vector<bool> & valid);
 
     //Curve addition / subtractions
 
@@ -138,6 +143,9 @@ namespace rct {
     void addKeys1(key &aGB, const key &a, const key & B);
     //aGbB = aG + bB where a, b are scalars, G is the basepoint and B is a point
     void addKeys2(key &aGbB, const key &a, const key &b, const key &B);
+    //aGbH = aG + bH where a, b are scalars, G is the basepoint and H = toPoint(cn_fast_hash(G))
+    //uses the fixed base tables for both, see ge_scalarmult_H
+    void addKeysGH(key &aGbH, const key &a, const key &b);
     //Does some precomputation to make addKeys3 more efficient
     // input B a curve point and output a ge_dsmp which has precomputation applied
     void precomp(ge_dsmp rv, const key &B);
@@ -35,6 +35,7 @@
 #include "common/util.h"
 #include "rctSigs.h"
 #include "bulletproofs.h"
+#include "ring_member_cache.h"
 #include "cryptonote_basic/cryptonote_format_utils.h"
 #include "cryptonote_config.h"
 #include <boost/multiprecision/cpp_int.hpp>
@@ -75,7 +76,7 @@ namespace
       sv.bytes[6] = (outamounts[i] >> 48) & 255;
       sv.bytes[7] = (outamounts[i] >> 56) & 255;
       sc_mul(sv8.bytes, sv.bytes, rct::INV_EIGHT.bytes);
-      rct::addKeys2(C[i], rct::INV_EIGHT, sv8, rct::H);
+      rct::addKeysGH(C[i], rct::INV_EIGHT, sv8);
     }
 
     return rct::Bulletproof{rct::keyV(n_outs, I), I, I, I, I, I, I, rct::keyV(nrl, I), rct::keyV(nrl, I), I, I, I};
@@ -715,35 +716,30 @@ namespace rct {
       key c_new;
       key L;
       key R;
-      geDsmp P_precomp;
       geDsmp C_precomp;
-      geDsmp H_precomp;
       size_t i = 0;
-      ge_p3 hash8_p3;
-      geDsmp hash_precomp;
       ge_p3 temp_p3;
       ge_p1p1 temp_p1;
+      ring_member_cache &member_cache = ring_member_cache::getInstance();
 
       while (i < n) {
         sc_0(c_new.bytes);
         sc_mul(c_p.bytes,mu_P.bytes,c.bytes);
         sc_mul(c_c.bytes,mu_C.bytes,c.bytes);
 
-        // Precompute points for L/R
-        precomp(P_precomp.k,pubs[i].dest);
+        // Precompute points for L/R; those depending only on the ring member are shared across signatures
+        const std::shared_ptr<const ring_member_precomp> member = member_cache.get(pubs[i]);
+        CHECK_AND_ASSERT_MES(member, false, "point conv failed");
 
-        CHECK_AND_ASSERT_MES(ge_frombytes_vartime(&temp_p3, pubs[i].mask.bytes) == 0, false, "point conv failed");
-        ge_sub(&temp_p1,&temp_p3,&C_offset_cached);
+        ge_sub(&temp_p1,&member->C,&C_offset_cached);
         ge_p1p1_to_p3(&temp_p3,&temp_p1);
         ge_dsm_precomp(C_precomp.k,&temp_p3);
 
         // Compute L
-        addKeys_aGbBcC(L,sig.s[i],c_p,P_precomp.k,c_c,C_precomp.k);
+        addKeys_aGbBcC(L,sig.s[i],c_p,member->P,c_c,C_precomp.k);
 
         // Compute R
-        hash_to_p3(hash8_p3,pubs[i].dest);
-        ge_dsm_precomp(hash_precomp.k, &hash8_p3);
-        addKeys_aAbBcC(R,sig.s[i],hash_precomp.k,c_p,I_precomp.k,c_c,D_precomp.k);
+        addKeys_aAbBcC(R,sig.s[i],member->Hp,c_p,I_precomp.k,c_c,D_precomp.k);
 
         c_to_hash[2*n+3] = L;
         c_to_hash[2*n+4] = R;
@@ -1220,9 +1216,37 @@ namespace rct {
     }
 
     // do a CLSAG signing for each input
-    for (i = 0 ; i < inamounts.size(); i++)
+    // inputs are independent, so the software device signs them on the threadpool;
+    // hardware devices keep a single session and stay serial
+    if (hwdev.get_type() == hw::device::SOFTWARE && inamounts.size() > 1)
     {
-      rv.p.CLSAGs[i] = proveRctCLSAGSimple(full_message, rv.mixRing[i], inSk[i], a[i], pseudoOuts[i], kLRki ? &(*kLRki)[i]: NULL, msout ? &msout->c[i] : NULL, msout ? &msout->mu_p[i] : NULL, index[i], hwdev);
+      tools::threadpool& tpool = tools::threadpool::getInstance();
+      tools::threadpool::waiter waiter;
+      std::vector<std::exception_ptr> errors(inamounts.size());
+      for (i = 0 ; i < inamounts.size(); i++)
+      {
+        tpool.submit(&waiter, [&, i] {
+          try
+          {
+            rv.p.CLSAGs[i] = proveRctCLSAGSimple(full_message, rv.mixRing[i], inSk[i], a[i], pseudoOuts[i], kLRki ? &(*kLRki)[i]: NULL, msout ? &msout->c[i] : NULL, msout ? &msout->mu_p[i] : NULL, index[i], hwdev);
+          }
+          catch (...)
+          {
+            errors[i] = std::current_exception();
+          }
+        }, true);
+      }
+      waiter.wait(&tpool);
+      for (const std::exception_ptr &e: errors)
+        if (e)
+          std::rethrow_exception(e);
+    }
+    else
+    {
+      for (i = 0 ; i < inamounts.size(); i++)
+      {
+        rv.p.CLSAGs[i] = proveRctCLSAGSimple(full_message, rv.mixRing[i], inSk[i], a[i], pseudoOuts[i], kLRki ? &(*kLRki)[i]: NULL, msout ? &msout->c[i] : NULL, msout ? &msout->mu_p[i] : NULL, index[i], hwdev);
+      }
     }
 
     return rv;
@@ -1374,7 +1398,8 @@ namespace rct {
     const std::vector<cryptonote::txin_v> &vin,
     const uint8_t version,
     const std::vector<uint32_t>& collateral_indices,
-    const uint64_t amount_collateral
+    const uint64_t amount_collateral,
+    bool range_proofs_verified
   ){
 
     try
@@ -1641,7 +1666,7 @@ namespace rct {
       for (size_t i = 0; i < rv.p.bulletproofs.size(); i++)
         proofs.push_back(&rv.p.bulletproofs[i]);
     
-      if (!proofs.empty() && !verBulletproof(proofs))
+      if (!range_proofs_verified && !proofs.empty() && !verBulletproof(proofs))
       {
         LOG_PRINT_L1("Aggregate range proof verified failed");
         return false;
@@ -1678,7 +1703,8 @@ namespace rct {
     const offshore::pricing_record& pr, 
     const cryptonote::transaction_type& type,
     const std::string& strSource, 
-    const std::string& strDest
+    const std::string& strDest,
+    bool range_proofs_verified
   ){
 
     try
@@ -1876,7 +1902,7 @@ namespace rct {
         offset += rv.p.rangeSigs.size();
       }
     
-      if (!proofs.empty() && !verBulletproof(proofs))
+      if (!range_proofs_verified && !proofs.empty() && !verBulletproof(proofs))
       {
         LOG_PRINT_L1("Aggregate range proof verified failed");
         return false;
@@ -1993,7 +2019,7 @@ namespace rct {
     key Ctmp;
     CHECK_AND_ASSERT_THROW_MES(sc_check(mask.bytes) == 0, "warning, bad ECDH mask");
     CHECK_AND_ASSERT_THROW_MES(sc_check(amount.bytes) == 0, "warning, bad ECDH amount");
-    addKeys2(Ctmp, mask, amount, H);
+    addKeysGH(Ctmp, mask, amount);
     DP("Ctmp");
     DP(Ctmp);
     if (equalKeys(C, Ctmp) == false) {
@@ -2031,7 +2057,7 @@ namespace rct {
     key Ctmp;
     CHECK_AND_ASSERT_THROW_MES(sc_check(mask.bytes) == 0, "warning, bad ECDH mask");
     CHECK_AND_ASSERT_THROW_MES(sc_check(amount.bytes) == 0, "warning, bad ECDH amount");
-    addKeys2(Ctmp, mask, amount, H);
+    addKeysGH(Ctmp, mask, amount);
     DP("Ctmp");
     DP(Ctmp);
     if (equalKeys(C, Ctmp) == false) {
@@ -91,6 +91,9 @@ namespace rct {
   //   mask is a such that C = aG + bH, and b = amount
   //verRange verifies that \sum Ci = C and that each Ci is a commitment to 0 or 2^i
   bool verRange(const key & C, const rangeSig & as);
+  //verBulletproof verifies aggregate range proofs, batched when given several
+  bool verBulletproof(const Bulletproof &proof);
+  bool verBulletproof(const std::vector<const Bulletproof*> &proofs);
 
   //Ring-ct MG sigs
   //Prove:
@@ -125,8 +128,8 @@ namespace rct {
   rctSig genRctSimple(const key & message, const ctkeyV & inSk, const keyV & destinations, const std::vector<xmr_amount> & inamounts, const std::vector<size_t>& inamounts_col_indices, const uint64_t onshore_col_amount, const std::string in_asset_type, const std::vector<std::pair<std::string,std::pair<xmr_amount,bool>>> & outamounts, xmr_amount txnFee, xmr_amount txnOffshoreFee, const ctkeyM & mixRing, const keyV &amount_keys, const std::vector<multisig_kLRki> *kLRki, multisig_out *msout, const std::vector<unsigned int> & index, ctkeyV &outSk, const RCTConfig &rct_config, hw::device &hwdev, const offshore::pricing_record& pr, uint8_t tx_version);
   bool verRct(const rctSig & rv, bool semantics);
   static inline bool verRct(const rctSig & rv) { return verRct(rv, true) && verRct(rv, false); }
-  bool verRctSemanticsSimple2(const rctSig & rv, const offshore::pricing_record& pr, const cryptonote::transaction_type& type, const std::string& strSource, const std::string& strDest, uint64_t amount_burnt, const std::vector<cryptonote::tx_out> &vout, const std::vector<cryptonote::txin_v> &vin, const uint8_t version, const std::vector<uint32_t>& collateral_indices, const uint64_t amount_collateral);
-  bool verRctSemanticsSimple(const rctSig & rv, const offshore::pricing_record& pr, const cryptonote::transaction_type& type, const std::string& strSource, const std::string& strDest);
+  bool verRctSemanticsSimple2(const rctSig & rv, const offshore::pricing_record& pr, const cryptonote::transaction_type& type, const std::string& strSource, const std::string& strDest, uint64_t amount_burnt, const std::vector<cryptonote::tx_out> &vout, const std::vector<cryptonote::txin_v> &vin, const uint8_t version, const std::vector<uint32_t>& collateral_indices, const uint64_t amount_collateral, bool range_proofs_verified = false);
+  bool verRctSemanticsSimple(const rctSig & rv, const offshore::pricing_record& pr, const cryptonote::transaction_type& type, const std::string& strSource, const std::string& strDest, bool range_proofs_verified = false);
   bool verRctNonSemanticsSimple(const rctSig & rv);
   xmr_amount decodeRct(const rctSig & rv, const key & sk, unsigned int i, key & mask, hw::device &hwdev);
   xmr_amount decodeRct(const rctSig & rv, const key & sk, unsigned int i, hw::device &hwdev);
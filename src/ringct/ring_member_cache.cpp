@@ -0,0 +1,143 @@
+// Copyright (c) 2020, The Monero Project
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are
+// permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of
+//    conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list
+//    of conditions and the following disclaimer in the documentation and/or other
+//    materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be
+//    used to endorse or promote products derived from this software without specific
+//    prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL
+// THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "ring_member_cache.h"
+
+#include <boost/thread/locks.hpp>
+#include <algorithm>
+#include <cstring>
+
+#include "rctOps.h"
+
+namespace rct
+{
+    std::size_t ring_member_cache::key_hash::operator()(const key &k) const noexcept
+    {
+        std::size_t h;
+        static_assert(sizeof(h) <= sizeof(k.bytes), "hash too small");
+        std::memcpy(&h, k.bytes + sizeof(k.bytes) - sizeof(h), sizeof(h)); // the first byte picks the shard
+        return h;
+    }
+
+    ring_member_cache::ring_member_cache(const std::size_t max_entries)
+      : max_entries_per_shard_(std::max<std::size_t>(1, max_entries / shard_count)), shards_()
+    {}
+
+    std::shared_ptr<const ring_member_precomp> ring_member_cache::get(const ctkey &member)
+    {
+        shard &s = get_shard(member.dest);
+        {
+            boost::lock_guard<boost::mutex> lock{s.lock};
+            const auto it = s.map.find(member.dest);
+            if (it != s.map.end() && (*it->second)->member.mask == member.mask)
+            {
+                ++s.hits;
+                s.lru.splice(s.lru.begin(), s.lru, it->second);
+                return *it->second;
+            }
+            ++s.misses;
+        }
+
+        // computed without the lock, so a concurrent miss on the same member may do it twice
+        const std::shared_ptr<ring_member_precomp> precomp = std::make_shared<ring_member_precomp>();
+        precomp->member = member;
+        ge_p3 p3;
+        if (ge_frombytes_vartime(&p3, member.dest.bytes) != 0)
+            return nullptr;
+        ge_dsm_precomp(precomp->P, &p3);
+        hash_to_p3(p3, member.dest);
+        ge_dsm_precomp(precomp->Hp, &p3);
+        if (ge_frombytes_vartime(&precomp->C, member.mask.bytes) != 0)
+            return nullptr;
+
+        boost::lock_guard<boost::mutex> lock{s.lock};
+        const auto it = s.map.find(member.dest);
+        if (it != s.map.end())
+        {
+            s.lru.erase(it->second);
+            s.map.erase(it);
+        }
+        while (s.lru.size() >= max_entries_per_shard_)
+        {
+            s.map.erase(s.lru.back()->member.dest);
+            s.lru.pop_back();
+        }
+        s.lru.push_front(precomp);
+        s.map.emplace(member.dest, s.lru.begin());
+        return precomp;
+    }
+
+    void ring_member_cache::clear()
+    {
+        for (shard &s: shards_)
+        {
+            boost::lock_guard<boost::mutex> lock{s.lock};
+            s.map.clear();
+            s.lru.clear();
+        }
+    }
+
+    std::size_t ring_member_cache::size() const
+    {
+        std::size_t n = 0;
+        for (const shard &s: shards_)
+        {
+            boost::lock_guard<boost::mutex> lock{s.lock};
+            n += s.lru.size();
+        }
+        return n;
+    }
+
+    std::uint64_t ring_member_cache::hits() const
+    {
+        std::uint64_t n = 0;
+        for (const shard &s: shards_)
+        {
+            boost::lock_guard<boost::mutex> lock{s.lock};
+            n += s.hits;
+        }
+        return n;
+    }
+
+    std::uint64_t ring_member_cache::misses() const
+    {
+        std::uint64_t n = 0;
+        for (const shard &s: shards_)
+        {
+            boost::lock_guard<boost::mutex> lock{s.lock};
+            n += s.misses;
+        }
+        return n;
+    }
+
+    ring_member_cache &ring_member_cache::getInstance()
+    {
+        static ring_member_cache cache;
+        return cache;
+    }
+}
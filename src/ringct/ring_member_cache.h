@@ -0,0 +1,99 @@
+// Copyright (c) 2020, The Monero Project
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are
+// permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of
+//    conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list
+//    of conditions and the following disclaimer in the documentation and/or other
+//    materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be
+//    used to endorse or promote products derived from this software without specific
+//    prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL
+// THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <boost/thread/mutex.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <unordered_map>
+
+#include "rctTypes.h"
+
+namespace rct
+{
+    //! Ring member points as used by CLSAG verification, decompressed and precomputed
+    struct ring_member_precomp
+    {
+        ctkey member;
+        ge_dsmp P;  //!< dest
+        ge_dsmp Hp; //!< hash_to_p3(dest)
+        ge_p3 C;    //!< mask
+    };
+
+    /*! Bounded cache of ring member precomputations, shared by all verifying threads.
+
+        Recent outputs are picked as decoys by many rings, in a block and across
+        the txpool. Entries are keyed by the member keys themselves, so they stay
+        valid whatever happens to the chain, and popped outputs just age out. */
+    class ring_member_cache
+    {
+    public:
+        static constexpr const std::size_t default_max_entries = 8192; // ~2.8 kB each
+
+        explicit ring_member_cache(std::size_t max_entries = default_max_entries);
+
+        //! \return Precomputations for `member`, or nullptr if one of its keys is not a valid point
+        std::shared_ptr<const ring_member_precomp> get(const ctkey &member);
+
+        void clear();
+        std::size_t size() const;
+        std::uint64_t hits() const;
+        std::uint64_t misses() const;
+
+        //! The cache used by verRctCLSAGSimple
+        static ring_member_cache &getInstance();
+
+    private:
+        struct key_hash
+        {
+            std::size_t operator()(const key &k) const noexcept;
+        };
+
+        typedef std::list<std::shared_ptr<const ring_member_precomp>> lru_list;
+
+        struct shard
+        {
+            mutable boost::mutex lock;
+            lru_list lru; //!< most recently used first
+            std::unordered_map<key, lru_list::iterator, key_hash> map;
+            std::uint64_t hits = 0;
+            std::uint64_t misses = 0;
+        };
+
+        static constexpr const std::size_t shard_count = 16;
+
+        shard &get_shard(const key &dest) noexcept { return shards_[dest.bytes[0] % shard_count]; }
+
+        const std::size_t max_entries_per_shard_;
+        std::array<shard, shard_count> shards_;
+    };
+}
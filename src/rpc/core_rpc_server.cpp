@@ -494,14 +494,20 @@ namespace cryptonote
     RPC_TRACKER(get_net_stats);
     // No bootstrap daemon check: Only ever get stats about local server
     res.start_time = (uint64_t)m_core.get_start_time();
-    {
-      CRITICAL_REGION_LOCAL(epee::net_utils::network_throttle_manager::m_lock_get_global_throttle_in);
-      epee::net_utils::network_throttle_manager::get_global_throttle_in().get_stats(res.total_packets_in, res.total_bytes_in);
-    }
-    {
-      CRITICAL_REGION_LOCAL(epee::net_utils::network_throttle_manager::m_lock_get_global_throttle_out);
-      epee::net_utils::network_throttle_manager::get_global_throttle_out().get_stats(res.total_packets_out, res.total_bytes_out);
-    }
+    using epee::net_utils::network_throttle_manager;
+    using epee::net_utils::traffic_class;
+    const auto to_ms = [](std::chrono::nanoseconds d) { return (uint64_t)std::chrono::duration_cast<std::chrono::milliseconds>(d).count(); };
+    const epee::net_utils::token_bucket &in = network_throttle_manager::get_global_bucket_in();
+    const epee::net_utils::token_bucket &out = network_throttle_manager::get_global_bucket_out();
+    res.total_packets_in = in.get_total_packets();
+    res.total_bytes_in = in.get_total_bytes();
+    res.total_delay_in_ms = to_ms(in.get_total_delay());
+    res.total_packets_out = out.get_total_packets();
+    res.total_bytes_out = out.get_total_bytes();
+    res.total_delay_out_ms = to_ms(out.get_total_delay());
+    res.block_sync_bytes_out = network_throttle_manager::get_class_bucket(traffic_class::block_sync).get_total_bytes();
+    res.tx_relay_bytes_out = network_throttle_manager::get_class_bucket(traffic_class::tx_relay).get_total_bytes();
+    res.rpc_bytes_out = network_throttle_manager::get_class_bucket(traffic_class::rpc).get_total_bytes();
     res.status = CORE_RPC_STATUS_OK;
     return true;
   }
@@ -1312,6 +1318,7 @@ namespace cryptonote
     if ( lMiner.is_mining() ) {
       res.speed = lMiner.get_speed();
       res.threads_count = lMiner.get_threads_count();
+      res.threads_speed = lMiner.get_threads_speed();
       res.block_reward = lMiner.get_block_reward();
     }
     const account_public_address& lMiningAdr = lMiner.get_mining_address();
@@ -2641,6 +2648,55 @@ namespace cryptonote
     return true;    
   }
   //------------------------------------------------------------------------------------------------------------------------------
+  bool core_rpc_server::on_get_conversion_state_bin(const COMMAND_RPC_GET_CONVERSION_STATE::request& req, COMMAND_RPC_GET_CONVERSION_STATE::response& res, const connection_context *ctx)
+  {
+    RPC_TRACKER(get_conversion_state_bin);
+    bool r;
+    if (use_bootstrap_daemon_if_necessary<COMMAND_RPC_GET_CONVERSION_STATE>(invoke_http_mode::BIN, "/get_conversion_state.bin", req, res, r))
+      return r;
+
+    CHECK_PAYMENT_MIN1(req, res, COST_PER_BLOCK_HEADER, false);
+
+    // 0 is placeholder for the top block
+    const uint64_t top_height = m_core.get_current_blockchain_height() - 1;
+    const uint64_t height = req.height ? req.height : top_height;
+    if (height > top_height)
+    {
+      res.status = "Requested height is greater than current top block height";
+      return true;
+    }
+    block blk;
+    if (!m_core.get_block_by_hash(m_core.get_block_id_by_height(height), blk))
+    {
+      res.status = "Error retrieving block information";
+      return true;
+    }
+    res.height = height;
+    res.pricing_record = blk.pricing_record;
+
+    const std::vector<std::pair<std::string, std::string>> amounts = m_core.get_blockchain_storage().get_db().get_circulating_supply();
+    res.supply_tally.reserve(amounts.size());
+    for (const auto &i: amounts)
+    {
+      boost::multiprecision::int128_t amount(i.second);
+      COMMAND_RPC_GET_CONVERSION_STATE::supply_entry se;
+      se.currency_label = i.first;
+      se.is_negative = amount < 0;
+      if (se.is_negative)
+        amount = -amount;
+      se.amount_lo = (amount & 0xffffffffffffffff).convert_to<uint64_t>();
+      se.amount_hi = ((amount >> 64) & 0xffffffffffffffff).convert_to<uint64_t>();
+      res.supply_tally.push_back(std::move(se));
+    }
+
+    // same cap the block template and block validation use
+    offshore::pricing_record latest_pr;
+    res.block_cap = m_core.get_blockchain_storage().get_latest_acceptable_pr(latest_pr) ? get_block_cap(amounts, latest_pr) : 0;
+
+    res.status = CORE_RPC_STATUS_OK;
+    return true;
+  }
+  //------------------------------------------------------------------------------------------------------------------------------
   bool core_rpc_server::on_get_collateral_requirements(const COMMAND_RPC_GET_COLLATERAL_REQUIREMENTS::request& req, COMMAND_RPC_GET_COLLATERAL_REQUIREMENTS::response& res, epee::json_rpc::error& error_resp, const connection_context *ctx)
   {
     PERF_TIMER(on_get_collateral_requirements);
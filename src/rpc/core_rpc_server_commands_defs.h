@@ -88,7 +88,7 @@ namespace cryptonote
 // advance which version they will stop working with
 // Don't go over 32767 for any of these
 #define CORE_RPC_VERSION_MAJOR 3
-#define CORE_RPC_VERSION_MINOR 1
+#define CORE_RPC_VERSION_MINOR 4
 #define MAKE_CORE_RPC_VERSION(major,minor) (((major)<<16)|(minor))
 #define CORE_RPC_VERSION MAKE_CORE_RPC_VERSION(CORE_RPC_VERSION_MAJOR, CORE_RPC_VERSION_MINOR)
 
@@ -781,6 +781,11 @@ namespace cryptonote
       uint64_t total_bytes_in;
       uint64_t total_packets_out;
       uint64_t total_bytes_out;
+      uint64_t total_delay_in_ms;
+      uint64_t total_delay_out_ms;
+      uint64_t block_sync_bytes_out;
+      uint64_t tx_relay_bytes_out;
+      uint64_t rpc_bytes_out;
 
       BEGIN_KV_SERIALIZE_MAP()
         KV_SERIALIZE_PARENT(rpc_response_base)
@@ -789,6 +794,11 @@ namespace cryptonote
         KV_SERIALIZE(total_bytes_in)
         KV_SERIALIZE(total_packets_out)
         KV_SERIALIZE(total_bytes_out)
+        KV_SERIALIZE_OPT(total_delay_in_ms, (uint64_t)0)
+        KV_SERIALIZE_OPT(total_delay_out_ms, (uint64_t)0)
+        KV_SERIALIZE_OPT(block_sync_bytes_out, (uint64_t)0)
+        KV_SERIALIZE_OPT(tx_relay_bytes_out, (uint64_t)0)
+        KV_SERIALIZE_OPT(rpc_bytes_out, (uint64_t)0)
       END_KV_SERIALIZE_MAP()
     };
     typedef epee::misc_utils::struct_init<response_t> response;
@@ -832,6 +842,7 @@ namespace cryptonote
       bool active;
       uint64_t speed;
       uint32_t threads_count;
+      std::vector<uint64_t> threads_speed;
       std::string address;
       std::string pow_algorithm;
       bool is_background_mining_enabled;
@@ -850,6 +861,7 @@ namespace cryptonote
         KV_SERIALIZE(active)
         KV_SERIALIZE(speed)
         KV_SERIALIZE(threads_count)
+        KV_SERIALIZE(threads_speed)
         KV_SERIALIZE(address)
         KV_SERIALIZE(pow_algorithm)
         KV_SERIALIZE(is_background_mining_enabled)
@@ -2082,6 +2094,52 @@ namespace cryptonote
     typedef epee::misc_utils::struct_init<response_t> response;
   };
   
+  struct COMMAND_RPC_GET_CONVERSION_STATE
+  {
+    struct request_t: public rpc_access_request_base
+    {
+      uint64_t height;
+
+      BEGIN_KV_SERIALIZE_MAP()
+        KV_SERIALIZE_PARENT(rpc_access_request_base)
+        KV_SERIALIZE_OPT(height, (uint64_t)0)
+      END_KV_SERIALIZE_MAP()
+    };
+    typedef epee::misc_utils::struct_init<request_t> request;
+
+    struct supply_entry
+    {
+      std::string currency_label;
+      bool is_negative;
+      uint64_t amount_hi;
+      uint64_t amount_lo;
+
+      BEGIN_KV_SERIALIZE_MAP()
+        KV_SERIALIZE(currency_label)
+        KV_SERIALIZE(is_negative)
+        KV_SERIALIZE(amount_hi)
+        KV_SERIALIZE(amount_lo)
+      END_KV_SERIALIZE_MAP()
+    };
+
+    struct response_t: public rpc_access_response_base
+    {
+      uint64_t height;
+      offshore::pricing_record pricing_record;
+      std::vector<supply_entry> supply_tally;
+      uint64_t block_cap;
+
+      BEGIN_KV_SERIALIZE_MAP()
+        KV_SERIALIZE_PARENT(rpc_access_response_base)
+        KV_SERIALIZE(height)
+        KV_SERIALIZE(pricing_record)
+        KV_SERIALIZE(supply_tally)
+        KV_SERIALIZE(block_cap)
+      END_KV_SERIALIZE_MAP()
+    };
+    typedef epee::misc_utils::struct_init<response_t> response;
+  };
+
   struct COMMAND_RPC_GET_OUTPUT_HISTOGRAM
   {
     struct request_t: public rpc_access_request_base
@@ -26,6 +26,7 @@
 // STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
 // THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+#include <boost/multiprecision/cpp_int.hpp>
 #include "node_rpc_proxy.h"
 #include "rpc/core_rpc_server_commands_defs.h"
 #include "rpc/rpc_payment_signature.h"
@@ -82,12 +83,18 @@ void NodeRPCProxy::invalidate()
   m_rpc_payment_credits_per_hash_found = 0;
   m_rpc_payment_height = 0;
   m_rpc_payment_cookie = 0;
+  m_conversion_state_height = 0;
+  m_conversion_state_time = 0;
+  m_conversion_state_pr = offshore::pricing_record();
+  m_conversion_state_supply.clear();
+  m_conversion_state_block_cap = 0;
 }
 
 boost::optional<std::string> NodeRPCProxy::get_rpc_version(uint32_t &rpc_version)
 {
   if (m_offline)
     return boost::optional<std::string>("offline");
+  const boost::lock_guard<boost::recursive_mutex> lock{m_daemon_rpc_mutex};
   if (m_rpc_version == 0)
   {
     cryptonote::COMMAND_RPC_GET_VERSION::request req_t = AUTO_VAL_INIT(req_t);
@@ -113,6 +120,7 @@ boost::optional<std::string> NodeRPCProxy::get_info()
 {
   if (m_offline)
     return boost::optional<std::string>("offline");
+  const boost::lock_guard<boost::recursive_mutex> lock{m_daemon_rpc_mutex};
   const time_t now = time(NULL);
   if (now >= m_get_info_time + 30) // re-cache every 30 seconds
   {
@@ -139,6 +147,7 @@ boost::optional<std::string> NodeRPCProxy::get_info()
 
 boost::optional<std::string> NodeRPCProxy::get_height(uint64_t &height)
 {
+  const boost::lock_guard<boost::recursive_mutex> lock{m_daemon_rpc_mutex};
   const time_t now = time(NULL);
   if (now < m_height_time + 30) // re-cache every 30 seconds
   {
@@ -175,6 +184,7 @@ boost::optional<std::string> NodeRPCProxy::get_earliest_height(uint8_t version,
 {
   if (m_offline)
     return boost::optional<std::string>("offline");
+  const boost::lock_guard<boost::recursive_mutex> lock{m_daemon_rpc_mutex};
   if (m_earliest_height[version] == 0)
   {
     cryptonote::COMMAND_RPC_HARD_FORK_INFO::request req_t = AUTO_VAL_INIT(req_t);
@@ -271,6 +281,58 @@ boost::optional<std::string> NodeRPCProxy::get_fee_quantization_mask(uint64_t &f
   return boost::optional<std::string>();
 }
 
+boost::optional<std::string> NodeRPCProxy::get_conversion_state(uint64_t height, offshore::pricing_record &pr, std::vector<std::pair<std::string, std::string>> &supply_amounts, uint64_t &block_cap)
+{
+  if (m_offline)
+    return boost::optional<std::string>("offline");
+  const boost::lock_guard<boost::recursive_mutex> lock{m_daemon_rpc_mutex};
+  const time_t now = time(NULL);
+  if (m_conversion_state_height != height || now >= m_conversion_state_time + 10) // re-cache every 10 seconds, or for another height
+  {
+    uint32_t rpc_version;
+    boost::optional<std::string> result = get_rpc_version(rpc_version);
+    if (result)
+      return result;
+    if (rpc_version < MAKE_CORE_RPC_VERSION(3, 2))
+      return boost::optional<std::string>("Daemon does not support get_conversion_state.bin");
+
+    cryptonote::COMMAND_RPC_GET_CONVERSION_STATE::request req_t = AUTO_VAL_INIT(req_t);
+    cryptonote::COMMAND_RPC_GET_CONVERSION_STATE::response resp_t = AUTO_VAL_INIT(resp_t);
+    req_t.height = height;
+
+    {
+      const boost::lock_guard<boost::recursive_mutex> lock{m_daemon_rpc_mutex};
+      uint64_t pre_call_credits = m_rpc_payment_state.credits;
+      req_t.client = cryptonote::make_rpc_payment_signature(m_client_id_secret_key);
+      bool r = net_utils::invoke_http_bin("/get_conversion_state.bin", req_t, resp_t, m_http_client, rpc_timeout);
+      RETURN_ON_RPC_RESPONSE_ERROR(r, epee::json_rpc::error{}, resp_t, "/get_conversion_state.bin");
+      check_rpc_cost(m_rpc_payment_state, "/get_conversion_state.bin", resp_t.credits, pre_call_credits, COST_PER_BLOCK_HEADER);
+    }
+
+    // consumers still take the supply tallies as decimal strings, convert them once here
+    m_conversion_state_supply.clear();
+    m_conversion_state_supply.reserve(resp_t.supply_tally.size());
+    for (const auto &se: resp_t.supply_tally)
+    {
+      boost::multiprecision::int128_t amount = se.amount_hi;
+      amount <<= 64;
+      amount |= se.amount_lo;
+      if (se.is_negative)
+        amount = -amount;
+      m_conversion_state_supply.emplace_back(se.currency_label, amount.str());
+    }
+    m_conversion_state_pr = resp_t.pricing_record;
+    m_conversion_state_block_cap = resp_t.block_cap;
+    m_conversion_state_height = height;
+    m_conversion_state_time = now;
+  }
+
+  pr = m_conversion_state_pr;
+  supply_amounts = m_conversion_state_supply;
+  block_cap = m_conversion_state_block_cap;
+  return boost::optional<std::string>();
+}
+
 boost::optional<std::string> NodeRPCProxy::get_rpc_payment_info(bool mining, bool &payment_required, uint64_t &credits, uint64_t &diff, uint64_t &credits_per_hash_found, cryptonote::blobdata &blob, uint64_t &height, uint64_t &seed_height, crypto::hash &seed_hash, crypto::hash &next_seed_hash, uint32_t &cookie)
 {
   const time_t now = time(NULL);
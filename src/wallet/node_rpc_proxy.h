@@ -55,6 +55,7 @@ public:
   boost::optional<std::string> get_earliest_height(uint8_t version, uint64_t &earliest_height);
   boost::optional<std::string> get_dynamic_base_fee_estimate(uint64_t grace_blocks, uint64_t &fee);
   boost::optional<std::string> get_fee_quantization_mask(uint64_t &fee_quantization_mask);
+  boost::optional<std::string> get_conversion_state(uint64_t height, offshore::pricing_record &pr, std::vector<std::pair<std::string, std::string>> &supply_amounts, uint64_t &block_cap);
   boost::optional<std::string> get_rpc_payment_info(bool mining, bool &payment_required, uint64_t &credits, uint64_t &diff, uint64_t &credits_per_hash_found, cryptonote::blobdata &blob, uint64_t &height, uint64_t &seed_height, crypto::hash &seed_hash, crypto::hash &next_seed_hash, uint32_t &cookie);
 
 private:
@@ -98,6 +99,11 @@ private:
   crypto::hash m_rpc_payment_next_seed_hash;
   uint32_t m_rpc_payment_cookie;
   time_t m_height_time;
+  uint64_t m_conversion_state_height;
+  time_t m_conversion_state_time;
+  offshore::pricing_record m_conversion_state_pr;
+  std::vector<std::pair<std::string, std::string>> m_conversion_state_supply;
+  uint64_t m_conversion_state_block_cap;
 };
 
 }
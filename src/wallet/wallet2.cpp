@@ -134,6 +134,11 @@ using namespace cryptonote;
 
 #define FIRST_REFRESH_GRANULARITY     1024
 
+#define HASHCHAIN_RECENT_BLOCKS 4096 // hashes kept in full, older ones are only kept as sparse checkpoints
+
+#define RCT_DISTRIBUTION_CACHE_OVERLAP 100 // blocks re-requested when extending a cached rct distribution
+#define OUTS_CACHE_MAX_ENTRIES 100000 // fetched decoys kept by get_outs, the cache starts over past that
+
 #define GAMMA_SHAPE 19.28
 #define GAMMA_SCALE (1/1.61)
 
@@ -1255,7 +1260,8 @@ wallet2::wallet2(network_type nettype, uint64_t kdf_rounds, bool unattended, std
   m_offline(false),
   m_rpc_version(0),
   m_export_format(ExportFormat::Binary),
-  m_credits_target(0)
+  m_credits_target(0),
+  m_refresh_yield_lock(NULL)
 {
   set_rpc_client_secret_key(rct::rct2sk(rct::skGen()));
 
@@ -1377,6 +1383,7 @@ bool wallet2::set_daemon(std::string daemon_address, boost::optional<epee::net_u
     m_rpc_payment_state.expected_spent = 0;
     m_rpc_payment_state.discrepancy = 0;
     m_node_rpc_proxy.invalidate();
+    invalidate_decoy_caches();
   }
 
   const std::string address = get_daemon_address();
@@ -2039,6 +2046,20 @@ bool wallet2::spends_one_of_ours(const cryptonote::transaction &tx) const
 //----------------------------------------------------------------------------------------------------
 bool wallet2::get_pricing_record(offshore::pricing_record& pr, const uint64_t height)
 {
+  // Prefer the daemon's conversion state snapshot, which is cached by the RPC proxy
+  std::vector<std::pair<std::string, std::string>> supply_amounts;
+  uint64_t block_cap;
+  boost::optional<std::string> result = m_node_rpc_proxy.get_conversion_state(height, pr, supply_amounts, block_cap);
+  if (!result)
+  {
+    if (pr.empty()) {
+      MERROR("Invalid pricing record in block header - offshore TXs disabled. Please try again later.");
+      return false;
+    }
+    return true;
+  }
+  MDEBUG("Failed to get conversion state (" << *result << "), falling back to getblockheaderbyheight");
+
   // Issue an RPC call to get the block header (and thus the pricing record) at the specified height
   cryptonote::COMMAND_RPC_GET_BLOCK_HEADER_BY_HEIGHT::request req = AUTO_VAL_INIT(req);
   cryptonote::COMMAND_RPC_GET_BLOCK_HEADER_BY_HEIGHT::response res = AUTO_VAL_INIT(res);
@@ -2067,6 +2088,18 @@ bool wallet2::get_pricing_record(offshore::pricing_record& pr, const uint64_t he
 //----------------------------------------------------------------------------------------------------
 bool wallet2::get_circulating_supply(std::vector<std::pair<std::string, std::string>> &amounts)
 {
+  // The snapshot carries the pricing record at our current height too, so conversions reuse the same cached call
+  offshore::pricing_record pr;
+  uint64_t block_cap;
+  std::vector<std::pair<std::string, std::string>> supply_amounts;
+  boost::optional<std::string> result = m_node_rpc_proxy.get_conversion_state(get_blockchain_current_height() - 1, pr, supply_amounts, block_cap);
+  if (!result)
+  {
+    amounts.insert(amounts.end(), supply_amounts.begin(), supply_amounts.end());
+    return true;
+  }
+  MDEBUG("Failed to get conversion state (" << *result << "), falling back to get_circulating_supply");
+
   // Issue an RPC call to get the block header (and thus the pricing record) at the specified height
   cryptonote::COMMAND_RPC_GET_CIRCULATING_SUPPLY::request req = AUTO_VAL_INIT(req);
   cryptonote::COMMAND_RPC_GET_CIRCULATING_SUPPLY::response res = AUTO_VAL_INIT(res);
@@ -2108,19 +2141,37 @@ bool wallet2::get_max_destination_amount(const cryptonote::transaction_type tx_t
     // Get the current blockchain height
     uint64_t current_height = get_blockchain_current_height()-1;
 
-    // Get the pricing record for the current height
+    // The conversion state snapshot has the pricing record, the circulating supply and the block cap
     offshore::pricing_record pr;
-    if (!get_pricing_record(pr, current_height)) {
-      err ="Failed to get pricing record";
-      return false;
-    }
-
-    // Get the circulating supply data
     std::vector<std::pair<std::string, std::string>> amounts;
-    if (!get_circulating_supply(amounts)) {
-      err ="Failed to get circulating supply";
-      return false;
+    uint64_t block_cap = 0;
+    boost::optional<std::string> result = m_node_rpc_proxy.get_conversion_state(current_height, pr, amounts, block_cap);
+    if (result || pr.empty()) {
+      amounts.clear();
+
+      // Get the pricing record for the current height
+      if (!get_pricing_record(pr, current_height)) {
+        err ="Failed to get pricing record";
+        return false;
+      }
+
+      // Get the circulating supply data
+      if (!get_circulating_supply(amounts)) {
+        err ="Failed to get circulating supply";
+        return false;
+      }
+
+      // Older daemons don't send the block cap, work it out from the same data
+      block_cap = cryptonote::get_block_cap(amounts, pr);
     }
+
+    // An offshore/onshore moving more XHV than the block cap would never be mined
+    const auto cap_xhv_amount = [block_cap](uint64_t &xhv_amount) {
+      if (xhv_amount > block_cap) {
+        xhv_amount = block_cap - (block_cap % 100000000);
+        LOG_PRINT_L2("Max amount capped to the block cap of " << print_money(block_cap) << " XHV");
+      }
+    };
     
     if (tx_type == tt::OFFSHORE) {
 
@@ -2163,6 +2214,7 @@ bool wallet2::get_max_destination_amount(const cryptonote::transaction_type tx_t
       }
       if (found) {
         amount = last_amount - (last_amount % 100000000);
+        cap_xhv_amount(amount);
         return true;
       }
       
@@ -2219,6 +2271,7 @@ bool wallet2::get_max_destination_amount(const cryptonote::transaction_type tx_t
       if (found) {
         amount = cryptonote::get_xhv_amount(last_amount, pr, tx_type, hf_version);
         amount -= (amount % 100000000);
+        cap_xhv_amount(amount);
 	      LOG_PRINT_L2("Found max amount = " << last_amount << " xUSD (" << amount << " XHV), and requires " << collateral << " XHV as collateral");
         return true;
       }
@@ -3155,30 +3208,42 @@ void wallet2::get_short_chain_history(std::list<crypto::hash>& ids, uint64_t gra
   size_t current_multiplier = 1;
   size_t blockchain_size = std::max((size_t)(m_blockchain.size() / granularity * granularity), m_blockchain.offset());
   size_t sz = blockchain_size - m_blockchain.offset();
-  if(!sz)
+  if(sz)
   {
-    ids.push_back(m_blockchain.genesis());
-    return;
-  }
-  size_t current_back_offset = 1;
-  bool base_included = false;
-  while(current_back_offset < sz)
-  {
-    ids.push_back(m_blockchain[m_blockchain.offset() + sz-current_back_offset]);
-    if(sz-current_back_offset == 0)
-      base_included = true;
-    if(i < 10)
+    size_t current_back_offset = 1;
+    bool base_included = false;
+    while(current_back_offset < sz)
     {
-      ++current_back_offset;
-    }else
-    {
-      current_back_offset += current_multiplier *= 2;
+      ids.push_back(m_blockchain[m_blockchain.offset() + sz-current_back_offset]);
+      if(sz-current_back_offset == 0)
+        base_included = true;
+      if(i < 10)
+      {
+        ++current_back_offset;
+      }else
+      {
+        current_back_offset += current_multiplier *= 2;
+      }
+      ++i;
     }
-    ++i;
+    if(!base_included)
+      ids.push_back(m_blockchain[m_blockchain.offset()]);
   }
-  if(!base_included)
-    ids.push_back(m_blockchain[m_blockchain.offset()]);
-  if(m_blockchain.offset())
+
+  // below the trimmed part, use sparse checkpoints, spaced further and further apart
+  uint64_t next_height = m_blockchain.offset();
+  uint64_t stride = hashchain::checkpoint_interval;
+  const std::map<uint64_t, crypto::hash> &checkpoints = m_blockchain.checkpoints();
+  for (auto it = checkpoints.rbegin(); it != checkpoints.rend(); ++it)
+  {
+    if (it->first > next_height)
+      continue;
+    ids.push_back(it->second);
+    next_height = it->first > stride ? it->first - stride : 0;
+    stride *= 2;
+  }
+
+  if(m_blockchain.offset() || !sz)
     ids.push_back(m_blockchain.genesis());
 }
 //----------------------------------------------------------------------------------------------------
@@ -3260,6 +3325,14 @@ void wallet2::process_parsed_blocks(uint64_t start_height, const std::vector<cry
   blocks_added = 0;
 
   THROW_WALLET_EXCEPTION_IF(blocks.size() != parsed_blocks.size(), error::wallet_internal_error, "size mismatch");
+  if (current_index < m_blockchain.offset() && m_blockchain.has_checkpoint(current_index) && !parsed_blocks.empty() &&
+      parsed_blocks[0].hash == m_blockchain.checkpoints().at(current_index))
+  {
+    // the daemon only knows one of our sparse checkpoints: reorg deeper than what we keep in full, rescan from there
+    MWARNING("Reorg below hashchain offset " << m_blockchain.offset() << ", rewinding to checkpoint at height " << current_index);
+    m_blockchain.rewind(current_index);
+    detach_blockchain(current_index + 1, output_tracker_cache);
+  }
   THROW_WALLET_EXCEPTION_IF(!m_blockchain.is_in_bounds(current_index), error::out_of_hashchain_bounds_error);
 
   tools::threadpool& tpool = tools::threadpool::getInstance();
@@ -3808,11 +3881,7 @@ void wallet2::fast_refresh(uint64_t stop_height, uint64_t &blocks_start_height,
   if ((stop_height > checkpoint_height && m_blockchain.size()-1 < checkpoint_height) && !force)
   {
     // we will drop all these, so don't bother getting them
-    uint64_t missing_blocks = m_checkpoints.get_max_height() - m_blockchain.size();
-    while (missing_blocks-- > 0)
-      m_blockchain.push_back(crypto::null_hash); // maybe a bit suboptimal, but deque won't do huge reallocs like vector
-    m_blockchain.push_back(m_checkpoints.get_points().at(checkpoint_height));
-    m_blockchain.trim(checkpoint_height);
+    m_blockchain.skip_to(checkpoint_height, m_checkpoints.get_points().at(checkpoint_height));
     short_chain_history.clear();
     get_short_chain_history(short_chain_history);
   }
@@ -4074,7 +4143,17 @@ void wallet2::refresh(bool trusted_daemon, uint64_t start_height, uint64_t & blo
         }
         blocks_fetched += added_blocks;
       }
-      waiter.wait(&tpool);
+      if (m_refresh_yield_lock)
+      {
+        // this batch is fully processed, let readers in while the next one is fetched
+        m_refresh_yield_lock->unlock_and_lock_upgrade();
+        auto relock = epee::misc_utils::create_scope_leave_handler([this](){ m_refresh_yield_lock->unlock_upgrade_and_lock(); });
+        waiter.wait(&tpool);
+      }
+      else
+      {
+        waiter.wait(&tpool);
+      }
       if(!first && blocks_start_height == next_blocks_start_height)
       {
         m_node_rpc_proxy.set_height(m_blockchain.size());
@@ -4151,6 +4230,9 @@ void wallet2::refresh(bool trusted_daemon, uint64_t start_height, uint64_t & blo
     LOG_PRINT_L1("Failed to check pending transactions");
   }
 
+  if (blocks_fetched > 0)
+    trim_hashchain();
+
   m_first_refresh_done = true;
 
   LOG_PRINT_L1("Refresh done, blocks received: " << blocks_fetched << ", balance (all accounts): ");
@@ -4204,10 +4286,21 @@ bool wallet2::get_rct_distribution(const bool use_global_outs, const std::string
     }
   }
 
+  // only fetch the tail of the distribution if we have it cached already, re-requesting
+  // a few blocks we have so that a reorg since the last call can be detected
+  const std::string cache_key = use_global_outs ? std::string() : rct_asset_type;
+  uint64_t from_height = 0;
+  {
+    const boost::lock_guard<boost::mutex> lock{m_decoy_cache_mutex};
+    const auto i = m_rct_distribution_cache.find(cache_key);
+    if (i != m_rct_distribution_cache.end() && i->second.distribution.size() > RCT_DISTRIBUTION_CACHE_OVERLAP)
+      from_height = i->second.start_height + i->second.distribution.size() - RCT_DISTRIBUTION_CACHE_OVERLAP;
+  }
+
   cryptonote::COMMAND_RPC_GET_OUTPUT_DISTRIBUTION::request req = AUTO_VAL_INIT(req);
   cryptonote::COMMAND_RPC_GET_OUTPUT_DISTRIBUTION::response res = AUTO_VAL_INIT(res);
   req.amounts.push_back(0);
-  req.from_height = 0;
+  req.from_height = from_height;
   if (!use_global_outs)
     req.rct_asset_type = rct_asset_type;
   req.default_tx_spendable_age = CRYPTONOTE_DEFAULT_TX_SPENDABLE_AGE;
@@ -4227,24 +4320,82 @@ bool wallet2::get_rct_distribution(const bool use_global_outs, const std::string
   }
   catch(...)
   {
-    return false;
+    r = false;
   }
-  if (res.distributions.size() != 1)
+  if (r && res.distributions.size() != 1)
   {
     MWARNING("Failed to request output distribution: not the expected single result");
-    return false;
+    r = false;
   }
-  if (res.distributions[0].amount != 0)
+  if (r && res.distributions[0].amount != 0)
   {
     MWARNING("Failed to request output distribution: results are not for amount 0");
-    return false;
+    r = false;
   }
-  start_height = res.distributions[0].data.start_height;
-  num_spendable_global_outs = res.distributions[0].data.num_spendable_global_outs;
-  distribution = std::move(res.distributions[0].data.distribution);
+  if (!r)
+  {
+    if (from_height == 0)
+      return false;
+    // the daemon may have popped blocks below our cached top, start afresh
+    {
+      const boost::lock_guard<boost::mutex> lock{m_decoy_cache_mutex};
+      m_rct_distribution_cache.erase(cache_key);
+    }
+    return get_rct_distribution(use_global_outs, rct_asset_type, start_height, distribution, num_spendable_global_outs);
+  }
+
+  cryptonote::rpc::output_distribution_data &data = res.distributions[0].data;
+  {
+    const boost::lock_guard<boost::mutex> lock{m_decoy_cache_mutex};
+    rct_distribution_cache_entry &entry = m_rct_distribution_cache[cache_key];
+    if (from_height > 0)
+    {
+      // the overlapping part must match what we have, or the chain was reorganized deeper than the overlap
+      const size_t offset = from_height - entry.start_height;
+      const bool extends = data.start_height == from_height && offset <= entry.distribution.size() &&
+          data.distribution.size() >= entry.distribution.size() - offset &&
+          std::equal(entry.distribution.begin() + offset, entry.distribution.end(), data.distribution.begin());
+      if (!extends)
+      {
+        MDEBUG("Cached rct distribution for " << (cache_key.empty() ? "global outputs" : cache_key) << " does not match the daemon's, refetching");
+        m_rct_distribution_cache.erase(cache_key);
+      }
+      else
+      {
+        const size_t cached_blocks = entry.distribution.size();
+        entry.distribution.resize(offset);
+        entry.distribution.insert(entry.distribution.end(), data.distribution.begin(), data.distribution.end());
+        entry.num_spendable_global_outs = data.num_spendable_global_outs;
+        MDEBUG("Extended cached rct distribution from " << cached_blocks << " to " << entry.distribution.size() << " blocks");
+        start_height = entry.start_height;
+        num_spendable_global_outs = entry.num_spendable_global_outs;
+        distribution = entry.distribution;
+        return true;
+      }
+    }
+    else
+    {
+      entry.start_height = data.start_height;
+      entry.distribution = data.distribution;
+      entry.num_spendable_global_outs = data.num_spendable_global_outs;
+    }
+  }
+  if (from_height > 0)
+    return get_rct_distribution(use_global_outs, rct_asset_type, start_height, distribution, num_spendable_global_outs);
+
+  start_height = data.start_height;
+  num_spendable_global_outs = data.num_spendable_global_outs;
+  distribution = std::move(data.distribution);
   return true;
 }
 //----------------------------------------------------------------------------------------------------
+void wallet2::invalidate_decoy_caches()
+{
+  const boost::lock_guard<boost::mutex> lock{m_decoy_cache_mutex};
+  m_rct_distribution_cache.clear();
+  m_outs_cache.clear();
+}
+//----------------------------------------------------------------------------------------------------
 void wallet2::detach_blockchain(uint64_t height, std::map<std::pair<uint64_t, uint64_t>, size_t> *output_tracker_cache)
 {
   LOG_PRINT_L0("Detaching blockchain on height " << height);
@@ -4255,6 +4406,8 @@ void wallet2::detach_blockchain(uint64_t height, std::map<std::pair<uint64_t, ui
   THROW_WALLET_EXCEPTION_IF(height < m_blockchain.offset() && m_blockchain.size() > m_blockchain.offset(),
       error::wallet_internal_error, "Daemon claims reorg below last checkpoint");
 
+  invalidate_decoy_caches();
+
   size_t transfers_detached = 0, total_transfers_detached = 0;
 
   for (auto &asset_type: offshore::ASSET_TYPES) {
@@ -4347,6 +4500,7 @@ bool wallet2::clear()
   for (auto &asset_type: m_xasset_transfers) {
     asset_type.second.clear();
   }
+  add_xasset_containers();
   m_key_images.clear();
   m_pub_keys.clear();
   m_unconfirmed_txs.clear();
@@ -6371,6 +6525,7 @@ void wallet2::load(const std::string& wallet_, const epee::wipeable_string& pass
   }
 
   trim_hashchain();
+  add_xasset_containers();
 
   if (get_num_subaddress_accounts() == 0)
     add_subaddress_account(tr("Primary account"));
@@ -6395,6 +6550,15 @@ void wallet2::load(const std::string& wallet_, const epee::wipeable_string& pass
   }
 }
 //----------------------------------------------------------------------------------------------------
+void wallet2::add_xasset_containers()
+{
+  // have a container for every xasset up front, so that looking one up through
+  // operator[] never inserts into m_xasset_transfers while readers share the wallet
+  for (const auto &asset_type: offshore::ASSET_TYPES)
+    if (asset_type != "XHV" && asset_type != "XUSD")
+      m_xasset_transfers[asset_type];
+}
+//----------------------------------------------------------------------------------------------------
 void wallet2::trim_hashchain()
 {
   uint64_t height = m_checkpoints.get_max_height();
@@ -6407,6 +6571,10 @@ void wallet2::trim_hashchain()
     if (td.m_block_height < height)
       height = td.m_block_height;
 
+  // deeper reorgs can be recovered from the sparse checkpoints, so only a recent window needs to be kept in full
+  if (m_blockchain.size() > HASHCHAIN_RECENT_BLOCKS)
+    height = std::max<uint64_t>(height, m_blockchain.size() - HASHCHAIN_RECENT_BLOCKS);
+
   if (!m_blockchain.empty() && m_blockchain.size() == m_blockchain.offset())
   {
     MINFO("Fixing empty hashchain");
@@ -9003,6 +9171,25 @@ void wallet2::light_wallet_get_outs(std::vector<std::vector<tools::wallet2::get_
   }
 }
 
+// rings for test txes which are only built to size their fee: the real output at its own index,
+// and decoys spaced so that every key offset takes as many bytes as any real offset could
+void get_sizing_outs(const tools::wallet2::transfer_container &specific_transfers, std::vector<std::vector<tools::wallet2::get_outs_entry>> &outs, const std::vector<size_t> &selected_transfers, size_t fake_outputs_count)
+{
+  static const uint64_t SIZING_OFFSET = (uint64_t)1 << 28; // 5 byte varint, like any output index below 2^35
+  outs.clear();
+  outs.reserve(selected_transfers.size());
+  for (size_t idx: selected_transfers)
+  {
+    const tools::wallet2::transfer_details &td = specific_transfers[idx];
+    const crypto::public_key key = td.get_public_key();
+    const rct::key mask = td.is_rct() ? rct::commit(td.amount(), td.m_mask) : rct::zeroCommit(td.amount());
+    outs.push_back(std::vector<tools::wallet2::get_outs_entry>());
+    outs.back().reserve(fake_outputs_count + 1);
+    for (size_t n = 0; n < fake_outputs_count + 1; ++n)
+      outs.back().push_back(std::make_tuple(td.m_global_output_index + n * SIZING_OFFSET, key, mask));
+  }
+}
+
 std::pair<std::set<uint64_t>, size_t> outs_unique(const std::vector<std::vector<tools::wallet2::get_outs_entry>> &outs)
 {
   std::set<uint64_t> unique;
@@ -9542,23 +9729,69 @@ void wallet2::get_outs(const transfer_container &specific_transfers, const std::
             boost::join(o.second | boost::adaptors::transformed([](uint64_t out){return std::to_string(out);}), " "));
     }
 
-    // get the keys for those
-    req.get_txid = false;
+    // get the keys for those, only asking the daemon once for each output we do not
+    // already have: rings for several inputs may overlap, and the same outputs get
+    // requested again when a tx is retried with more inputs
+    const std::string outs_asset_type = use_global_outs ? std::string() : rct_asset_type;
+    COMMAND_RPC_GET_OUTPUTS_BIN::request fetch_req = AUTO_VAL_INIT(fetch_req);
+    fetch_req.get_txid = false;
     if (!use_global_outs)
-      req.asset_type = rct_asset_type;
+      fetch_req.asset_type = rct_asset_type;
+    std::map<std::pair<uint64_t, uint64_t>, COMMAND_RPC_GET_OUTPUTS_BIN::outkey> fetched_outs;
+    {
+      const boost::lock_guard<boost::mutex> lock{m_decoy_cache_mutex};
+      for (const auto &o: req.outputs)
+      {
+        const std::pair<uint64_t, uint64_t> key = std::make_pair(o.amount, o.index);
+        if (fetched_outs.find(key) != fetched_outs.end())
+          continue;
+        const auto i = m_outs_cache.find(std::make_tuple(outs_asset_type, o.amount, o.index));
+        if (i != m_outs_cache.end())
+        {
+          fetched_outs.emplace(key, i->second);
+          continue;
+        }
+        fetched_outs.emplace(key, COMMAND_RPC_GET_OUTPUTS_BIN::outkey());
+        fetch_req.outputs.push_back(o);
+      }
+    }
+    MDEBUG("Requesting " << fetch_req.outputs.size() << " outputs from the daemon, " << (fetched_outs.size() - fetch_req.outputs.size()) << " known, " << (req.outputs.size() - fetched_outs.size()) << " duplicates");
 
+    if (!fetch_req.outputs.empty())
     {
-      const boost::lock_guard<boost::recursive_mutex> lock{m_daemon_rpc_mutex};
-      uint64_t pre_call_credits = m_rpc_payment_state.credits;
-      req.client = get_client_signature();
-      bool r = epee::net_utils::invoke_http_bin("/get_outs.bin", req, daemon_resp, *m_http_client, rpc_timeout);
-      THROW_ON_RPC_RESPONSE_ERROR(r, {}, daemon_resp, "get_outs.bin", error::get_outs_error, get_rpc_status(daemon_resp.status));
-      THROW_WALLET_EXCEPTION_IF(daemon_resp.outs.size() != req.outputs.size(), error::wallet_internal_error,
-        "daemon returned wrong response for get_outs.bin, wrong amounts count = " +
-        std::to_string(daemon_resp.outs.size()) + ", expected " +  std::to_string(req.outputs.size()));
-      check_rpc_cost("/get_outs.bin", daemon_resp.credits, pre_call_credits, daemon_resp.outs.size() * COST_PER_OUT);
+      COMMAND_RPC_GET_OUTPUTS_BIN::response fetch_resp = AUTO_VAL_INIT(fetch_resp);
+      {
+        const boost::lock_guard<boost::recursive_mutex> lock{m_daemon_rpc_mutex};
+        uint64_t pre_call_credits = m_rpc_payment_state.credits;
+        fetch_req.client = get_client_signature();
+        bool r = epee::net_utils::invoke_http_bin("/get_outs.bin", fetch_req, fetch_resp, *m_http_client, rpc_timeout);
+        THROW_ON_RPC_RESPONSE_ERROR(r, {}, fetch_resp, "get_outs.bin", error::get_outs_error, get_rpc_status(fetch_resp.status));
+        THROW_WALLET_EXCEPTION_IF(fetch_resp.outs.size() != fetch_req.outputs.size(), error::wallet_internal_error,
+          "daemon returned wrong response for get_outs.bin, wrong amounts count = " +
+          std::to_string(fetch_resp.outs.size()) + ", expected " +  std::to_string(fetch_req.outputs.size()));
+        check_rpc_cost("/get_outs.bin", fetch_resp.credits, pre_call_credits, fetch_resp.outs.size() * COST_PER_OUT);
+      }
+
+      // unlocked outputs do not change unless the chain is reorganized, in which case the cache is dropped
+      const boost::lock_guard<boost::mutex> lock{m_decoy_cache_mutex};
+      if (m_outs_cache.size() + fetch_req.outputs.size() > OUTS_CACHE_MAX_ENTRIES)
+      {
+        MDEBUG("Dropping " << m_outs_cache.size() << " cached outputs");
+        m_outs_cache.clear();
+      }
+      for (size_t n = 0; n < fetch_req.outputs.size(); ++n)
+      {
+        const get_outputs_out &o = fetch_req.outputs[n];
+        fetched_outs[std::make_pair(o.amount, o.index)] = fetch_resp.outs[n];
+        if (fetch_resp.outs[n].unlocked)
+          m_outs_cache[std::make_tuple(outs_asset_type, o.amount, o.index)] = fetch_resp.outs[n];
+      }
     }
 
+    daemon_resp.outs.reserve(req.outputs.size());
+    for (const auto &o: req.outputs)
+      daemon_resp.outs.push_back(fetched_outs[std::make_pair(o.amount, o.index)]);
+
     std::unordered_map<uint64_t, uint64_t> scanty_outs;
     size_t base = 0;
     outs.reserve(num_selected_transfers);
@@ -11312,7 +11545,11 @@ std::vector<wallet2::pending_tx> wallet2::create_transactions_2(
   unsigned int original_output_index = 0;
   std::vector<size_t>* unused_transfers_indices = &unused_transfers_indices_per_subaddr[0].second;
   std::vector<size_t>* unused_dust_indices      = &unused_dust_indices_per_subaddr[0].second;
-  
+
+  // when the software device builds the txes, the test txes below are built on sizing rings, and
+  // the decoys for all the txes are fetched at once when the inputs are known
+  const bool batch_decoys = !m_multisig && fake_outs_count > 0 && hwdev.get_type() == hw::device::device_type::SOFTWARE;
+
   hwdev.set_mode(hw::device::TRANSACTION_CREATE_FAKE);
 #define DSTS_FRONT_AMOUNT  (use_xasset_outputs ? dsts[0].amount_xasset : use_offshore_outputs ? dsts[0].amount_usd : dsts[0].amount)
   while ((!dsts.empty() && (DSTS_FRONT_AMOUNT > 0)) || adding_fee || !preferred_inputs.empty() || should_pick_a_second_output(use_rct, txes.back().selected_transfers.size(), *unused_transfers_indices, *unused_dust_indices, specific_transfers)) {
@@ -11484,6 +11721,8 @@ std::vector<wallet2::pending_tx> wallet2::create_transactions_2(
       }
       
       // try to create a tx now
+      if (batch_decoys && outs.empty())
+        get_sizing_outs(specific_transfers, outs, tx.selected_transfers, fake_outs_count);
       transfer_selected_rct(
         tx.dsts,
         tx.selected_transfers,
@@ -11579,7 +11818,8 @@ std::vector<wallet2::pending_tx> wallet2::create_transactions_2(
         tx.tx = test_tx;
         tx.ptx = test_ptx;
         tx.weight = get_transaction_weight(test_tx, txBlob.size());
-        tx.outs = outs;
+        if (!batch_decoys)
+          tx.outs = outs;
         tx.outs_collateral = outs_collateral;
         tx.needed_fee = test_ptx.fee;
         accumulated_fee += test_ptx.fee;
@@ -11622,42 +11862,109 @@ skip_tx:
     " total fee, " << print_money(accumulated_change) << " total change");
 
   hwdev.set_mode(hw::device::TRANSACTION_CREATE_REAL);
-  for (std::vector<TX>::iterator i = txes.begin(); i != txes.end(); ++i)
+
+  // get the inputs for collateral
+  std::vector<std::vector<size_t>> col_ins(txes.size());
+  if (tx_type == tt::ONSHORE) {
+    for (size_t n = 0; n < txes.size(); ++n)
+      THROW_WALLET_EXCEPTION_IF(!get_onshore_collateral_inputs(needed_col, col_ins[n]), error::wallet_internal_error, "Failed to find sufficient inputs for onshore collateral");
+  }
+
+  // get the decoys for the inputs of all the txes in one go
+  if (batch_decoys)
   {
-    TX &tx = *i;
+    std::vector<size_t> selected_transfers;
+    for (const TX &tx: txes)
+      selected_transfers.insert(selected_transfers.end(), tx.selected_transfers.begin(), tx.selected_transfers.end());
+    LOG_PRINT_L2("Getting decoys for " << selected_transfers.size() << " inputs of " << txes.size() << " transactions");
+    std::vector<std::vector<tools::wallet2::get_outs_entry>> all_outs;
+    get_outs(specific_transfers, strSource, all_outs, selected_transfers, fake_outs_count); // may throw
+    THROW_WALLET_EXCEPTION_IF(all_outs.size() != selected_transfers.size(), error::wallet_internal_error, "Unexpected number of rings");
+    auto ring = all_outs.begin();
+    for (TX &tx: txes)
+    {
+      tx.outs.assign(ring, ring + tx.selected_transfers.size());
+      ring += tx.selected_transfers.size();
+    }
+  }
+
+  // all decoys are fetched by now, so what is left is signing and proving, which
+  // the software device can do for several txes at once
+  const bool parallel = txes.size() > 1 && !m_multisig && hwdev.get_type() == hw::device::device_type::SOFTWARE &&
+    std::all_of(txes.begin(), txes.end(), [](const TX &tx) { return !tx.outs.empty(); });
+  std::vector<std::exception_ptr> errors(txes.size());
+  auto construct = [&](size_t n)
+  {
+    TX &tx = txes[n];
     cryptonote::transaction test_tx;
     pending_tx test_ptx;
 
-    // get the inputs for collateral
-    std::vector<size_t> col_ins;
-    if (tx_type == tt::ONSHORE) {
-      THROW_WALLET_EXCEPTION_IF(!get_onshore_collateral_inputs(needed_col, col_ins), error::wallet_internal_error, "Failed to find sufficient inputs for onshore collateral");
+    try
+    {
+      auto build = [&](uint64_t fee)
+      {
+        transfer_selected_rct(
+          tx.dsts,                    /* NOMOD std::vector<cryptonote::tx_destination_entry> dsts,*/
+          tx.selected_transfers,      /* const std::list<size_t> selected_transfers */
+          fake_outs_count,            /* CONST size_t fake_outputs_count, */
+          tx.outs,                    /* MOD   std::vector<std::vector<tools::wallet2::get_outs_entry>> &outs, */
+          tx.outs_collateral,         /* MOD   std::vector<std::vector<tools::wallet2::get_outs_entry>> &outs_collateral, */
+          unlock_time,                /* CONST uint64_t unlock_time,  */
+          fee,                        /* CONST uint64_t fee, */
+          extra,                      /* const std::vector<uint8_t>& extra, */
+          test_tx,                    /* OUT   cryptonote::transaction& tx, */
+          test_ptx,                   /* OUT   cryptonote::transaction& tx, */
+          rct_config,
+          tx_type,
+          strSource,
+          strDest,
+          pricing_record,
+          current_height,
+          col_ins[n]
+        );
+      };
+      build(tx.needed_fee);
+      auto txBlob = t_serializable_object_to_blob(test_ptx.tx);
+      if (batch_decoys)
+      {
+        // the fee was worked out on the sizing rings, which are at least as large as the real
+        // ones, so pay what the real rings need instead
+        uint64_t needed_fee = calculate_fee(use_per_byte_fee, test_ptx.tx, txBlob.size(), base_fee, fee_multiplier, fee_quantization_mask) + offshore_fee;
+        bool rebuilt = false;
+        while (needed_fee > test_ptx.fee || (!rebuilt && needed_fee < test_ptx.fee))
+        {
+          rebuilt = true;
+          build(needed_fee);
+          txBlob = t_serializable_object_to_blob(test_ptx.tx);
+          needed_fee = calculate_fee(use_per_byte_fee, test_ptx.tx, txBlob.size(), base_fee, fee_multiplier, fee_quantization_mask) + offshore_fee;
+        }
+      }
+      tx.tx = test_tx;
+      tx.ptx = test_ptx;
+      tx.weight = get_transaction_weight(test_tx, txBlob.size());
     }
-
-    transfer_selected_rct(
-      tx.dsts,                    /* NOMOD std::vector<cryptonote::tx_destination_entry> dsts,*/
-      tx.selected_transfers,      /* const std::list<size_t> selected_transfers */
-      fake_outs_count,            /* CONST size_t fake_outputs_count, */
-      tx.outs,                    /* MOD   std::vector<std::vector<tools::wallet2::get_outs_entry>> &outs, */
-      tx.outs_collateral,         /* MOD   std::vector<std::vector<tools::wallet2::get_outs_entry>> &outs_collateral, */
-      unlock_time,                /* CONST uint64_t unlock_time,  */
-      tx.needed_fee,              /* CONST uint64_t fee, */
-      extra,                      /* const std::vector<uint8_t>& extra, */
-      test_tx,                    /* OUT   cryptonote::transaction& tx, */
-      test_ptx,                   /* OUT   cryptonote::transaction& tx, */
-      rct_config,
-      tx_type,
-      strSource,
-      strDest,
-      pricing_record,
-      current_height,
-      col_ins
-    );
-    auto txBlob = t_serializable_object_to_blob(test_ptx.tx);
-    tx.tx = test_tx;
-    tx.ptx = test_ptx;
-    tx.weight = get_transaction_weight(test_tx, txBlob.size());
+    catch (...)
+    {
+      errors[n] = std::current_exception();
+    }
+  };
+  if (parallel)
+  {
+    LOG_PRINT_L1("Constructing " << txes.size() << " transactions in parallel");
+    tools::threadpool& tpool = tools::threadpool::getInstance();
+    tools::threadpool::waiter waiter;
+    for (size_t n = 0; n < txes.size(); ++n)
+      tpool.submit(&waiter, [&construct, n](){ construct(n); });
+    waiter.wait(&tpool);
   }
+  else
+  {
+    for (size_t n = 0; n < txes.size(); ++n)
+      construct(n);
+  }
+  for (const std::exception_ptr &e: errors)
+    if (e)
+      std::rethrow_exception(e);
 
   std::vector<wallet2::pending_tx> ptx_vector;
   for (std::vector<TX>::iterator i = txes.begin(); i != txes.end(); ++i)
@@ -13099,7 +13406,7 @@ void wallet2::check_tx_key_helper(const cryptonote::transaction &tx, const crypt
         rct::key Ctmp;
         THROW_WALLET_EXCEPTION_IF(sc_check(ecdh_info.mask.bytes) != 0, error::wallet_internal_error, "Bad ECDH input mask");
         THROW_WALLET_EXCEPTION_IF(sc_check(ecdh_info.amount.bytes) != 0, error::wallet_internal_error, "Bad ECDH input amount");
-        rct::addKeys2(Ctmp, ecdh_info.mask, ecdh_info.amount, rct::H);
+        rct::addKeysGH(Ctmp, ecdh_info.mask, ecdh_info.amount);
         if (rct::equalKeys(C, Ctmp)) {
           amount = rct::h2d(ecdh_info.amount);
         }
@@ -14550,27 +14857,22 @@ void wallet2::import_payments_out(const std::list<std::pair<crypto::hash,wallet2
   }
 }
 
-std::tuple<size_t,crypto::hash,std::vector<crypto::hash>> wallet2::export_blockchain() const
+std::tuple<size_t,crypto::hash,std::vector<crypto::hash>,std::map<uint64_t,crypto::hash>> wallet2::export_blockchain() const
 {
-  std::tuple<size_t, crypto::hash, std::vector<crypto::hash>> bc;
+  std::tuple<size_t, crypto::hash, std::vector<crypto::hash>, std::map<uint64_t, crypto::hash>> bc;
   std::get<0>(bc) = m_blockchain.offset();
   std::get<1>(bc) = m_blockchain.empty() ? crypto::null_hash: m_blockchain.genesis();
   for (size_t n = m_blockchain.offset(); n < m_blockchain.size(); ++n)
   {
     std::get<2>(bc).push_back(m_blockchain[n]);
   }
+  std::get<3>(bc) = m_blockchain.checkpoints();
   return bc;
 }
 
-void wallet2::import_blockchain(const std::tuple<size_t, crypto::hash, std::vector<crypto::hash>> &bc)
+void wallet2::import_blockchain(const std::tuple<size_t, crypto::hash, std::vector<crypto::hash>, std::map<uint64_t, crypto::hash>> &bc)
 {
-  m_blockchain.clear();
-  if (std::get<0>(bc))
-  {
-    for (size_t n = std::get<0>(bc); n > 0; --n)
-      m_blockchain.push_back(std::get<1>(bc));
-    m_blockchain.trim(std::get<0>(bc));
-  }
+  m_blockchain.reset(std::get<0>(bc), std::get<1>(bc), std::get<3>(bc));
   for (auto const &b : std::get<2>(bc))
   {
     m_blockchain.push_back(b);
@@ -40,7 +40,9 @@
 #include <boost/serialization/list.hpp>
 #include <boost/serialization/vector.hpp>
 #include <boost/serialization/deque.hpp>
+#include <boost/serialization/map.hpp>
 #include <boost/thread/lock_guard.hpp>
+#include <boost/thread/shared_mutex.hpp>
 #include <atomic>
 #include <random>
 
@@ -185,20 +187,65 @@ private:
   class hashchain
   {
   public:
+    // every that many blocks, a hash trimmed off the dense part is kept as a sparse checkpoint
+    static constexpr size_t checkpoint_interval = 1000;
+
     hashchain(): m_genesis(crypto::null_hash), m_offset(0) {}
 
     size_t size() const { return m_blockchain.size() + m_offset; }
     size_t offset() const { return m_offset; }
     const crypto::hash &genesis() const { return m_genesis; }
+    const std::map<uint64_t, crypto::hash> &checkpoints() const { return m_checkpoints; }
     void push_back(const crypto::hash &hash) { if (m_offset == 0 && m_blockchain.empty()) m_genesis = hash; m_blockchain.push_back(hash); }
     bool is_in_bounds(size_t idx) const { return idx >= m_offset && idx < size(); }
+    bool has_checkpoint(size_t idx) const { return m_checkpoints.find(idx) != m_checkpoints.end(); }
     const crypto::hash &operator[](size_t idx) const { return m_blockchain[idx - m_offset]; }
     crypto::hash &operator[](size_t idx) { return m_blockchain[idx - m_offset]; }
     void crop(size_t height) { m_blockchain.resize(height - m_offset); }
-    void clear() { m_offset = 0; m_blockchain.clear(); }
+    void clear() { m_offset = 0; m_blockchain.clear(); m_checkpoints.clear(); }
     bool empty() const { return m_blockchain.empty() && m_offset == 0; }
-    void trim(size_t height) { while (height > m_offset && m_blockchain.size() > 1) { m_blockchain.pop_front(); ++m_offset; } m_blockchain.shrink_to_fit(); }
+    void trim(size_t height)
+    {
+      if (height <= m_offset || m_blockchain.size() <= 1)
+        return;
+      const size_t n = std::min(height - m_offset, m_blockchain.size() - 1);
+      for (size_t idx = m_offset; idx < m_offset + n; ++idx)
+        add_checkpoint(idx, m_blockchain[idx - m_offset]);
+      m_blockchain.erase(m_blockchain.begin(), m_blockchain.begin() + n);
+      m_offset += n;
+      m_blockchain.shrink_to_fit();
+    }
     void refill(const crypto::hash &hash) { m_blockchain.push_back(hash); --m_offset; }
+    // starts over with no dense part yet, from what another hashchain exported
+    void reset(size_t offset, const crypto::hash &genesis, std::map<uint64_t, crypto::hash> checkpoints)
+    {
+      m_offset = offset;
+      m_genesis = genesis;
+      m_blockchain.clear();
+      m_checkpoints = std::move(checkpoints);
+    }
+    // drops the dense part and restarts it from a block at or past the current tip, without storing the hashes in between
+    void skip_to(size_t height, const crypto::hash &hash)
+    {
+      trim(size());
+      for (size_t idx = m_offset; idx < size(); ++idx)
+        add_checkpoint(idx, m_blockchain[idx - m_offset]);
+      m_blockchain.clear();
+      m_offset = height;
+      m_blockchain.push_back(hash);
+    }
+    // restarts the dense part from a sparse checkpoint below the offset, dropping everything above it
+    void rewind(size_t height)
+    {
+      const auto it = m_checkpoints.find(height);
+      if (it == m_checkpoints.end())
+        return;
+      const crypto::hash hash = it->second;
+      m_checkpoints.erase(it, m_checkpoints.end());
+      m_blockchain.clear();
+      m_offset = height;
+      m_blockchain.push_back(hash);
+    }
 
     template <class t_archive>
     inline void serialize(t_archive &a, const unsigned int ver)
@@ -206,12 +253,22 @@ private:
       a & m_offset;
       a & m_genesis;
       a & m_blockchain;
+      if (ver < 1)
+        return;
+      a & m_checkpoints;
     }
 
   private:
+    void add_checkpoint(size_t idx, const crypto::hash &hash)
+    {
+      if (idx > 0 && idx % checkpoint_interval == 0 && hash != crypto::null_hash)
+        m_checkpoints[idx] = hash;
+    }
+
     size_t m_offset;
     crypto::hash m_genesis;
     std::deque<crypto::hash> m_blockchain;
+    std::map<uint64_t, crypto::hash> m_checkpoints;
   };
 
   class wallet_keys_unlocker;
@@ -830,6 +887,12 @@ private:
 
     i_wallet2_callback* callback() const { return m_callback; }
     void callback(i_wallet2_callback* callback) { m_callback = callback; }
+    /*!
+     * \brief Lock the caller holds exclusively around refresh(). While waiting on the
+     *        daemon for the next batch of blocks, refresh() downgrades it to upgrade
+     *        ownership so shared readers can see the state as of the last batch.
+     */
+    void set_refresh_yield_lock(boost::shared_mutex *lock) { m_refresh_yield_lock = lock; }
 
     bool is_trusted_daemon() const { return m_trusted_daemon; }
     void set_trusted_daemon(bool trusted) { m_trusted_daemon = trusted; }
@@ -1369,8 +1432,8 @@ private:
     payment_container export_payments() const;
     void import_payments(const payment_container &payments);
     void import_payments_out(const std::list<std::pair<crypto::hash,wallet2::confirmed_transfer_details>> &confirmed_payments);
-    std::tuple<size_t, crypto::hash, std::vector<crypto::hash>> export_blockchain() const;
-    void import_blockchain(const std::tuple<size_t, crypto::hash, std::vector<crypto::hash>> &bc);
+    std::tuple<size_t, crypto::hash, std::vector<crypto::hash>, std::map<uint64_t, crypto::hash>> export_blockchain() const;
+    void import_blockchain(const std::tuple<size_t, crypto::hash, std::vector<crypto::hash>, std::map<uint64_t, crypto::hash>> &bc);
     bool export_key_images(const std::string &filename, bool all = false) const;
     std::pair<size_t, std::vector<std::pair<crypto::key_image, crypto::signature>>> export_key_images(bool all = false) const;
     uint64_t import_key_images(const std::vector<std::pair<crypto::key_image, crypto::signature>> &signed_key_images, size_t offset, uint64_t &spent, uint64_t &unspent, bool check_spent = true);
@@ -1618,6 +1681,7 @@ private:
     std::vector<size_t> get_only_rct(const transfer_container &specific_transfers, const std::vector<size_t> &unused_dust_indices, const std::vector<size_t> &unused_transfers_indices) const;
     void scan_output(const cryptonote::transaction &tx, bool miner_tx, const crypto::public_key &tx_pub_key, size_t i, tx_scan_info_t &tx_scan_info, int &num_vouts_received, std::unordered_map<cryptonote::subaddress_index, std::map<std::string, uint64_t>> &tx_money_got_in_outs, std::vector<size_t> &outs, bool pool);
     void trim_hashchain();
+    void add_xasset_containers();
     crypto::key_image get_multisig_composite_key_image(transfer_container &specific_transfers, size_t n);
     rct::multisig_kLRki get_multisig_composite_kLRki(transfer_container &specific_transfers, size_t n,  const std::unordered_set<crypto::public_key> &ignore_set, std::unordered_set<rct::key> &used_L, std::unordered_set<rct::key> &new_used_L);
     rct::multisig_kLRki get_multisig_kLRki(transfer_container &specific_transfers, size_t n, const rct::key &k);
@@ -1642,6 +1706,7 @@ private:
     hw::device& lookup_device(const std::string & device_descriptor);
 
     bool get_rct_distribution(const bool use_global_outs, const std::string rct_asset_type, uint64_t &start_height, std::vector<uint64_t> &distribution, uint64_t &num_spendable_global_outs);
+    void invalidate_decoy_caches();
 
     uint64_t get_segregation_fork_height() const;
     void unpack_multisig_info(const std::vector<std::string>& info,
@@ -1759,6 +1824,19 @@ private:
     float m_auto_mine_for_rpc_payment_threshold;
     bool m_is_initialized;
     NodeRPCProxy m_node_rpc_proxy;
+
+    // cumulative rct output distribution, keyed by asset type (empty for global outputs),
+    // extended from its last height instead of being refetched for every tx
+    struct rct_distribution_cache_entry
+    {
+      uint64_t start_height;
+      std::vector<uint64_t> distribution;
+      uint64_t num_spendable_global_outs;
+    };
+    std::unordered_map<std::string, rct_distribution_cache_entry> m_rct_distribution_cache;
+    // unlocked outputs already fetched by get_outs, keyed by (asset type, amount, index), at most OUTS_CACHE_MAX_ENTRIES
+    std::map<std::tuple<std::string, uint64_t, uint64_t>, cryptonote::COMMAND_RPC_GET_OUTPUTS_BIN::outkey> m_outs_cache;
+    boost::mutex m_decoy_cache_mutex;
     std::unordered_set<crypto::hash> m_scanned_pool_txs[2];
     size_t m_subaddress_lookahead_major, m_subaddress_lookahead_minor;
     std::string m_device_name;
@@ -1770,6 +1848,7 @@ private:
     crypto::secret_key m_rpc_client_secret_key;
     rpc_payment_state_t m_rpc_payment_state;
     uint64_t m_credits_target;
+    boost::shared_mutex *m_refresh_yield_lock;
 
     // Aux transaction data from device
     std::unordered_map<crypto::hash, std::string> m_tx_device;
@@ -1818,6 +1897,7 @@ private:
     static std::string default_daemon_address;
   };
 }
+BOOST_CLASS_VERSION(tools::hashchain, 1)
 BOOST_CLASS_VERSION(tools::wallet2, 30)
 BOOST_CLASS_VERSION(tools::wallet2::transfer_details, 12)
 BOOST_CLASS_VERSION(tools::wallet2::multisig_info, 1)
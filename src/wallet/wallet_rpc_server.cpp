@@ -33,6 +33,7 @@
 #include <boost/algorithm/string.hpp>
 #include <boost/preprocessor/stringize.hpp>
 #include <cstdint>
+#include <unordered_set>
 #include "include_base_utils.h"
 using namespace epee;
 
@@ -60,6 +61,8 @@ using namespace epee;
 #define MONERO_DEFAULT_LOG_CATEGORY "wallet.rpc"
 
 #define DEFAULT_AUTO_REFRESH_PERIOD 20 // seconds
+#define RPC_SERVER_THREADS 4 // so a long refresh or transfer does not hold up read only calls
+#define MAX_READ_ONLY_REQUEST_SIZE 4096 // larger bodies are not inspected, and run exclusively
 
 namespace
 {
@@ -71,6 +74,23 @@ namespace
 
   constexpr const char default_rpc_username[] = "monero";
 
+  // methods which only read wallet state: they run alongside each other, and
+  // alongside a refresh while it waits for blocks from the daemon
+  const std::unordered_set<std::string> read_only_methods = {
+    "get_balance", "getbalance", "get_address", "getaddress", "get_address_index",
+    "get_height", "getheight", "get_payments", "get_bulk_payments", "incoming_transfers",
+    "get_version"
+  };
+
+  bool is_read_only_request(const epee::net_utils::http::http_request_info& query_info)
+  {
+    if (query_info.m_URI != "/json_rpc" || query_info.m_body.size() > MAX_READ_ONLY_REQUEST_SIZE)
+      return false;
+    epee::serialization::portable_storage ps;
+    std::string method;
+    return ps.load_from_json(query_info.m_body) && ps.get_value("method", method, nullptr) && read_only_methods.count(method);
+  }
+
   boost::optional<tools::password_container> password_prompter(const char *prompt, bool verify)
   {
     auto pwd_container = tools::password_container::prompt(verify, prompt);
@@ -127,8 +147,14 @@ namespace tools
         return true;
       if (boost::posix_time::microsec_clock::universal_time() < m_last_auto_refresh_time + boost::posix_time::seconds(m_auto_refresh_period))
         return true;
+      boost::unique_lock<boost::shared_mutex> lock(m_wallet_lock);
       try {
-        if (m_wallet) m_wallet->refresh(m_wallet->is_trusted_daemon());
+        if (m_wallet)
+        {
+          m_wallet->set_refresh_yield_lock(&m_wallet_lock);
+          auto unset = epee::misc_utils::create_scope_leave_handler([this](){ m_wallet->set_refresh_yield_lock(NULL); });
+          m_wallet->refresh(m_wallet->is_trusted_daemon());
+        }
       } catch (const std::exception& ex) {
         LOG_ERROR("Exception at while refreshing, what=" << ex.what());
       }
@@ -144,8 +170,42 @@ namespace tools
       return true;
     }, 500);
 
-    //DO NOT START THIS SERVER IN MORE THEN 1 THREADS WITHOUT REFACTORING
-    return epee::http_server_impl_base<wallet_rpc_server, connection_context>::run(1, true);
+    // requests are serialized on m_wallet_lock in handle_http_request, except read only ones
+    return epee::http_server_impl_base<wallet_rpc_server, connection_context>::run(RPC_SERVER_THREADS, true);
+  }
+  //------------------------------------------------------------------------------------------------------------------------------
+  bool wallet_rpc_server::handle_http_request(const epee::net_utils::http::http_request_info& query_info,
+    epee::net_utils::http::http_response_info& response, connection_context& m_conn_context)
+  {
+    MINFO("HTTP [" << m_conn_context.m_remote_address.host_str() << "] " << query_info.m_http_method_str << " " << query_info.m_URI);
+    response.m_response_code = 200;
+    response.m_response_comment = "Ok";
+    try
+    {
+      bool handled;
+      if (is_read_only_request(query_info))
+      {
+        boost::shared_lock<boost::shared_mutex> lock(m_wallet_lock);
+        handled = handle_http_request_map(query_info, response, m_conn_context);
+      }
+      else
+      {
+        boost::unique_lock<boost::shared_mutex> lock(m_wallet_lock);
+        handled = handle_http_request_map(query_info, response, m_conn_context);
+      }
+      if (!handled)
+      {
+        response.m_response_code = 404;
+        response.m_response_comment = "Not found";
+      }
+    }
+    catch (const std::exception &e)
+    {
+      MERROR(m_conn_context << "Exception in handle_http_request_map: " << e.what());
+      response.m_response_code = 500;
+      response.m_response_comment = "Internal Server Error";
+    }
+    return true;
   }
   //------------------------------------------------------------------------------------------------------------------------------
   void wallet_rpc_server::stop()
@@ -3713,6 +3773,9 @@ namespace tools
     }
     try
     {
+      // the exclusive lock is held by handle_http_request
+      m_wallet->set_refresh_yield_lock(&m_wallet_lock);
+      auto unset = epee::misc_utils::create_scope_leave_handler([this](){ m_wallet->set_refresh_yield_lock(NULL); });
       m_wallet->refresh(m_wallet->is_trusted_daemon(), req.start_height, res.blocks_fetched, res.received_money);
       return true;
     }
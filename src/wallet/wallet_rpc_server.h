@@ -32,6 +32,7 @@
 
 #include <boost/program_options/options_description.hpp>
 #include <boost/program_options/variables_map.hpp>
+#include <boost/thread/shared_mutex.hpp>
 #include <string>
 #include "common/util.h"
 #include "net/http_server_impl_base.h"
@@ -64,7 +65,10 @@ namespace tools
 
   private:
 
-    CHAIN_HTTP_TO_MAP2(connection_context); //forward http requests to uri map
+    // forwards http requests to the uri map, under a shared lock on the wallet
+    // for read only methods, and an exclusive one for everything else
+    bool handle_http_request(const epee::net_utils::http::http_request_info& query_info,
+      epee::net_utils::http::http_response_info& response, connection_context& m_conn_context);
 
     BEGIN_URI_MAP2()
       BEGIN_JSON_RPC_MAP("/json_rpc")
@@ -301,5 +305,6 @@ namespace tools
       const boost::program_options::variables_map *m_vm;
       uint32_t m_auto_refresh_period;
       boost::posix_time::ptime m_last_auto_refresh_time;
+      boost::shared_mutex m_wallet_lock;
   };
 }
@@ -28,9 +28,11 @@
 // 
 // Parts of this file are originally copyright (c) 2012-2013 The Cryptonote developers
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <functional>
+#include <limits>
 #include <numeric>
 #include <boost/thread/thread.hpp>
 #include <vector>
@@ -54,6 +56,22 @@ namespace
   const size_t DEFAULT_OPERATION_TIMEOUT = 30000;
   const size_t RESERVED_CONN_CNT = 1;
 
+  uint64_t percentile(const std::vector<uint64_t>& sorted, double p)
+  {
+    if (sorted.empty())
+      return 0;
+    return sorted[std::min(sorted.size() - 1, static_cast<size_t>(p * sorted.size()))];
+  }
+
+  std::string latency_summary(std::vector<uint64_t> us)
+  {
+    std::sort(us.begin(), us.end());
+    std::stringstream ss;
+    ss << "p50 " << percentile(us, 0.5) << " us, p90 " << percentile(us, 0.9) << " us, p99 " << percentile(us, 0.99) <<
+      " us, max " << percentile(us, 1.0) << " us (" << us.size() << " samples)";
+    return ss.str();
+  }
+
   template<typename t_predicate>
   bool busy_wait_for(size_t timeout_ms, const t_predicate& predicate, size_t sleep_ms = 10)
   {
@@ -627,6 +645,100 @@ TEST_F(net_load_test_clt, permament_open_and_close_and_connections_closed_by_ser
   ASSERT_EQ(RESERVED_CONN_CNT, m_tcp_server.get_config_object().get_connections_count());
 }
 
+TEST_F(net_load_test_clt, connection_rate_and_invoke_latency)
+{
+  // Run against net_load_tests_srv started with and without io_service shards to compare
+  static const size_t BENCH_CONNECTION_COUNT = 10000;
+  static const size_t BENCH_PING_ROUNDS = 10;
+  typedef std::chrono::steady_clock clock;
+  const auto elapsed_us = [](clock::time_point since) {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(clock::now() - since).count());
+  };
+
+  // Open connections, timing each from request to completion
+  std::vector<test_connection_context> contexts(BENCH_CONNECTION_COUNT);
+  std::vector<uint64_t> connect_us(BENCH_CONNECTION_COUNT, 0);
+  std::atomic<size_t> connect_done(0);
+  std::atomic<size_t> connect_errors(0);
+  const clock::time_point connect_start = clock::now();
+  parallel_exec([&](size_t thread_idx) {
+    for (size_t i = thread_idx; i < BENCH_CONNECTION_COUNT; i += m_thread_count)
+    {
+      const clock::time_point t0 = clock::now();
+      bool r = m_tcp_server.connect_async("127.0.0.1", srv_port, CONNECTION_TIMEOUT, [&, i, t0](const test_connection_context& context, const boost::system::error_code& ec) {
+        if (!ec)
+        {
+          connect_us[i] = elapsed_us(t0);
+          contexts[i] = context;
+        }
+        else
+        {
+          connect_errors.fetch_add(1, std::memory_order_relaxed);
+        }
+        connect_done.fetch_add(1, std::memory_order_seq_cst);
+      });
+      if (!r)
+      {
+        connect_errors.fetch_add(1, std::memory_order_relaxed);
+        connect_done.fetch_add(1, std::memory_order_seq_cst);
+      }
+    }
+  });
+  EXPECT_TRUE(busy_wait_for(DEFAULT_OPERATION_TIMEOUT, [&]{ return BENCH_CONNECTION_COUNT <= connect_done.load(std::memory_order_seq_cst); }));
+  const uint64_t connect_total_us = elapsed_us(connect_start);
+  ASSERT_EQ(BENCH_CONNECTION_COUNT, connect_done.load(std::memory_order_seq_cst));
+
+  std::vector<uint64_t> connect_samples;
+  for (size_t i = 0; i < BENCH_CONNECTION_COUNT; ++i)
+    if (!contexts[i].m_connection_id.is_nil())
+      connect_samples.push_back(connect_us[i]);
+  LOG_PRINT_L0("connections opened / failed: " << connect_samples.size() << " / " << connect_errors.load() << ", " <<
+    (connect_samples.size() * 1000000 / std::max<uint64_t>(connect_total_us, 1)) << " connections/s");
+  LOG_PRINT_L0("connect latency: " << latency_summary(connect_samples));
+  ASSERT_LT(0, connect_samples.size());
+
+  // Ping every open connection a few times, all connections at once
+  std::vector<uint64_t> ping_us(BENCH_CONNECTION_COUNT * BENCH_PING_ROUNDS, std::numeric_limits<uint64_t>::max());
+  std::atomic<size_t> ping_pending(0);
+  const clock::time_point ping_start = clock::now();
+  for (size_t round = 0; round < BENCH_PING_ROUNDS; ++round)
+  {
+    for (size_t i = 0; i < BENCH_CONNECTION_COUNT; ++i)
+    {
+      if (contexts[i].m_connection_id.is_nil())
+        continue;
+      const size_t sample = round * BENCH_CONNECTION_COUNT + i;
+      const clock::time_point t0 = clock::now();
+      ping_pending.fetch_add(1, std::memory_order_seq_cst);
+      bool r = epee::net_utils::async_invoke_remote_command2<CMD_PING::response>(contexts[i], CMD_PING::ID, CMD_PING::request(),
+        m_tcp_server.get_config_object(), [&, sample, t0](int code, const CMD_PING::response&, const test_connection_context&) {
+          if (0 < code)
+            ping_us[sample] = elapsed_us(t0);
+          ping_pending.fetch_sub(1, std::memory_order_seq_cst);
+      });
+      if (!r)
+        ping_pending.fetch_sub(1, std::memory_order_seq_cst);
+    }
+  }
+  EXPECT_TRUE(busy_wait_for(DEFAULT_OPERATION_TIMEOUT, [&]{ return 0 == ping_pending.load(std::memory_order_seq_cst); }));
+  const uint64_t ping_total_us = elapsed_us(ping_start);
+  ASSERT_EQ(0, ping_pending.load(std::memory_order_seq_cst));
+
+  std::vector<uint64_t> ping_samples;
+  std::copy_if(ping_us.begin(), ping_us.end(), std::back_inserter(ping_samples), [](uint64_t us) { return us != std::numeric_limits<uint64_t>::max(); });
+  LOG_PRINT_L0("pings answered: " << ping_samples.size() << ", " << (ping_samples.size() * 1000000 / std::max<uint64_t>(ping_total_us, 1)) << " invokes/s");
+  LOG_PRINT_L0("invoke latency: " << latency_summary(ping_samples));
+  ASSERT_LT(0, ping_samples.size());
+
+  // Close connections
+  for (const test_connection_context& context: contexts)
+    if (!context.m_connection_id.is_nil())
+      m_tcp_server.get_config_object().close(context.m_connection_id);
+
+  EXPECT_TRUE(busy_wait_for(DEFAULT_OPERATION_TIMEOUT, [&](){ return m_commands_handler.new_connection_counter() - RESERVED_CONN_CNT <= m_commands_handler.close_connection_counter(); }));
+  ASSERT_EQ(RESERVED_CONN_CNT, m_tcp_server.get_config_object().get_connections_count());
+}
+
 int main(int argc, char** argv)
 {
   TRY_ENTRY();
@@ -223,7 +223,8 @@ namespace net_load_tests
     cmd_reset_statistics_id,
     cmd_shutdown_id,
     cmd_send_data_requests_id,
-    cmd_data_request_id
+    cmd_data_request_id,
+    cmd_ping_id
   };
 
   struct CMD_CLOSE_ALL_CONNECTIONS
@@ -334,6 +335,23 @@ namespace net_load_tests
     };
   };
 
+  struct CMD_PING
+  {
+    const static int ID = cmd_ping_id;
+
+    struct request
+    {
+      BEGIN_KV_SERIALIZE_MAP()
+      END_KV_SERIALIZE_MAP()
+    };
+
+    struct response
+    {
+      BEGIN_KV_SERIALIZE_MAP()
+      END_KV_SERIALIZE_MAP()
+    };
+  };
+
   struct CMD_DATA_REQUEST
   {
     const static int ID = cmd_data_request_id;
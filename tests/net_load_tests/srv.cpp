@@ -89,6 +89,7 @@ namespace
       HANDLE_INVOKE_T2(CMD_GET_STATISTICS, &srv_levin_commands_handler::handle_get_statistics)
       HANDLE_INVOKE_T2(CMD_RESET_STATISTICS, &srv_levin_commands_handler::handle_reset_statistics)
       HANDLE_INVOKE_T2(CMD_START_OPEN_CLOSE_TEST, &srv_levin_commands_handler::handle_start_open_close_test)
+      HANDLE_INVOKE_T2(CMD_PING, &srv_levin_commands_handler::handle_ping)
     END_INVOKE_MAP2()
 
     int handle_close_all_connections(int command, const CMD_CLOSE_ALL_CONNECTIONS::request& req, test_connection_context& context)
@@ -131,6 +132,11 @@ namespace
       }
     }
 
+    int handle_ping(int command, const CMD_PING::request&, CMD_PING::response&, test_connection_context& /*context*/)
+    {
+      return 1;
+    }
+
     int handle_shutdown(int command, const CMD_SHUTDOWN::request& req, test_connection_context& /*context*/)
     {
       LOG_PRINT_L0("Got shutdown request. Shutting down...");
@@ -222,10 +228,15 @@ int main(int argc, char** argv)
   mlog_configure(mlog_get_default_log_path("net_load_tests_srv.log"), true);
 
   size_t thread_count = (std::max)(min_thread_count, boost::thread::hardware_concurrency() / 2);
+  // optional first argument: number of io_service shards, to compare against the single reactor
+  const size_t io_shards = 1 < argc ? std::max(1, atoi(argv[1])) : 1;
 
   test_tcp_server tcp_server(epee::net_utils::e_connection_type_RPC);
+  if (!tcp_server.set_io_shards(io_shards))
+    return 1;
   if (!tcp_server.init_server(srv_port, "127.0.0.1"))
     return 1;
+  LOG_PRINT_L0("Running over " << io_shards << " io_service shard(s)");
 
   srv_levin_commands_handler *commands_handler = new srv_levin_commands_handler(tcp_server);
   tcp_server.get_config_object().set_handler(commands_handler, [](epee::levin::levin_commands_handler<test_connection_context> *handler) { delete handler; });
@@ -32,6 +32,7 @@
 
 #include "string_tools.h"
 #include "crypto/crypto.h"
+#include "crypto/cn_slow_hash.hpp"
 #include "cryptonote_basic/cryptonote_basic.h"
 
 template<unsigned int variant>
@@ -67,3 +68,52 @@ public:
 private:
   data_t m_data;
 };
+
+// CN-Heavy block PoW, hashing `ways` blobs per run with the interleaved kernel
+// when ways > 1; compare the per-run time divided by ways against ways = 1
+template<size_t ways>
+class test_cn_heavy_hash
+{
+public:
+  static const size_t loop_count = 10;
+
+  bool init()
+  {
+    for (size_t i = 0; i < ways; ++i)
+    {
+      m_data[i].resize(76);
+      for (size_t j = 0; j < m_data[i].size(); ++j)
+        m_data[i][j] = (char)(i * 131 + j);
+      m_ctx_ptrs[i] = &m_ctx[i];
+      m_in[i] = m_data[i].data();
+      m_len[i] = m_data[i].size();
+      m_out[i] = m_hashes[i].data;
+    }
+    return true;
+  }
+
+  bool test()
+  {
+    hash(std::integral_constant<bool, ways == 1>());
+    return true;
+  }
+
+private:
+  void hash(std::true_type)
+  {
+    m_ctx[0].hash(m_in[0], m_len[0], m_out[0]);
+  }
+
+  void hash(std::false_type)
+  {
+    cn_pow_hash_v3::hash_multi<ways>(m_ctx_ptrs, m_in, m_len, m_out);
+  }
+
+  cn_pow_hash_v3 m_ctx[ways];
+  cn_pow_hash_v3 *m_ctx_ptrs[ways];
+  std::string m_data[ways];
+  const void *m_in[ways];
+  size_t m_len[ways];
+  void *m_out[ways];
+  crypto::hash m_hashes[ways];
+};
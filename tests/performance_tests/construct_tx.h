@@ -82,3 +82,69 @@ private:
   std::vector<cryptonote::tx_destination_entry> m_destinations;
   cryptonote::transaction m_tx;
 };
+
+// XHV -> XUSD conversion with a collateral output, as built by the wallet since HF_VERSION_USE_COLLATERAL;
+// every input re-spends the same real output, which is enough to exercise the per-input CLSAGs
+template<size_t a_in_count, size_t a_out_count>
+class test_construct_conversion_tx : private multi_tx_test_base<16>
+{
+  static_assert(0 < a_in_count, "in_count must be greater than 0");
+  static_assert(0 < a_out_count, "out_count must be greater than 0");
+
+public:
+  static const size_t loop_count = (a_in_count + a_out_count < 10) ? 10 : 5;
+  static const size_t in_count  = a_in_count;
+  static const size_t out_count = a_out_count;
+  static const uint64_t current_height = 1000000;
+
+  typedef multi_tx_test_base<16> base_class;
+
+  bool init()
+  {
+    using namespace cryptonote;
+
+    if (!base_class::init())
+      return false;
+
+    m_alice.generate();
+
+    for (size_t i = 1; i < in_count; ++i)
+      this->m_sources.push_back(this->m_sources.front());
+    for (tx_source_entry &src: this->m_sources)
+      src.asset_type = "XHV";
+
+    m_pr.xUSD = COIN;
+    m_pr.unused1 = COIN;
+
+    // convert a quarter of the inputs, lock as much again as collateral, and leave the rest for fees
+    const uint64_t total = this->m_source_amount * in_count;
+    const uint64_t converted = total / 4 / out_count;
+    for (size_t i = 0; i < out_count; ++i)
+    {
+      const uint64_t converted_usd = get_xusd_amount(converted, "XHV", m_pr, transaction_type::OFFSHORE, HF_VERSION_USE_COLLATERAL);
+      m_destinations.push_back(tx_destination_entry(converted, converted_usd, 0, m_alice.get_keys().m_account_address, false, "XUSD"));
+    }
+    tx_destination_entry collateral(total / 4, this->m_miners[this->real_source_idx].get_keys().m_account_address, false, true);
+    m_destinations.push_back(collateral);
+
+    return true;
+  }
+
+  bool test()
+  {
+    crypto::secret_key tx_key;
+    std::vector<crypto::secret_key> additional_tx_keys;
+    std::unordered_map<crypto::public_key, cryptonote::subaddress_index> subaddresses;
+    subaddresses[this->m_miners[this->real_source_idx].get_keys().m_account_address.m_spend_public_key] = {0,0};
+    rct::RCTConfig rct_config{rct::RangeProofPaddedBulletproof, 6};
+    return cryptonote::construct_tx_and_get_tx_key(this->m_miners[this->real_source_idx].get_keys(), subaddresses, this->m_sources, m_destinations,
+      this->m_miners[this->real_source_idx].get_keys().m_account_address, std::vector<uint8_t>(), m_tx, cryptonote::transaction_type::OFFSHORE, "XHV", "XUSD",
+      current_height + 5041, tx_key, additional_tx_keys, current_height, m_pr, HF_VERSION_USE_COLLATERAL, 0, true, rct_config);
+  }
+
+private:
+  cryptonote::account_base m_alice;
+  offshore::pricing_record m_pr;
+  std::vector<cryptonote::tx_destination_entry> m_destinations;
+  cryptonote::transaction m_tx;
+};
@@ -47,6 +47,7 @@ enum test_op
   op_scalarmultBase,
   op_scalarmultKey,
   op_scalarmultH,
+  op_scalarmultH_generic,
   op_scalarmult8,
   op_scalarmult8_p3,
   op_ge_dsm_precomp,
@@ -54,6 +55,8 @@ enum test_op
   op_ge_double_scalarmult_precomp_vartime,
   op_ge_double_scalarmult_precomp_vartime2,
   op_addKeys2,
+  op_addKeys2_H,
+  op_addKeysGH,
   op_addKeys3,
   op_addKeys3_2,
   op_isInMainSubgroup,
@@ -105,6 +108,7 @@ public:
       case op_scalarmultBase: rct::scalarmultBase(scalar0); break;
       case op_scalarmultKey: rct::scalarmultKey(point0, scalar0); break;
       case op_scalarmultH: rct::scalarmultH(scalar0); break;
+      case op_scalarmultH_generic: ge_scalarmult(&tmp_p2, scalar0.bytes, &ge_p3_H); ge_tobytes(key.bytes, &tmp_p2); break;
       case op_scalarmult8: rct::scalarmult8(point0); break;
       case op_scalarmult8_p3: rct::scalarmult8(p3_0,point0); break;
       case op_ge_dsm_precomp: ge_dsm_precomp(dsmp, &p3_0); break;
@@ -112,6 +116,8 @@ public:
       case op_ge_double_scalarmult_precomp_vartime: ge_double_scalarmult_precomp_vartime(&tmp_p2, scalar0.bytes, &p3_0, scalar1.bytes, precomp0); break;
       case op_ge_double_scalarmult_precomp_vartime2: ge_double_scalarmult_precomp_vartime2(&tmp_p2, scalar0.bytes, precomp0, scalar1.bytes, precomp1); break;
       case op_addKeys2: rct::addKeys2(key, scalar0, scalar1, point0); break;
+      case op_addKeys2_H: rct::addKeys2(key, scalar0, scalar1, rct::H); break;
+      case op_addKeysGH: rct::addKeysGH(key, scalar0, scalar1); break;
       case op_addKeys3: rct::addKeys3(key, scalar0, point0, scalar1, precomp1); break;
       case op_addKeys3_2: rct::addKeys3(key, scalar0, precomp0, scalar1, precomp1); break;
       case op_isInMainSubgroup: rct::isInMainSubgroup(point0); break;
@@ -151,6 +151,11 @@ int main(int argc, char** argv)
   TEST_PERFORMANCE5(filter, p, test_construct_tx, 100, 2, true, rct::RangeProofPaddedBulletproof, 2);
   TEST_PERFORMANCE5(filter, p, test_construct_tx, 100, 10, true, rct::RangeProofPaddedBulletproof, 2);
 
+  TEST_PERFORMANCE2(filter, p, test_construct_conversion_tx, 1, 1);
+  TEST_PERFORMANCE2(filter, p, test_construct_conversion_tx, 2, 1);
+  TEST_PERFORMANCE2(filter, p, test_construct_conversion_tx, 4, 2);
+  TEST_PERFORMANCE2(filter, p, test_construct_conversion_tx, 8, 2);
+
   TEST_PERFORMANCE3(filter, p, test_check_tx_signature, 1, 2, false);
   TEST_PERFORMANCE3(filter, p, test_check_tx_signature, 2, 2, false);
   TEST_PERFORMANCE3(filter, p, test_check_tx_signature, 10, 2, false);
@@ -210,6 +215,9 @@ int main(int argc, char** argv)
   TEST_PERFORMANCE1(filter, p, test_cn_slow_hash, 1);
   TEST_PERFORMANCE1(filter, p, test_cn_slow_hash, 2);
   TEST_PERFORMANCE1(filter, p, test_cn_slow_hash, 4);
+  TEST_PERFORMANCE1(filter, p, test_cn_heavy_hash, 1);
+  TEST_PERFORMANCE1(filter, p, test_cn_heavy_hash, 2);
+  TEST_PERFORMANCE1(filter, p, test_cn_heavy_hash, 4);
   TEST_PERFORMANCE1(filter, p, test_cn_fast_hash, 32);
   TEST_PERFORMANCE1(filter, p, test_cn_fast_hash, 16384);
 
@@ -253,6 +261,7 @@ int main(int argc, char** argv)
   TEST_PERFORMANCE1(filter, p, test_crypto_ops, op_scalarmultBase);
   TEST_PERFORMANCE1(filter, p, test_crypto_ops, op_scalarmultKey);
   TEST_PERFORMANCE1(filter, p, test_crypto_ops, op_scalarmultH);
+  TEST_PERFORMANCE1(filter, p, test_crypto_ops, op_scalarmultH_generic);
   TEST_PERFORMANCE1(filter, p, test_crypto_ops, op_scalarmult8);
   TEST_PERFORMANCE1(filter, p, test_crypto_ops, op_scalarmult8_p3);
   TEST_PERFORMANCE1(filter, p, test_crypto_ops, op_ge_dsm_precomp);
@@ -260,6 +269,8 @@ int main(int argc, char** argv)
   TEST_PERFORMANCE1(filter, p, test_crypto_ops, op_ge_double_scalarmult_precomp_vartime);
   TEST_PERFORMANCE1(filter, p, test_crypto_ops, op_ge_double_scalarmult_precomp_vartime2);
   TEST_PERFORMANCE1(filter, p, test_crypto_ops, op_addKeys2);
+  TEST_PERFORMANCE1(filter, p, test_crypto_ops, op_addKeys2_H);
+  TEST_PERFORMANCE1(filter, p, test_crypto_ops, op_addKeysGH);
   TEST_PERFORMANCE1(filter, p, test_crypto_ops, op_addKeys3);
   TEST_PERFORMANCE1(filter, p, test_crypto_ops, op_addKeys3_2);
   TEST_PERFORMANCE1(filter, p, test_crypto_ops, op_isInMainSubgroup);
@@ -548,6 +559,27 @@ int main(int argc, char** argv)
   TEST_PERFORMANCE3(filter, p, test_multiexp, multiexp_pippenger, 4096, 7);
   TEST_PERFORMANCE3(filter, p, test_multiexp, multiexp_pippenger, 4096, 8);
   TEST_PERFORMANCE3(filter, p, test_multiexp, multiexp_pippenger, 4096, 9);
+
+  TEST_PERFORMANCE4(filter, p, test_multiexp, multiexp_pippenger, 1024, 0, 1);
+  TEST_PERFORMANCE4(filter, p, test_multiexp, multiexp_pippenger, 1024, 0, 2);
+  TEST_PERFORMANCE4(filter, p, test_multiexp, multiexp_pippenger, 1024, 0, 4);
+  TEST_PERFORMANCE4(filter, p, test_multiexp, multiexp_pippenger, 1024, 0, 8);
+  TEST_PERFORMANCE4(filter, p, test_multiexp, multiexp_pippenger, 1024, 0, 16);
+  TEST_PERFORMANCE4(filter, p, test_multiexp, multiexp_pippenger, 4096, 0, 1);
+  TEST_PERFORMANCE4(filter, p, test_multiexp, multiexp_pippenger, 4096, 0, 2);
+  TEST_PERFORMANCE4(filter, p, test_multiexp, multiexp_pippenger, 4096, 0, 4);
+  TEST_PERFORMANCE4(filter, p, test_multiexp, multiexp_pippenger, 4096, 0, 8);
+  TEST_PERFORMANCE4(filter, p, test_multiexp, multiexp_pippenger, 4096, 0, 16);
+  TEST_PERFORMANCE4(filter, p, test_multiexp, multiexp_pippenger, 16384, 0, 1);
+  TEST_PERFORMANCE4(filter, p, test_multiexp, multiexp_pippenger, 16384, 0, 2);
+  TEST_PERFORMANCE4(filter, p, test_multiexp, multiexp_pippenger, 16384, 0, 4);
+  TEST_PERFORMANCE4(filter, p, test_multiexp, multiexp_pippenger, 16384, 0, 8);
+  TEST_PERFORMANCE4(filter, p, test_multiexp, multiexp_pippenger, 16384, 0, 16);
+  TEST_PERFORMANCE4(filter, p, test_multiexp, multiexp_pippenger_cached, 4096, 0, 1);
+  TEST_PERFORMANCE4(filter, p, test_multiexp, multiexp_pippenger_cached, 4096, 0, 2);
+  TEST_PERFORMANCE4(filter, p, test_multiexp, multiexp_pippenger_cached, 4096, 0, 4);
+  TEST_PERFORMANCE4(filter, p, test_multiexp, multiexp_pippenger_cached, 4096, 0, 8);
+  TEST_PERFORMANCE4(filter, p, test_multiexp, multiexp_pippenger_cached, 4096, 0, 16);
 #endif
 
   std::cout << "Tests finished. Elapsed time: " << timer.elapsed_ms() / 1000 << " sec" << std::endl;
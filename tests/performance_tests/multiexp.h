@@ -43,7 +43,7 @@ enum test_multiexp_algorithm
   multiexp_pippenger_cached,
 };
 
-template<test_multiexp_algorithm algorithm, size_t npoints, size_t c=0>
+template<test_multiexp_algorithm algorithm, size_t npoints, size_t c=0, size_t threads=1>
 class test_multiexp
 {
 public:
@@ -78,9 +78,9 @@ public:
       case multiexp_straus_cached:
         return res == straus(data, straus_cache);
       case multiexp_pippenger:
-        return res == pippenger(data, NULL, 0, c);
+        return res == pippenger(data, NULL, 0, c, threads);
       case multiexp_pippenger_cached:
-        return res == pippenger(data, pippenger_cache, 0, c);
+        return res == pippenger(data, pippenger_cache, 0, c, threads);
       default:
         return false;
     }
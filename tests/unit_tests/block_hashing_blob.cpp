@@ -0,0 +1,63 @@
+// Copyright (c) 2019, The Monero Project
+// 
+// All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without modification, are
+// permitted provided that the following conditions are met:
+// 
+// 1. Redistributions of source code must retain the above copyright notice, this list of
+//    conditions and the following disclaimer.
+// 
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list
+//    of conditions and the following disclaimer in the documentation and/or other
+//    materials provided with the distribution.
+// 
+// 3. Neither the name of the copyright holder nor the names of its contributors may be
+//    used to endorse or promote products derived from this software without specific
+//    prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL
+// THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#include "gtest/gtest.h"
+
+#include "cryptonote_basic/cryptonote_format_utils.h"
+#include "cryptonote_config.h"
+
+TEST(block_hashing_blob, patched_nonce)
+{
+  // the nonce offset depends on the varint lengths ahead of it, and the pricing record
+  // follows it from HF_VERSION_OFFSHORE_PRICING
+  for (uint8_t major_version : {1, 2, 3, 5, 15, HF_VERSION_OFFSHORE_PRICING, 20, 127, 128, 130})
+  {
+    for (uint64_t timestamp : {0ull, 127ull, 128ull, 16383ull, 16384ull, 1700000000ull, 0xffffffffffffffffull})
+    {
+      cryptonote::block b;
+      b.major_version = major_version;
+      b.minor_version = major_version + 1;
+      b.timestamp = timestamp;
+      b.nonce = 0x01020304;
+      memset(b.prev_id.data, 0x5a, sizeof(b.prev_id.data));
+      b.miner_tx.version = 1;
+      b.miner_tx.vin.push_back(cryptonote::txin_gen{42});
+
+      cryptonote::blobdata blob = cryptonote::get_block_hashing_blob(b);
+      const size_t offset = cryptonote::get_nonce_offset(b);
+      for (uint32_t nonce : {0u, 1u, 0xdeadbeefu, 0xffffffffu})
+      {
+        cryptonote::set_blob_nonce(blob, offset, nonce);
+        b.nonce = nonce;
+        b.invalidate_hashes();
+        ASSERT_EQ(cryptonote::get_block_hashing_blob(b), blob) << "major version " << (unsigned)major_version << ", timestamp " << timestamp << ", nonce " << nonce;
+      }
+    }
+  }
+}
@@ -0,0 +1,139 @@
+// Copyright (c) 2020, The Monero Project
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are
+// permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of
+//    conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list
+//    of conditions and the following disclaimer in the documentation and/or other
+//    materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be
+//    used to endorse or promote products derived from this software without specific
+//    prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL
+// THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <string>
+#include <vector>
+#include "gtest/gtest.h"
+#include "crypto/crypto.h"
+#include "cryptonote_protocol/block_span_cache.h"
+
+static std::vector<crypto::hash> make_ids(size_t n)
+{
+  std::vector<crypto::hash> ids(n);
+  for (auto &h: ids)
+    h = crypto::rand<crypto::hash>();
+  return ids;
+}
+
+static epee::byte_slice make_message(size_t size)
+{
+  return epee::byte_slice{std::string(size, 'x')};
+}
+
+TEST(block_span_cache, get_put)
+{
+  cryptonote::block_span_cache cache(1000);
+  const std::vector<crypto::hash> ids = make_ids(10);
+  epee::byte_slice message;
+  uint64_t last_height = 0;
+
+  ASSERT_FALSE(cache.get(epee::to_span(ids), false, message, last_height));
+  cache.put(epee::to_span(ids), false, make_message(100), 42);
+  ASSERT_EQ(1, cache.size());
+  ASSERT_EQ(100, cache.bytes());
+
+  ASSERT_TRUE(cache.get(epee::to_span(ids), false, message, last_height));
+  ASSERT_EQ(100, message.size());
+  ASSERT_EQ(42, last_height);
+
+  // the cached buffer is shared, not copied
+  epee::byte_slice again;
+  ASSERT_TRUE(cache.get(epee::to_span(ids), false, again, last_height));
+  ASSERT_EQ(message.data(), again.data());
+
+  // pruned and unpruned are different spans
+  ASSERT_FALSE(cache.get(epee::to_span(ids), true, message, last_height));
+  ASSERT_EQ(2, cache.hits());
+  ASSERT_EQ(2, cache.misses());
+}
+
+TEST(block_span_cache, same_start_different_span)
+{
+  cryptonote::block_span_cache cache(1000);
+  std::vector<crypto::hash> ids = make_ids(10);
+  cache.put(epee::to_span(ids), false, make_message(100), 10);
+
+  epee::byte_slice message;
+  uint64_t last_height = 0;
+  ids.back() = crypto::rand<crypto::hash>();
+  ASSERT_FALSE(cache.get(epee::to_span(ids), false, message, last_height));
+  ids.pop_back();
+  ASSERT_FALSE(cache.get(epee::to_span(ids), false, message, last_height));
+  ASSERT_FALSE(cache.get(nullptr, false, message, last_height));
+}
+
+TEST(block_span_cache, lru)
+{
+  cryptonote::block_span_cache cache(300);
+  const std::vector<crypto::hash> a = make_ids(5), b = make_ids(5), c = make_ids(5), d = make_ids(5);
+  epee::byte_slice message;
+  uint64_t last_height = 0;
+
+  cache.put(epee::to_span(a), false, make_message(100), 1);
+  cache.put(epee::to_span(b), false, make_message(100), 2);
+  cache.put(epee::to_span(c), false, make_message(100), 3);
+  ASSERT_EQ(300, cache.bytes());
+
+  ASSERT_TRUE(cache.get(epee::to_span(a), false, message, last_height)); // a is now the most recent
+  cache.put(epee::to_span(d), false, make_message(150), 4);
+  ASSERT_EQ(250, cache.bytes());
+  ASSERT_TRUE(cache.get(epee::to_span(a), false, message, last_height));
+  ASSERT_FALSE(cache.get(epee::to_span(b), false, message, last_height));
+  ASSERT_FALSE(cache.get(epee::to_span(c), false, message, last_height));
+  ASSERT_TRUE(cache.get(epee::to_span(d), false, message, last_height));
+
+  // too large to ever fit
+  cache.put(epee::to_span(b), false, make_message(301), 2);
+  ASSERT_FALSE(cache.get(epee::to_span(b), false, message, last_height));
+  ASSERT_EQ(2, cache.size());
+
+  // replacing a span does not count it twice
+  cache.put(epee::to_span(d), false, make_message(50), 4);
+  ASSERT_EQ(150, cache.bytes());
+}
+
+TEST(block_span_cache, remove_from)
+{
+  cryptonote::block_span_cache cache(1000);
+  const std::vector<crypto::hash> a = make_ids(5), b = make_ids(5), c = make_ids(5);
+  epee::byte_slice message;
+  uint64_t last_height = 0;
+
+  cache.put(epee::to_span(a), false, make_message(10), 100);
+  cache.put(epee::to_span(b), true, make_message(10), 200);
+  cache.put(epee::to_span(c), false, make_message(10), 300);
+  cache.remove_from(200);
+  ASSERT_EQ(1, cache.size());
+  ASSERT_EQ(10, cache.bytes());
+  ASSERT_TRUE(cache.get(epee::to_span(a), false, message, last_height));
+  ASSERT_FALSE(cache.get(epee::to_span(b), true, message, last_height));
+
+  cache.clear();
+  ASSERT_EQ(0, cache.size());
+  ASSERT_EQ(0, cache.bytes());
+}
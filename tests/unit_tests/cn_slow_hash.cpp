@@ -0,0 +1,113 @@
+// Copyright (c) 2019, The Monero Project
+// 
+// All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without modification, are
+// permitted provided that the following conditions are met:
+// 
+// 1. Redistributions of source code must retain the above copyright notice, this list of
+//    conditions and the following disclaimer.
+// 
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list
+//    of conditions and the following disclaimer in the documentation and/or other
+//    materials provided with the distribution.
+// 
+// 3. Neither the name of the copyright holder nor the names of its contributors may be
+//    used to endorse or promote products derived from this software without specific
+//    prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL
+// THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#include "gtest/gtest.h"
+
+#include "crypto/cn_slow_hash.hpp"
+#include "cryptonote_basic/cryptonote_format_utils.h"
+#include "cryptonote_core/cryptonote_tx_utils.h"
+
+namespace
+{
+  template<class T, size_t N>
+  void check_hash_multi()
+  {
+    T ctx[N];
+    T *ctx_ptrs[N];
+    std::string data[N];
+    const void *in[N];
+    size_t len[N];
+    char hashes[N][32];
+    void *out[N];
+    for (size_t i = 0; i < N; ++i)
+    {
+      // different lengths so the lanes also differ in keccak padding
+      data[i].resize(43 + i * 33);
+      for (size_t j = 0; j < data[i].size(); ++j)
+        data[i][j] = (char)(i * 131 + j * 7);
+      ctx_ptrs[i] = &ctx[i];
+      in[i] = data[i].data();
+      len[i] = data[i].size();
+      out[i] = hashes[i];
+    }
+
+    T::template hash_multi<N>(ctx_ptrs, in, len, out);
+
+    for (size_t i = 0; i < N; ++i)
+    {
+      char expected[32];
+      ctx[0].hash(in[i], len[i], expected);
+      ASSERT_EQ(0, memcmp(expected, hashes[i], sizeof(expected))) << "lane " << i;
+    }
+  }
+}
+
+TEST(cn_slow_hash, hash_multi_v1)
+{
+  check_hash_multi<cn_pow_hash_v1, 2>();
+  check_hash_multi<cn_pow_hash_v1, 4>();
+}
+
+TEST(cn_slow_hash, hash_multi_v2)
+{
+  check_hash_multi<cn_pow_hash_v2, 2>();
+  check_hash_multi<cn_pow_hash_v2, 4>();
+}
+
+TEST(cn_slow_hash, hash_multi_v3)
+{
+  check_hash_multi<cn_pow_hash_v3, 2>();
+  check_hash_multi<cn_pow_hash_v3, 4>();
+}
+
+TEST(cn_slow_hash, block_longhashes)
+{
+  // runs of 5 v1, 3 v2, 6 v3, 1 v1 and 3 v3 blocks: full runs, 1, 2 and 3 block
+  // remainders, and runs cut short where the PoW variant changes
+  const uint8_t versions[] = {1, 1, 1, 1, 1, 2, 2, 2, 3, 3, 11, 11, 11, 11, 1, 3, 3, HF_VERSION_OFFSHORE_PRICING};
+  std::vector<cryptonote::block> blocks(sizeof(versions));
+  std::vector<const cryptonote::block*> ptrs;
+  for (size_t i = 0; i < blocks.size(); ++i)
+  {
+    cryptonote::block &b = blocks[i];
+    b.major_version = versions[i];
+    b.minor_version = versions[i];
+    b.timestamp = 1500000000 + i * 120;
+    b.nonce = i * 2654435761u;
+    b.miner_tx.version = 1;
+    b.miner_tx.vin.push_back(cryptonote::txin_gen{i});
+    ptrs.push_back(&b);
+  }
+
+  std::vector<crypto::hash> hashes;
+  cryptonote::get_block_longhashes(NULL, ptrs, hashes);
+  ASSERT_EQ(hashes.size(), blocks.size());
+  for (size_t i = 0; i < blocks.size(); ++i)
+    ASSERT_EQ(cryptonote::get_block_longhash(NULL, blocks[i], i, 0), hashes[i]) << "block " << i;
+}
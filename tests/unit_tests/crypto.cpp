@@ -27,12 +27,14 @@
 // THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <cstdint>
+#include <cstring>
 #include <gtest/gtest.h>
 #include <memory>
 #include <sstream>
 #include <string>
 
 #include "cryptonote_basic/cryptonote_basic_impl.h"
+#include "ringct/rctOps.h"
 
 namespace
 {
@@ -99,3 +101,120 @@ TEST(Crypto, verify_32)
     }
   }
 }
+
+TEST(Crypto, scalarmult_H)
+{
+  // the fixed base table must give the same points as the generic scalarmult
+  for (int i = 0; i < 256; ++i)
+  {
+    const rct::key a = i < 128 ? rct::d2h(crypto::rand<uint64_t>() >> (i % 64)) : rct::skGen();
+    ge_p2 R;
+    rct::key expected;
+    ge_scalarmult(&R, a.bytes, &ge_p3_H);
+    ge_tobytes(expected.bytes, &R);
+    ASSERT_EQ(rct::scalarmultH(a), expected);
+
+    const rct::key b = rct::skGen();
+    rct::key aGbH;
+    rct::addKeys2(expected, b, a, rct::H);
+    rct::addKeysGH(aGbH, b, a);
+    ASSERT_EQ(aGbH, expected);
+  }
+  ASSERT_EQ(rct::scalarmultH(rct::identity()), rct::H);
+
+  // unreduced scalars, a[31] > 127, must give the same points as their reduced form
+  for (int i = 0; i < 256; ++i)
+  {
+    rct::key a = rct::skGen(), b = rct::skGen();
+    if (i == 0)
+      memset(a.bytes, 0xff, sizeof(a.bytes));
+    a.bytes[31] |= 0x80 | (i & 0x7f);
+    b.bytes[31] |= 0x80 | ((i * 37) & 0x7f);
+    rct::key ar, br;
+    sc_reduce32copy(ar.bytes, a.bytes);
+    sc_reduce32copy(br.bytes, b.bytes);
+    ge_p2 R;
+    rct::key expected;
+    ge_scalarmult(&R, ar.bytes, &ge_p3_H);
+    ge_tobytes(expected.bytes, &R);
+    ASSERT_EQ(rct::scalarmultH(a), expected);
+
+    rct::key aGbH;
+    rct::addKeys2(expected, br, ar, rct::H);
+    rct::addKeysGH(aGbH, b, a);
+    ASSERT_EQ(aGbH, expected);
+  }
+}
+
+namespace
+{
+  struct backend_results
+  {
+    rct::key scalarmult, scalarmult_p3, double_base, double_base_p3, double_precomp, double_precomp_p3, triple_precomp, triple_base;
+    rct::key add_cached, dbl_n;
+    rct::key precomp_last;
+  };
+
+  backend_results run_backend(crypto_ops_backend backend, const rct::key &a, const rct::key &b, const rct::key &c, const rct::key &A, const rct::key &B, const rct::key &C)
+  {
+    EXPECT_EQ(crypto_ops_set_backend(backend), 0);
+    backend_results res;
+    ge_p3 A_p3, B_p3, C_p3, r3;
+    ge_p2 r;
+    ge_dsmp Ai, Bi, Ci;
+    EXPECT_EQ(ge_frombytes_vartime(&A_p3, A.bytes), 0);
+    EXPECT_EQ(ge_frombytes_vartime(&B_p3, B.bytes), 0);
+    EXPECT_EQ(ge_frombytes_vartime(&C_p3, C.bytes), 0);
+    ge_dsm_precomp(Ai, &A_p3);
+    ge_dsm_precomp(Bi, &B_p3);
+    ge_dsm_precomp(Ci, &C_p3);
+
+    ge_scalarmult(&r, a.bytes, &A_p3); ge_tobytes(res.scalarmult.bytes, &r);
+    ge_scalarmult_p3(&r3, a.bytes, &A_p3); ge_p3_tobytes(res.scalarmult_p3.bytes, &r3);
+    ge_double_scalarmult_base_vartime(&r, a.bytes, &A_p3, b.bytes); ge_tobytes(res.double_base.bytes, &r);
+    ge_double_scalarmult_base_vartime_p3(&r3, a.bytes, &A_p3, b.bytes); ge_p3_tobytes(res.double_base_p3.bytes, &r3);
+    ge_double_scalarmult_precomp_vartime2(&r, a.bytes, Ai, b.bytes, Bi); ge_tobytes(res.double_precomp.bytes, &r);
+    ge_double_scalarmult_precomp_vartime2_p3(&r3, a.bytes, Ai, b.bytes, Bi); ge_p3_tobytes(res.double_precomp_p3.bytes, &r3);
+    ge_triple_scalarmult_precomp_vartime(&r, a.bytes, Ai, b.bytes, Bi, c.bytes, Ci); ge_tobytes(res.triple_precomp.bytes, &r);
+    ge_triple_scalarmult_base_vartime(&r, a.bytes, b.bytes, Bi, c.bytes, Ci); ge_tobytes(res.triple_base.bytes, &r);
+    ge_p3_add_cached(&r3, &A_p3, &Bi[0]); ge_p3_tobytes(res.add_cached.bytes, &r3);
+    ge_p3_dbl_n(&r3, &r3, 1 + a.bytes[0] % 9); ge_p3_tobytes(res.dbl_n.bytes, &r3);
+
+    // the precomputed multiples must be usable by the other backend's group operations
+    ge_p1p1 t;
+    EXPECT_EQ(crypto_ops_set_backend(CRYPTO_OPS_BACKEND_REF10), 0);
+    ge_add(&t, &A_p3, &Ai[7]);
+    ge_p1p1_to_p3(&r3, &t);
+    ge_p3_tobytes(res.precomp_last.bytes, &r3);
+    return res;
+  }
+}
+
+TEST(Crypto, field_backends)
+{
+  const crypto_ops_backend initial = crypto_ops_get_backend();
+  if (crypto_ops_set_backend(CRYPTO_OPS_BACKEND_FE51) != 0)
+    return; // only ref10 in this build
+
+  for (int i = 0; i < 64; ++i)
+  {
+    const rct::key a = i % 8 == 1 ? rct::zero() : rct::skGen();
+    const rct::key b = i % 8 == 2 ? rct::zero() : rct::skGen();
+    const rct::key c = i % 8 == 3 ? rct::identity() : rct::skGen();
+    const rct::key A = rct::pkGen(), B = rct::pkGen(), C = i % 8 == 4 ? rct::identity() : rct::pkGen();
+    const backend_results ref10 = run_backend(CRYPTO_OPS_BACKEND_REF10, a, b, c, A, B, C);
+    const backend_results fe51 = run_backend(CRYPTO_OPS_BACKEND_FE51, a, b, c, A, B, C);
+    ASSERT_EQ(ref10.scalarmult, fe51.scalarmult);
+    ASSERT_EQ(ref10.scalarmult_p3, fe51.scalarmult_p3);
+    ASSERT_EQ(ref10.double_base, fe51.double_base);
+    ASSERT_EQ(ref10.double_base_p3, fe51.double_base_p3);
+    ASSERT_EQ(ref10.double_precomp, fe51.double_precomp);
+    ASSERT_EQ(ref10.double_precomp_p3, fe51.double_precomp_p3);
+    ASSERT_EQ(ref10.triple_precomp, fe51.triple_precomp);
+    ASSERT_EQ(ref10.triple_base, fe51.triple_base);
+    ASSERT_EQ(ref10.add_cached, fe51.add_cached);
+    ASSERT_EQ(ref10.dbl_n, fe51.dbl_n);
+    ASSERT_EQ(ref10.precomp_last, fe51.precomp_last);
+  }
+  ASSERT_EQ(crypto_ops_set_backend(initial), 0);
+}
@@ -127,3 +127,98 @@ TEST(hashchain, trim)
   ASSERT_FALSE(hashchain.empty());
   ASSERT_EQ(hashchain.genesis(), make_hash(1));
 }
+
+TEST(hashchain, trim_keeps_checkpoints)
+{
+  tools::hashchain hashchain;
+  for (int n = 0; n < 5000; ++n)
+    hashchain.push_back(make_hash(n + 1));
+  hashchain.trim(4500);
+  ASSERT_EQ(hashchain.offset(), 4500);
+  ASSERT_EQ(hashchain.size(), 5000);
+  ASSERT_EQ(hashchain.checkpoints().size(), 4);
+  ASSERT_FALSE(hashchain.has_checkpoint(0));
+  ASSERT_TRUE(hashchain.has_checkpoint(1000));
+  ASSERT_TRUE(hashchain.has_checkpoint(4000));
+  ASSERT_FALSE(hashchain.has_checkpoint(4500));
+  ASSERT_EQ(hashchain.checkpoints().at(3000), make_hash(3001));
+  ASSERT_EQ(hashchain[4500], make_hash(4501));
+  ASSERT_EQ(hashchain.genesis(), make_hash(1));
+}
+
+TEST(hashchain, skip_to)
+{
+  tools::hashchain hashchain;
+  for (int n = 0; n < 1500; ++n)
+    hashchain.push_back(make_hash(n + 1));
+  hashchain.skip_to(3000, make_hash(3001));
+  ASSERT_EQ(hashchain.offset(), 3000);
+  ASSERT_EQ(hashchain.size(), 3001);
+  ASSERT_EQ(hashchain[3000], make_hash(3001));
+  ASSERT_EQ(hashchain.checkpoints().size(), 1);
+  ASSERT_EQ(hashchain.checkpoints().at(1000), make_hash(1001));
+  ASSERT_EQ(hashchain.genesis(), make_hash(1));
+  hashchain.push_back(make_hash(3002));
+  ASSERT_EQ(hashchain.size(), 3002);
+}
+
+TEST(hashchain, rewind)
+{
+  tools::hashchain hashchain;
+  for (int n = 0; n < 5000; ++n)
+    hashchain.push_back(make_hash(n + 1));
+  hashchain.trim(4500);
+  hashchain.rewind(1500); // not a checkpoint
+  ASSERT_EQ(hashchain.offset(), 4500);
+  ASSERT_EQ(hashchain.size(), 5000);
+  hashchain.rewind(2000);
+  ASSERT_EQ(hashchain.offset(), 2000);
+  ASSERT_EQ(hashchain.size(), 2001);
+  ASSERT_EQ(hashchain[2000], make_hash(2001));
+  ASSERT_TRUE(hashchain.has_checkpoint(1000));
+  ASSERT_FALSE(hashchain.has_checkpoint(2000));
+  ASSERT_FALSE(hashchain.has_checkpoint(3000));
+  ASSERT_EQ(hashchain.genesis(), make_hash(1));
+  hashchain.clear();
+  ASSERT_TRUE(hashchain.checkpoints().empty());
+}
+
+TEST(hashchain, reset_round_trip)
+{
+  tools::hashchain hashchain;
+  for (int n = 0; n < 5000; ++n)
+    hashchain.push_back(make_hash(n + 1));
+  hashchain.trim(4500);
+
+  // what export_blockchain/import_blockchain carry over
+  std::vector<crypto::hash> dense;
+  for (size_t n = hashchain.offset(); n < hashchain.size(); ++n)
+    dense.push_back(hashchain[n]);
+  tools::hashchain imported;
+  imported.reset(hashchain.offset(), hashchain.genesis(), hashchain.checkpoints());
+  for (const crypto::hash &hash: dense)
+    imported.push_back(hash);
+
+  ASSERT_EQ(imported.offset(), hashchain.offset());
+  ASSERT_EQ(imported.size(), hashchain.size());
+  ASSERT_EQ(imported.genesis(), make_hash(1));
+  ASSERT_EQ(imported.checkpoints(), hashchain.checkpoints());
+  for (size_t n = imported.offset(); n < imported.size(); ++n)
+    ASSERT_EQ(imported[n], hashchain[n]);
+
+  // the checkpoints are the real ones, so a deep reorg can still rewind to them
+  imported.rewind(2000);
+  ASSERT_EQ(imported.offset(), 2000);
+  ASSERT_EQ(imported[2000], make_hash(2001));
+
+  // a chain which was never trimmed comes back as is
+  tools::hashchain short_chain, short_imported;
+  short_chain.push_back(make_hash(1));
+  short_chain.push_back(make_hash(2));
+  short_imported.reset(short_chain.offset(), short_chain.genesis(), short_chain.checkpoints());
+  short_imported.push_back(short_chain[0]);
+  short_imported.push_back(short_chain[1]);
+  ASSERT_EQ(short_imported.size(), 2);
+  ASSERT_EQ(short_imported.genesis(), make_hash(1));
+  ASSERT_TRUE(short_imported.checkpoints().empty());
+}
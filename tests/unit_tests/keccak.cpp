@@ -28,6 +28,7 @@
 
 #include "gtest/gtest.h"
 
+#include "crypto/hash.h"
 extern "C" {
 #include "crypto/keccak.h"
 }
@@ -161,3 +162,85 @@ TEST(keccak, alignment)
     ASSERT_TRUE(!memcmp(md, amd, 32));
   }
 }
+
+TEST(keccak, x4)
+{
+  static const size_t lengths[] = {0, 1, 31, 64, 135, 136, 137, 271, 272, 273, 1000, 6000};
+  static const size_t nlengths = sizeof(lengths) / sizeof(lengths[0]);
+  std::string data(6000, 0);
+  for (size_t i = 0; i < data.size(); ++i)
+    data[i] = i * 13;
+
+  for (int mdlen: {32, 200})
+  {
+    for (size_t i = 0; i < nlengths; ++i)
+    {
+      uint8_t md[4][200], ref[200];
+      const uint8_t *in[4];
+      size_t inlen[4];
+      uint8_t *const mds[4] = {md[0], md[1], md[2], md[3]};
+      for (size_t l = 0; l < 4; ++l)
+      {
+        in[l] = (const uint8_t*)data.data() + l;
+        inlen[l] = lengths[(i + l * 5) % nlengths];
+      }
+      keccak_x4(in, inlen, mds, mdlen);
+      for (size_t l = 0; l < 4; ++l)
+      {
+        keccak(in[l], inlen[l], ref, mdlen);
+        ASSERT_EQ(memcmp(md[l], ref, mdlen), 0);
+      }
+    }
+  }
+}
+
+TEST(keccak, cn_fast_hash_multi)
+{
+  std::string data(3000, 0);
+  for (size_t i = 0; i < data.size(); ++i)
+    data[i] = i * 7;
+
+  for (size_t count = 0; count < 11; ++count)
+  {
+    std::vector<const void*> blobs(count);
+    std::vector<size_t> lengths(count);
+    std::vector<crypto::hash> hashes(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+      blobs[i] = data.data() + i;
+      lengths[i] = (i * 137) % 1500;
+    }
+    crypto::cn_fast_hash_multi(blobs.data(), lengths.data(), count, hashes.data());
+    for (size_t i = 0; i < count; ++i)
+      ASSERT_EQ(hashes[i], crypto::cn_fast_hash(blobs[i], lengths[i]));
+  }
+}
+
+TEST(keccak, tree_hash)
+{
+  for (size_t count = 1; count < 70; ++count)
+  {
+    std::vector<crypto::hash> leaves(count);
+    for (size_t i = 0; i < count; ++i)
+      leaves[i] = crypto::cn_fast_hash(&i, sizeof(i));
+
+    // reference: pair up the tail down to a power of two, then halve
+    size_t cnt = 1;
+    while (cnt * 2 <= count)
+      cnt *= 2;
+    std::vector<crypto::hash> level(leaves.begin(), leaves.begin() + (2 * cnt - count));
+    for (size_t i = 2 * cnt - count; i < count; i += 2)
+      level.push_back(crypto::cn_fast_hash(&leaves[i], 2 * sizeof(crypto::hash)));
+    while (level.size() > 1)
+    {
+      std::vector<crypto::hash> next;
+      for (size_t i = 0; i < level.size(); i += 2)
+        next.push_back(crypto::cn_fast_hash(&level[i], 2 * sizeof(crypto::hash)));
+      level.swap(next);
+    }
+
+    crypto::hash root;
+    crypto::tree_hash(leaves.data(), count, root);
+    ASSERT_EQ(root, level[0]);
+  }
+}
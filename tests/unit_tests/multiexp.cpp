@@ -252,3 +252,20 @@ TEST(multiexp, pippenger_cached)
     ASSERT_TRUE(basic(data) == pippenger(data, cache));
   }
 }
+
+TEST(multiexp, pippenger_threads)
+{
+  static constexpr size_t N = 600;
+  std::vector<rct::MultiexpData> data;
+  for (size_t n = 0; n < N; ++n)
+    data.push_back({n % 50 == 0 ? rct::zero() : rct::skGen(), get_p3(rct::scalarmultBase(rct::skGen()))});
+  data.push_back({TESTPOW2SCALAR, get_p3(TESTPOINT)});
+  data.push_back({TESTSMALLSCALAR, get_p3(TESTPOINT)});
+  const rct::key expected = basic(data);
+  std::shared_ptr<rct::pippenger_cached_data> cache = rct::pippenger_init_cache(data, 0, N / 2);
+  for (size_t threads: {0, 1, 2, 3, 8, 64})
+  {
+    ASSERT_TRUE(expected == pippenger(data, NULL, 0, 0, threads));
+    ASSERT_TRUE(expected == pippenger(data, cache, N / 2, 0, threads));
+  }
+}
@@ -0,0 +1,128 @@
+// Copyright (c) 2020, The Monero Project
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are
+// permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of
+//    conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list
+//    of conditions and the following disclaimer in the documentation and/or other
+//    materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be
+//    used to endorse or promote products derived from this software without specific
+//    prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL
+// THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <cstring>
+#include "gtest/gtest.h"
+#include "ringct/rctOps.h"
+#include "ringct/ring_member_cache.h"
+
+static rct::ctkey make_member()
+{
+  rct::ctkey member;
+  member.dest = rct::pkGen();
+  member.mask = rct::pkGen();
+  return member;
+}
+
+TEST(ring_member_cache, matches_direct_computation)
+{
+  rct::ring_member_cache cache(64);
+  const rct::ctkey member = make_member();
+
+  const auto precomp = cache.get(member);
+  ASSERT_TRUE(precomp != nullptr);
+  ASSERT_EQ(precomp->member.dest, member.dest);
+  ASSERT_EQ(precomp->member.mask, member.mask);
+
+  rct::geDsmp P;
+  rct::precomp(P.k, member.dest);
+  ASSERT_EQ(0, memcmp(P.k, precomp->P, sizeof(P.k)));
+
+  ge_p3 hash8_p3;
+  rct::geDsmp Hp;
+  rct::hash_to_p3(hash8_p3, member.dest);
+  ge_dsm_precomp(Hp.k, &hash8_p3);
+  ASSERT_EQ(0, memcmp(Hp.k, precomp->Hp, sizeof(Hp.k)));
+
+  rct::key C;
+  ge_p3_tobytes(C.bytes, &precomp->C);
+  ASSERT_EQ(C, member.mask);
+}
+
+TEST(ring_member_cache, hits)
+{
+  rct::ring_member_cache cache(64);
+  const rct::ctkey member = make_member();
+
+  const auto first = cache.get(member);
+  ASSERT_EQ(cache.misses(), 1);
+  ASSERT_EQ(cache.hits(), 0);
+  const auto second = cache.get(member);
+  ASSERT_EQ(cache.misses(), 1);
+  ASSERT_EQ(cache.hits(), 1);
+  ASSERT_EQ(first, second);
+  ASSERT_EQ(cache.size(), 1);
+}
+
+TEST(ring_member_cache, mask_mismatch)
+{
+  rct::ring_member_cache cache(64);
+  rct::ctkey member = make_member();
+
+  const auto first = cache.get(member);
+  member.mask = rct::pkGen();
+  const auto second = cache.get(member);
+  ASSERT_TRUE(second != nullptr);
+  ASSERT_NE(first, second);
+  ASSERT_EQ(second->member.mask, member.mask);
+  ASSERT_EQ(cache.misses(), 2);
+  ASSERT_EQ(cache.size(), 1);
+}
+
+TEST(ring_member_cache, invalid_point)
+{
+  rct::ring_member_cache cache(64);
+  rct::ctkey member = make_member();
+  member.mask = rct::zero();
+  member.mask.bytes[0] = 2; // y = 2 is not on the curve
+  ASSERT_TRUE(cache.get(member) == nullptr);
+  ASSERT_EQ(cache.size(), 0);
+}
+
+TEST(ring_member_cache, eviction)
+{
+  rct::ring_member_cache cache(16); // one entry per shard
+  rct::ctkey first;
+  do first = make_member(); while (first.dest.bytes[0] % 16 != 0);
+  ASSERT_TRUE(cache.get(first) != nullptr);
+
+  // another member in the same shard evicts the first
+  rct::ctkey second;
+  do second = make_member(); while (second.dest.bytes[0] % 16 != 0);
+  ASSERT_TRUE(cache.get(second) != nullptr);
+  ASSERT_EQ(cache.size(), 1);
+
+  cache.get(second);
+  ASSERT_EQ(cache.hits(), 1);
+  cache.get(first);
+  ASSERT_EQ(cache.hits(), 1);
+  ASSERT_EQ(cache.misses(), 3);
+
+  cache.clear();
+  ASSERT_EQ(cache.size(), 0);
+}
@@ -1090,6 +1090,43 @@ TEST(ringct, mul8)
   ASSERT_EQ(rct::scalarmultKey(rct::scalarmultKey(rct::H, rct::INV_EIGHT), rct::EIGHT), rct::H);
 }
 
+TEST(ringct, isInMainSubgroup_batch)
+{
+  // a point of order 8 and the point of order 2
+  static const rct::key T8 = { {0x26, 0xe8, 0x95, 0x8f, 0xc2, 0xb2, 0x27, 0xb0, 0x45, 0xc3, 0xf4, 0x89, 0xf2, 0xef, 0x98, 0xf0, 0xd5, 0xdf, 0xac, 0x05, 0xd3, 0xc6, 0x33, 0x39, 0xb1, 0x38, 0x02, 0x88, 0x6d, 0x53, 0xfc, 0x05} };
+  static const rct::key T2 = { {0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f} };
+
+  for (size_t n: {0, 1, 5, SUBGROUP_CHECK_MT_MIN_SIZE, 3 * SUBGROUP_CHECK_MT_MIN_SIZE + 1})
+  {
+    rct::keyV points(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+      points[i] = rct::scalarmultBase(rct::skGen());
+      if (i % 7 == 3)
+        points[i] = rct::addKeys(points[i], T8);
+      else if (i % 7 == 5)
+        points[i] = rct::addKeys(points[i], T2);
+    }
+    if (n > 2)
+      points[1] = T2;
+
+    std::vector<bool> valid;
+    bool all = true;
+    const bool r = rct::isInMainSubgroup(points, valid);
+    ASSERT_EQ(valid.size(), n);
+    ASSERT_EQ(r, std::find(valid.begin(), valid.end(), false) == valid.end());
+    for (size_t i = 0; i < n; ++i)
+    {
+      const bool expected = rct::scalarmultKey(points[i], rct::curveOrder()) == rct::identity();
+      ASSERT_EQ(valid[i], expected);
+      ASSERT_EQ(rct::isInMainSubgroup(points[i]), expected);
+      all = all && expected;
+    }
+    ASSERT_EQ(rct::isInMainSubgroup(points, valid), all);
+    ASSERT_EQ(all, n < 4);
+  }
+}
+
 TEST(ringct, aggregated)
 {
   static const size_t N_PROOFS = 16;
@@ -0,0 +1,68 @@
+// Copyright (c) 2014-2020, The Monero Project
+// 
+// All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without modification, are
+// permitted provided that the following conditions are met:
+// 
+// 1. Redistributions of source code must retain the above copyright notice, this list of
+//    conditions and the following disclaimer.
+// 
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list
+//    of conditions and the following disclaimer in the documentation and/or other
+//    materials provided with the distribution.
+// 
+// 3. Neither the name of the copyright holder nor the names of its contributors may be
+//    used to endorse or promote products derived from this software without specific
+//    prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL
+// THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "crypto/siphash.h"
+}
+
+// reference vectors from the SipHash paper, key 00 01 .. 0f and input 00 01 .. (len - 1)
+static const struct {
+  size_t len;
+  uint64_t res;
+} siphash_vectors[] = {
+  {0, 0x726fdb47dd0e0e31ull},
+  {1, 0x74f839c593dc67fdull},
+  {8, 0x93f5f5799a932462ull},
+  {15, 0xa129ca6149be45e5ull},
+  {63, 0x958a324ceb064572ull},
+};
+
+TEST(siphash, reference_vectors)
+{
+  uint8_t key[SIPHASH_KEYLEN];
+  uint8_t in[64];
+  for (size_t i = 0; i < sizeof(key); ++i)
+    key[i] = i;
+  for (size_t i = 0; i < sizeof(in); ++i)
+    in[i] = i;
+
+  for (const auto &v: siphash_vectors)
+    ASSERT_EQ(siphash24(key, in, v.len), v.res);
+}
+
+TEST(siphash, key_changes_result)
+{
+  uint8_t key[SIPHASH_KEYLEN] = {0};
+  const uint8_t in[32] = {0};
+  const uint64_t h0 = siphash24(key, in, sizeof(in));
+  key[15] = 1;
+  ASSERT_NE(siphash24(key, in, sizeof(in)), h0);
+}
@@ -71,6 +71,33 @@ TEST(peer_list, peer_list_general)
   ASSERT_EQ(plm.get_white_peers_count(), 4);
 }
 
+TEST(peer_list, anonymized_head)
+{
+  nodetool::peerlist_manager plm;
+  plm.init(nodetool::peerlist_types{}, false);
+  for (uint8_t i = 1; i <= 40; ++i)
+    ADD_WHITE_NODE(MAKE_IPV4_ADDRESS(123,43,12,i, 8080), i, 1000 + i);
+
+  for (uint32_t depth: {0u, 1u, 10u, 40u, 100u})
+  {
+    std::vector<nodetool::peerlist_entry> bs_head;
+    ASSERT_TRUE(plm.get_peerlist_head(bs_head, true, depth));
+    ASSERT_EQ(bs_head.size(), std::min<size_t>(depth, 40));
+    std::set<uint64_t> ids;
+    for (const auto &e: bs_head)
+    {
+      ASSERT_EQ(e.last_seen, 0);
+      ASSERT_TRUE(ids.insert(e.id).second);
+    }
+  }
+
+  std::vector<nodetool::peerlist_entry> bs_head;
+  ASSERT_TRUE(plm.get_peerlist_head(bs_head, false, 3));
+  ASSERT_EQ(bs_head.size(), 3);
+  ASSERT_EQ(bs_head[0].last_seen, 1040);
+  ASSERT_EQ(bs_head[2].last_seen, 1038);
+}
+
 
 TEST(peer_list, merge_peer_lists)
 {
@@ -0,0 +1,104 @@
+// Copyright (c) 2020, The Monero Project
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are
+// permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of
+//    conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list
+//    of conditions and the following disclaimer in the documentation and/or other
+//    materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be
+//    used to endorse or promote products derived from this software without specific
+//    prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL
+// THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+#include "gtest/gtest.h"
+#include "net/token_bucket.h"
+
+using epee::net_utils::token_bucket;
+
+TEST(token_bucket, unlimited)
+{
+  token_bucket bucket;
+  for (int i = 0; i < 100; ++i)
+    ASSERT_EQ(0, bucket.consume(1000000).count());
+  ASSERT_EQ(100u, bucket.get_total_packets());
+  ASSERT_EQ(100000000u, bucket.get_total_bytes());
+  ASSERT_EQ(0, bucket.get_total_delay().count());
+}
+
+TEST(token_bucket, burst_then_delay)
+{
+  token_bucket bucket(1000000, std::chrono::seconds(1));
+  // a second worth of traffic fits in the burst
+  ASSERT_EQ(0, bucket.consume(500000).count());
+  ASSERT_EQ(0, bucket.consume(400000).count());
+  // then the excess has to wait, about as long as it takes to send it at the rate
+  const std::chrono::nanoseconds delay = bucket.consume(1100000);
+  ASSERT_GT(delay, std::chrono::milliseconds(900));
+  ASSERT_LE(delay, std::chrono::seconds(1));
+  ASSERT_EQ(delay, bucket.get_total_delay());
+}
+
+TEST(token_bucket, set_rate)
+{
+  token_bucket bucket(1000, std::chrono::milliseconds(0));
+  ASSERT_GT(bucket.consume(10000), std::chrono::seconds(9));
+  ASSERT_EQ(1000u, bucket.get_rate());
+  bucket.set_rate(0);
+  ASSERT_EQ(0, bucket.consume(10000).count());
+  bucket.set_rate(1000000000);
+  ASSERT_EQ(1000000000u, bucket.get_rate());
+  ASSERT_LT(bucket.consume(10000), std::chrono::milliseconds(1));
+}
+
+TEST(token_bucket, concurrent)
+{
+  static constexpr unsigned threads = 4;
+  static constexpr unsigned packets = 10000;
+  token_bucket bucket(1000, std::chrono::seconds(1));
+  std::vector<std::thread> workers;
+  std::vector<std::chrono::nanoseconds> max_delay(threads, std::chrono::nanoseconds(0));
+  for (unsigned t = 0; t < threads; ++t)
+    workers.emplace_back([&bucket, &max_delay, t]{
+      for (unsigned i = 0; i < packets; ++i)
+        max_delay[t] = std::max(max_delay[t], bucket.consume(100));
+    });
+  for (auto &w: workers)
+    w.join();
+  ASSERT_EQ(threads * packets, bucket.get_total_packets());
+  ASSERT_EQ(threads * packets * 100u, bucket.get_total_bytes());
+  // 4 MB at 1 kB/s with a 1 second burst: no update is lost, so the last packets wait about 3999 seconds,
+  // less however long the loop took, which leaves slow machines seconds of slack without a wall clock bound
+  const std::chrono::nanoseconds delay = *std::max_element(max_delay.begin(), max_delay.end());
+  ASSERT_GT(delay, std::chrono::seconds(3990));
+  ASSERT_LE(delay, std::chrono::seconds(3999));
+}
+
+TEST(token_bucket, per_peer_share)
+{
+  uint64_t tat = 0;
+  ASSERT_EQ(0, token_bucket::consume(tat, 0, 1000000, std::chrono::seconds(0)).count());
+  ASSERT_EQ(0u, tat);
+  ASSERT_EQ(0, token_bucket::consume(tat, 1000, 500, std::chrono::seconds(1)).count());
+  const std::chrono::nanoseconds delay = token_bucket::consume(tat, 1000, 1500, std::chrono::seconds(1));
+  ASSERT_GT(delay, std::chrono::milliseconds(900));
+  ASSERT_LE(delay, std::chrono::seconds(1));
+}
@@ -0,0 +1,137 @@
+// Copyright (c) 2020, The Monero Project
+// 
+// All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without modification, are
+// permitted provided that the following conditions are met:
+// 
+// 1. Redistributions of source code must retain the above copyright notice, this list of
+//    conditions and the following disclaimer.
+// 
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list
+//    of conditions and the following disclaimer in the documentation and/or other
+//    materials provided with the distribution.
+// 
+// 3. Neither the name of the copyright holder nor the names of its contributors may be
+//    used to endorse or promote products derived from this software without specific
+//    prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL
+// THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <algorithm>
+#include "gtest/gtest.h"
+#include "crypto/crypto.h"
+#include "cryptonote_protocol/txpool_sketch.h"
+
+static std::vector<crypto::hash> make_hashes(size_t n)
+{
+  std::vector<crypto::hash> hashes(n);
+  for (auto &h: hashes)
+    h = crypto::rand<crypto::hash>();
+  return hashes;
+}
+
+static std::vector<uint64_t> get_keys(const cryptonote::txpool_sketch &sketch, const std::vector<crypto::hash> &hashes)
+{
+  std::vector<uint64_t> keys;
+  for (const auto &h: hashes)
+    keys.push_back(sketch.get_key(h));
+  std::sort(keys.begin(), keys.end());
+  return keys;
+}
+
+TEST(txpool_sketch, cells)
+{
+  ASSERT_EQ(cryptonote::txpool_sketch::get_cells(0) % 3, 0);
+  ASSERT_EQ(cryptonote::txpool_sketch::get_cells(0), cryptonote::txpool_sketch::get_cells(10));
+  ASSERT_EQ(cryptonote::txpool_sketch::get_cells(4000) % 3, 0);
+  ASSERT_GT(cryptonote::txpool_sketch::get_cells(4000), cryptonote::txpool_sketch::get_cells(10));
+  ASSERT_EQ(cryptonote::txpool_sketch::get_cells(1000000), cryptonote::txpool_sketch::get_cells(10000000));
+}
+
+TEST(txpool_sketch, empty_difference)
+{
+  const std::vector<crypto::hash> common = make_hashes(500);
+  cryptonote::txpool_sketch a(1, cryptonote::txpool_sketch::get_cells(common.size()));
+  cryptonote::txpool_sketch b(1, a.cells());
+  for (const auto &h: common)
+  {
+    a.insert(a.get_key(h));
+    b.insert(b.get_key(h));
+  }
+  ASSERT_TRUE(a.subtract(b));
+  std::vector<uint64_t> ours, theirs;
+  ASSERT_TRUE(a.decode(ours, theirs));
+  ASSERT_TRUE(ours.empty());
+  ASSERT_TRUE(theirs.empty());
+}
+
+TEST(txpool_sketch, decode_difference)
+{
+  const std::vector<crypto::hash> common = make_hashes(2000);
+  const std::vector<crypto::hash> only_a = make_hashes(30);
+  const std::vector<crypto::hash> only_b = make_hashes(25);
+  const uint64_t salt = crypto::rand<uint64_t>();
+  cryptonote::txpool_sketch a(salt, cryptonote::txpool_sketch::get_cells(common.size() + only_a.size()));
+  cryptonote::txpool_sketch b(salt, a.cells());
+  for (const auto &h: common)
+  {
+    a.insert(a.get_key(h));
+    b.insert(b.get_key(h));
+  }
+  for (const auto &h: only_a)
+    a.insert(a.get_key(h));
+  for (const auto &h: only_b)
+    b.insert(b.get_key(h));
+
+  // b only sees the serialized sketch of a
+  cryptonote::txpool_sketch received(salt, 0);
+  ASSERT_TRUE(received.load(a.serialize()));
+  ASSERT_EQ(received.cells(), a.cells());
+  ASSERT_TRUE(b.subtract(received));
+
+  std::vector<uint64_t> ours, theirs;
+  ASSERT_TRUE(b.decode(ours, theirs));
+  std::sort(ours.begin(), ours.end());
+  std::sort(theirs.begin(), theirs.end());
+  ASSERT_EQ(ours, get_keys(b, only_b));
+  ASSERT_EQ(theirs, get_keys(b, only_a));
+}
+
+TEST(txpool_sketch, difference_too_large)
+{
+  const std::vector<crypto::hash> only_a = make_hashes(1000);
+  cryptonote::txpool_sketch a(2, cryptonote::txpool_sketch::get_cells(0));
+  cryptonote::txpool_sketch b(2, a.cells());
+  for (const auto &h: only_a)
+    a.insert(a.get_key(h));
+  ASSERT_TRUE(b.subtract(a));
+  std::vector<uint64_t> ours, theirs;
+  ASSERT_FALSE(b.decode(ours, theirs));
+}
+
+TEST(txpool_sketch, mismatch)
+{
+  cryptonote::txpool_sketch a(3, 96), b(4, 96), c(3, 192);
+  ASSERT_FALSE(a.subtract(b));
+  ASSERT_FALSE(a.subtract(c));
+  ASSERT_TRUE(a.subtract(a));
+}
+
+TEST(txpool_sketch, load_invalid)
+{
+  cryptonote::txpool_sketch a(5, 0);
+  ASSERT_FALSE(a.load(""));
+  ASSERT_FALSE(a.load(std::string(96 * cryptonote::txpool_sketch::cell_size + 1, '\0')));
+  ASSERT_FALSE(a.load(std::string(97 * cryptonote::txpool_sketch::cell_size, '\0')));
+  ASSERT_FALSE(a.load(std::string(100000 * cryptonote::txpool_sketch::cell_size, '\0')));
+  ASSERT_TRUE(a.load(std::string(96 * cryptonote::txpool_sketch::cell_size, '\0')));
+}